@@ -0,0 +1,76 @@
+#include "benchmarking.hpp"
+#include "unit_tests/src/csi.hpp"
+
+#include <algorithm>
+#include <format>
+
+
+Benchmarking *Benchmarking::singleton = nullptr;
+
+
+std::string Benchmarking::change_section(const std::string_view p_section_name) {
+  section = p_section_name;
+  return std::format("{}===== {} ====={}", CSI_BOLD, section, CSI_CLEAR);
+}
+
+
+std::string Benchmarking::add_result(const std::string_view p_name, const size_t ops_per_sample, std::vector<double> &samples) {
+  std::sort(samples.begin(), samples.end());
+  const size_t count = samples.size();
+  const double median = (count % 2 == 1)? samples[count / 2] : 0.5 * (samples[count / 2 - 1] + samples[count / 2]);
+  // Nearest rank percentile
+  const size_t p95_rank = (95 * count + 99) / 100;
+  const double p95 = samples[std::max<size_t>(p95_rank, 1) - 1];
+
+  const Result &result = results.emplace_back(Result{
+    .section = section,
+    .name = std::string(p_name),
+    .samples = count,
+    .ops_per_sample = ops_per_sample,
+    .median_ns = median,
+    .p95_ns = p95,
+    .ops_per_second = 1e9 / median,
+  });
+  return std::format(
+    "{:<32} median {:>10.3f} ns/op   p95 {:>10.3f} ns/op   {:>10.3f} Mop/s",
+    result.name, result.median_ns, result.p95_ns, result.ops_per_second * 1e-6
+  );
+}
+
+
+static std::string json_escape(const std::string_view s) {
+  std::string escaped;
+  for (const char c : s) {
+    if (c == '"' || c == '\\') {
+      escaped += '\\';
+    }
+    escaped += c;
+  }
+  return escaped;
+}
+
+
+std::string Benchmarking::get_json() const {
+  std::string json = "{\n";
+  json += std::format("  \"warmup\": {},\n  \"repetitions\": {},\n  \"benchmarks\": [", warmup, repetitions);
+  for (size_t i = 0; i < results.size(); i++) {
+    const Result &r = results[i];
+    json += std::format(
+      "{}\n    {{\"section\": \"{}\", \"name\": \"{}\", \"samples\": {}, \"ops_per_sample\": {}, \"median_ns\": {:.4f}, \"p95_ns\": {:.4f}, \"ops_per_second\": {:.1f}}}",
+      (i == 0)? "" : ",", json_escape(r.section), json_escape(r.name), r.samples, r.ops_per_sample, r.median_ns, r.p95_ns, r.ops_per_second
+    );
+  }
+  json += "\n  ]\n}\n";
+  return json;
+}
+
+
+void Benchmarking::init_singleton() {
+  singleton = new Benchmarking();
+}
+
+
+void Benchmarking::deinit_singleton() {
+  delete singleton;
+  singleton = nullptr;
+}
@@ -0,0 +1,156 @@
+#pragma once
+
+
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "kmath/vector.hpp"
+
+
+// Prevents the compiler from optimizing away the computation of a value (GCC / Clang).
+template<typename T>
+inline void do_not_optimize(const T &value) {
+  asm volatile("" : : "r,m"(value) : "memory");
+}
+
+
+class Benchmarking {
+public:
+  struct Result {
+    std::string section;
+    std::string name;
+    size_t samples;
+    size_t ops_per_sample;
+    double median_ns;
+    double p95_ns;
+    double ops_per_second;
+  };
+
+
+public:
+  std::string change_section(const std::string_view p_section_name);
+
+  // Measures `body`, which performs `ops` operations per call. The call count of a sample is
+  // calibrated so that a sample lasts about `sample_duration`, then `warmup` samples are run
+  // and discarded before `repetitions` samples are recorded. The median and 95th percentile
+  // are given in nanoseconds per operation.
+  template<typename F>
+  std::string run(const std::string_view p_name, const size_t ops, F &&body) {
+    size_t calls = 1;
+    while (true) {
+      const double ns = measure(calls, body);
+      if (ns >= double(sample_duration.count()) || calls >= (size_t(1) << 30)) {
+        break;
+      }
+      calls *= 2;
+    }
+
+    for (size_t i = 0; i < warmup; i++) {
+      measure(calls, body);
+    }
+
+    std::vector<double> samples;
+    samples.reserve(repetitions);
+    for (size_t i = 0; i < repetitions; i++) {
+      samples.push_back(measure(calls, body) / double(calls * ops));
+    }
+    return add_result(p_name, calls * ops, samples);
+  }
+
+  std::string get_json() const;
+  
+  
+public:
+  size_t warmup = 3;
+  size_t repetitions = 25;
+  std::chrono::nanoseconds sample_duration = std::chrono::milliseconds(2);
+
+
+public:
+  static void init_singleton();
+  static inline Benchmarking *get_singleton() {
+    return singleton;
+  }
+  static void deinit_singleton();
+
+
+private:
+  template<typename F>
+  static double measure(const size_t calls, F &body) {
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < calls; i++) {
+      body();
+    }
+    const auto end = std::chrono::steady_clock::now();
+    return double(std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count());
+  }
+
+  std::string add_result(const std::string_view p_name, const size_t ops_per_sample, std::vector<double> &samples);
+
+
+private:
+  std::string section;
+  std::vector<Result> results;
+
+
+private:
+  static Benchmarking *singleton;
+};
+
+
+#define BENCHMARK_SECTION(p_section_name, p_section) {                                           \
+  std::cout << "\n" << Benchmarking::get_singleton()->change_section(p_section_name) << std::endl; \
+  p_section                                                                                       \
+}
+
+
+// Runs `p_op` on every element of `p_inputs` (a std::vector), one operation per element
+#define BENCHMARK(p_name, p_inputs, p_op) {                                                   \
+  const auto &inputs = p_inputs;                                                              \
+  std::cout << Benchmarking::get_singleton()->run(p_name, inputs.size(), [&]() {              \
+    for (const auto &x : inputs) {                                                            \
+      do_not_optimize(p_op(x));                                                               \
+    }                                                                                         \
+  }) << std::endl;                                                                            \
+}
+
+
+// =================
+// = Random inputs =
+// =================
+
+// The inputs are generated from a fixed seed, so that every run measures the same values.
+
+constexpr const size_t BATCH_SIZE = 256;
+
+
+inline std::mt19937 &random_engine() {
+  static std::mt19937 engine(0x6b6d617468);
+  return engine;
+}
+
+
+inline float random_float(const float min, const float max) {
+  return std::uniform_real_distribution<float>(min, max)(random_engine());
+}
+
+
+inline kmath::Vec3 random_vec3(const float min, const float max) {
+  return kmath::Vec3(random_float(min, max), random_float(min, max), random_float(min, max));
+}
+
+
+template<typename T, typename F>
+std::vector<T> random_inputs(F &&generator) {
+  std::vector<T> inputs;
+  inputs.reserve(BATCH_SIZE);
+  for (size_t i = 0; i < BATCH_SIZE; i++) {
+    inputs.push_back(generator());
+  }
+  return inputs;
+}
@@ -0,0 +1,155 @@
+#include "benchmarking.hpp"
+
+#include "unit_tests/src/csi.hpp"
+#include "benchmarks/src/suites/angles.hpp"
+#include "benchmarks/src/suites/batch.hpp"
+#include "benchmarks/src/suites/colors.hpp"
+#include "benchmarks/src/suites/matrix.hpp"
+#include "benchmarks/src/suites/motor_3d.hpp"
+#include "benchmarks/src/suites/op_counts.hpp"
+#include "benchmarks/src/suites/pga_3d.hpp"
+
+#include <array>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <optional>
+#include <set>
+#include <string_view>
+
+
+using BenchmarkFunctionPtr = void(*)();
+
+struct BenchmarkSection {
+  const std::string_view name;
+  const BenchmarkFunctionPtr function;
+};
+
+
+constexpr const std::array<BenchmarkSection, 7> BENCHMARK_SECTIONS{
+  BenchmarkSection{ .name = "matrix4", .function = &bench_matrix4, },
+  BenchmarkSection{ .name = "mvec3", .function = &bench_mvec3, },
+  BenchmarkSection{ .name = "motor3", .function = &bench_motor3, },
+  BenchmarkSection{ .name = "euler_angles", .function = &bench_euler_angles, },
+  BenchmarkSection{ .name = "color_conversion", .function = &bench_color_conversion, },
+  BenchmarkSection{ .name = "batch", .function = &bench_batch, },
+  BenchmarkSection{ .name = "op_counts", .function = &bench_op_counts, },
+};
+
+
+void help() {
+  std::cout << "Microbenchmarks for the kmath library.\n";
+  std::cout << "\n";
+
+  std::cout << "Usage:\n";
+  std::cout << "\tKMathBench [options] all\t\t\t- run all benchmarks\n";
+  std::cout << "\tKMathBench [options] <benchmark_sections>\t- run every benchmark in the list\n";
+  std::cout << "\n";
+
+  std::cout << "Options:\n";
+  std::cout << "\t--json <file>\t\t- write the results to a JSON file\n";
+  std::cout << "\t--warmup <n>\t\t- number of discarded samples (default: 3)\n";
+  std::cout << "\t--repetitions <n>\t- number of recorded samples (default: 25)\n";
+  std::cout << "\t--sample-us <n>\t\t- minimal duration of a sample in microseconds (default: 2000)\n";
+  std::cout << "\n";
+
+  std::cout << "Environment:\n";
+  std::cout << "\tKMATH_CPU_TIER=<tier>\t- force the tier of the batch section (baseline, sse4.2, avx2, avx512)\n";
+  std::cout << "\n";
+
+  std::cout << "List of benchmark sections:\n";
+  for (const BenchmarkSection &section : BENCHMARK_SECTIONS) {
+    std::cout << "\t" << section.name << "\n";
+  }
+
+  std::flush(std::cout);
+}
+
+
+static std::optional<size_t> parse_count(const char *const arg) {
+  size_t value = 0;
+  const char *const end = arg + std::strlen(arg);
+  const auto [ptr, error] = std::from_chars(arg, end, value);
+  if (error != std::errc() || ptr != end || value == 0) {
+    return std::nullopt;
+  }
+  return value;
+}
+
+
+int main(const int argc, const char *const *const argv) {
+  if (argc <= 1) {
+    help();
+    return EXIT_SUCCESS;
+  }
+
+  Benchmarking::init_singleton();
+  Benchmarking *const benchmarking = Benchmarking::get_singleton();
+
+  const char *json_path = nullptr;
+  bool run_all = false;
+  std::set<std::string_view> selected_sections;
+  for (int i = 1; i < argc; i++) {
+    const std::string_view arg = argv[i];
+    if (arg == "--json" || arg == "--warmup" || arg == "--repetitions" || arg == "--sample-us") {
+      if (i + 1 >= argc) {
+        std::cerr << CSI_RED << "Missing value for " << arg << CSI_CLEAR << std::endl;
+        return EXIT_FAILURE;
+      }
+      const char *const value = argv[++i];
+      if (arg == "--json") {
+        json_path = value;
+        continue;
+      }
+
+      const std::optional<size_t> count = parse_count(value);
+      if (!count.has_value()) {
+        std::cerr << CSI_RED << "Invalid value for " << arg << ": " << value << CSI_CLEAR << std::endl;
+        return EXIT_FAILURE;
+      }
+      if (arg == "--warmup") {
+        benchmarking->warmup = *count;
+      } else if (arg == "--repetitions") {
+        benchmarking->repetitions = *count;
+      } else {
+        benchmarking->sample_duration = std::chrono::microseconds(*count);
+      }
+    } else if (arg == "all") {
+      run_all = true;
+    } else {
+      selected_sections.emplace(arg);
+    }
+  }
+
+  for (const BenchmarkSection &section : BENCHMARK_SECTIONS) {
+    if (run_all || selected_sections.contains(section.name)) {
+      BENCHMARK_SECTION(section.name, { section.function(); });
+      selected_sections.erase(section.name);
+    }
+  }
+
+  if (!selected_sections.empty()) {
+    std::cerr << CSI_RED << "The following benchmark sections were given but do not exist:\n";
+    for (const std::string_view name : selected_sections) {
+      std::cerr << "\t" << name << "\n";
+    }
+    std::cerr << CSI_CLEAR;
+    std::flush(std::cerr);
+  }
+
+  bool success = true;
+  if (json_path != nullptr) {
+    std::ofstream file(json_path);
+    file << benchmarking->get_json();
+    success = bool(file);
+    if (!success) {
+      std::cerr << CSI_RED << "Could not write " << json_path << CSI_CLEAR << std::endl;
+    }
+  }
+
+  Benchmarking::deinit_singleton();
+  return (success)? EXIT_SUCCESS : EXIT_FAILURE;
+}
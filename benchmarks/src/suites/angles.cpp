@@ -0,0 +1,18 @@
+#include "angles.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/angles.hpp"
+
+
+using namespace kmath;
+
+
+void bench_euler_angles() {
+  const std::vector<Vec3> euler = random_inputs<Vec3>([]() { return random_vec3(-3.0f, 3.0f); });
+  const std::vector<Rotor3> rotors = random_inputs<Rotor3>([]() { return euler_to_rotor(random_vec3(-3.0f, 3.0f)); });
+
+  BENCHMARK("euler_to_rotor YXZ", euler, [](const Vec3 &e) { return euler_to_rotor(e, EulerBasis::YXZ); });
+  BENCHMARK("euler_to_rotor XYZ", euler, [](const Vec3 &e) { return euler_to_rotor(e, EulerBasis::XYZ); });
+  BENCHMARK("euler_to_basis", euler, [](const Vec3 &e) { return euler_to_basis(e); });
+  BENCHMARK("rotor_to_euler", rotors, [](const Rotor3 &r) { return rotor_to_euler(r); });
+}
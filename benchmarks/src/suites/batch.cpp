@@ -0,0 +1,117 @@
+#include "batch.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/batch.hpp"
+
+#include <cstdint>
+#include <string>
+
+
+using namespace kmath;
+
+
+// Batch kernels of the dispatched tier, set KMATH_CPU_TIER to compare tiers
+template<typename F>
+static void bench_kernel(const std::string &name, const size_t ops, F &&body) {
+  const std::string title = name + " [" + cpu_tier_name(cpu_tier()) + "]";
+  std::cout << Benchmarking::get_singleton()->run(title, ops, body) << std::endl;
+}
+
+
+void bench_batch() {
+  const std::vector<Vec3> points = random_inputs<Vec3>([]() { return random_vec3(-10.0f, 10.0f); });
+  const std::vector<Vec4> vectors = random_inputs<Vec4>([]() { return Vec4(random_vec3(-10.0f, 10.0f), 1.0f); });
+  const std::vector<Rgb> colors = random_inputs<Rgb>([]() { return random_vec3(0.0f, 1.0f); });
+  const std::vector<Mat4> transforms = random_inputs<Mat4>([]() {
+    return Mat4::translation(random_vec3(-10.0f, 10.0f)) * Mat4::y_rotation(random_float(-3.0f, 3.0f)) * Mat4::x_rotation(random_float(-3.0f, 3.0f)) * Mat4::scale(Vec4(random_vec3(0.1f, 10.0f), 1.0f));
+  });
+  const Mat4 m = Mat4::from_basis(Mat3::IDENTITY * 2.0f, Vec3(1.0f, -2.0f, 3.0f));
+  const Mat4 projection = Mat4::perspective_rh_no_ndc_vfov(0.5f, 100.0f, 1.2f, 1.5f) * Mat4::translation(Vec3(0.0f, 0.0f, -60.0f));
+  const Motor3 motor = Motor3::from_rotor_translation(Rotor3::from_axis_angle(Vec3(0.0f, 1.0f, 0.0f), 0.5f), Vec3(1.0f, 2.0f, 3.0f));
+  const Frustum3 frustum = Frustum3::from_projection_no_ndc(projection);
+  const std::vector<Sphere3> spheres = random_inputs<Sphere3>([]() { return Sphere3{ .center = random_vec3(-100.0f, 200.0f), .radius = random_float(0.0f, 10.0f) }; });
+  const std::vector<Aabb3> boxes = random_inputs<Aabb3>([]() {
+    const Vec3 min = random_vec3(-100.0f, 200.0f);
+    return Aabb3{ .min = min, .max = min + random_vec3(0.0f, 10.0f) };
+  });
+
+  const auto random_mvec3 = []() {
+    Mvec3 m;
+    for (size_t i = 0; i < 16; i++) {
+      m[i] = random_float(-1.0f, 1.0f);
+    }
+    return m;
+  };
+  const std::vector<Mvec3> mvecs_a = random_inputs<Mvec3>(random_mvec3);
+  const std::vector<Mvec3> mvecs_b = random_inputs<Mvec3>(random_mvec3);
+  const Mvec3 mvec = random_mvec3();
+
+  std::vector<ok::OkLab> labs(BATCH_SIZE);
+  batch::rgb_to_oklab(colors, labs);
+
+  std::vector<Vec3> vec3_result(BATCH_SIZE);
+  std::vector<Vec4> vec4_result(BATCH_SIZE);
+  std::vector<float> scalars(BATCH_SIZE);
+
+  bench_kernel("normalize", BATCH_SIZE, [&]() {
+    batch::normalize(points, vec3_result);
+    do_not_optimize(vec3_result.data());
+  });
+  bench_kernel("length", BATCH_SIZE, [&]() {
+    batch::length(points, scalars);
+    do_not_optimize(scalars.data());
+  });
+  bench_kernel("Mat4 * Vec4", BATCH_SIZE, [&]() {
+    batch::transform(m, vectors, vec4_result);
+    do_not_optimize(vec4_result.data());
+  });
+  bench_kernel("transform_points Motor3", BATCH_SIZE, [&]() {
+    batch::transform_points(motor, points, vec3_result);
+    do_not_optimize(vec3_result.data());
+  });
+  bench_kernel("transform_points Mat4", BATCH_SIZE, [&]() {
+    batch::transform_points(m, points, vec3_result);
+    do_not_optimize(vec3_result.data());
+  });
+  bench_kernel("project_points Mat4", BATCH_SIZE, [&]() {
+    batch::project_points(projection, points, vec3_result);
+    do_not_optimize(vec3_result.data());
+  });
+  BENCHMARK("homogeneous_projection(Mat4 * Vec4) loop", points, [&](const Vec3 &p) { return homogeneous_projection(projection * Vec4(p, 1.0f)); });
+  std::vector<Decomposition3> parts(BATCH_SIZE);
+  bench_kernel("decompose Mat4", BATCH_SIZE, [&]() {
+    batch::decompose(transforms, parts);
+    do_not_optimize(parts.data());
+  });
+  BENCHMARK("decompose(Mat4) loop", transforms, [](const Mat4 &t) { return decompose(t); });
+  std::vector<std::uint64_t> visible((BATCH_SIZE + 63) / 64);
+  bench_kernel("cull_spheres", BATCH_SIZE, [&]() {
+    batch::cull_spheres(frustum, spheres, visible);
+    do_not_optimize(visible.data());
+  });
+  BENCHMARK("is_visible(Frustum3, Sphere3) loop", spheres, [&](const Sphere3 &s) { return is_visible(frustum, s); });
+  bench_kernel("cull_aabbs", BATCH_SIZE, [&]() {
+    batch::cull_aabbs(frustum, boxes, visible);
+    do_not_optimize(visible.data());
+  });
+  BENCHMARK("is_visible(Frustum3, Aabb3) loop", boxes, [&](const Aabb3 &b) { return is_visible(frustum, b); });
+  std::vector<Mvec3> mvec_result(BATCH_SIZE);
+  bench_kernel("geometric_product Mvec3", BATCH_SIZE, [&]() {
+    batch::geometric_product(mvecs_a, mvecs_b, mvec_result);
+    do_not_optimize(mvec_result.data());
+  });
+  BENCHMARK("Mvec3 * Mvec3 loop", mvecs_a, [&](const Mvec3 &m) { return m * mvec; });
+  bench_kernel("inner_product Mvec3", BATCH_SIZE, [&]() {
+    batch::inner_product(mvecs_a, mvecs_b, mvec_result);
+    do_not_optimize(mvec_result.data());
+  });
+  BENCHMARK("Mvec3 || Mvec3 loop", mvecs_a, [&](const Mvec3 &m) { return m || mvec; });
+  bench_kernel("rgb_to_oklab", BATCH_SIZE, [&]() {
+    batch::rgb_to_oklab(colors, vec3_result);
+    do_not_optimize(vec3_result.data());
+  });
+  bench_kernel("oklab_to_rgb", BATCH_SIZE, [&]() {
+    batch::oklab_to_rgb(labs, vec3_result);
+    do_not_optimize(vec3_result.data());
+  });
+}
@@ -0,0 +1,129 @@
+#include "colors.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/color/base.hpp"
+#include "kmath/color/cie.hpp"
+#include "kmath/color/itu.hpp"
+#include "kmath/color/ok.hpp"
+
+
+using namespace kmath;
+
+
+template<typename R, typename T, typename F>
+static std::vector<R> convert_all(const std::vector<T> &inputs, F &&conversion) {
+  std::vector<R> outputs;
+  outputs.reserve(inputs.size());
+  for (const T &x : inputs) {
+    outputs.push_back(conversion(x));
+  }
+  return outputs;
+}
+
+
+#define BENCHMARK_CONVERSION(p_function, p_inputs) BENCHMARK(#p_function, p_inputs, p_function)
+
+
+void bench_color_conversion() {
+  // Every color space is sampled by converting random sRGB colors
+  const std::vector<Rgb> rgb = random_inputs<Rgb>([]() { return random_vec3(0.0f, 1.0f); });
+  const std::vector<Rgba> rgba = random_inputs<Rgba>([]() { return Rgba(random_vec3(0.0f, 1.0f), random_float(0.0f, 1.0f)); });
+  const std::vector<Lrgb> lrgb = convert_all<Lrgb>(rgb, [](const Rgb &c) { return rgb_to_lrgb(c); });
+  const std::vector<RgbU8> rgbu8 = convert_all<RgbU8>(rgb, rgb_to_rgbu8);
+  const std::vector<Hsl> hsl = convert_all<Hsl>(rgb, rgb_to_hsl);
+  const std::vector<Hsv> hsv = convert_all<Hsv>(rgb, rgb_to_hsv);
+  const std::vector<Hwb> hwb = convert_all<Hwb>(rgb, rgb_to_hwb);
+  const std::vector<cie::XYZ> xyz = convert_all<cie::XYZ>(rgb, cie::rgb_to_xyz);
+  const std::vector<cie::xyY> xyy = convert_all<cie::xyY>(rgb, cie::rgb_to_xyy);
+  const std::vector<cie::Lab> lab = convert_all<cie::Lab>(rgb, [](const Rgb &c) { return cie::rgb_to_lab(c); });
+  const std::vector<cie::LChab> lch = convert_all<cie::LChab>(rgb, cie::rgb_to_lchab);
+  const std::vector<ok::OkLab> oklab = convert_all<ok::OkLab>(rgb, ok::rgb_to_oklab);
+  const std::vector<ok::OkHsv> okhsv = convert_all<ok::OkHsv>(rgb, ok::rgb_to_okhsv);
+  const std::vector<ok::OkHsl> okhsl = convert_all<ok::OkHsl>(rgb, ok::rgb_to_okhsl);
+  const std::vector<ok::OkHwb> okhwb = convert_all<ok::OkHwb>(rgb, ok::rgb_to_okhwb);
+  const std::vector<itu::bt_2020::YCbCr> ycbcr = convert_all<itu::bt_2020::YCbCr>(rgb, itu::bt_2020::rgb_to_ycbcr);
+  const std::vector<itu::bt_2020::YcCbcCrc> yccbccrc = convert_all<itu::bt_2020::YcCbcCrc>(rgb, itu::bt_2020::rgb_to_yccbccrc);
+
+  BENCHMARK_CONVERSION(rgb_to_lrgb, rgb);
+  BENCHMARK_CONVERSION(lrgb_to_rgb, lrgb);
+  BENCHMARK_CONVERSION(rgba_to_lrgba, rgba);
+  BENCHMARK_CONVERSION(lrgba_to_rgba, rgba);
+  BENCHMARK_CONVERSION(rgb_to_rgbu8, rgb);
+  BENCHMARK_CONVERSION(rgbu8_to_rgb, rgbu8);
+  BENCHMARK_CONVERSION(rgb_to_hsl, rgb);
+  BENCHMARK_CONVERSION(hsl_to_rgb, hsl);
+  BENCHMARK_CONVERSION(lrgb_to_hsl, lrgb);
+  BENCHMARK_CONVERSION(hsl_to_lrgb, hsl);
+  BENCHMARK_CONVERSION(rgb_to_hsv, rgb);
+  BENCHMARK_CONVERSION(hsv_to_rgb, hsv);
+  BENCHMARK_CONVERSION(lrgb_to_hsv, lrgb);
+  BENCHMARK_CONVERSION(hsv_to_lrgb, hsv);
+  BENCHMARK_CONVERSION(hsv_to_hwb, hsv);
+  BENCHMARK_CONVERSION(hwb_to_hsv, hwb);
+  BENCHMARK_CONVERSION(lrgb_to_hwb, lrgb);
+  BENCHMARK_CONVERSION(hwb_to_lrgb, hwb);
+  BENCHMARK_CONVERSION(rgb_to_hwb, rgb);
+  BENCHMARK_CONVERSION(hwb_to_rgb, hwb);
+
+  BENCHMARK_CONVERSION(cie::lrgb_to_xyz, lrgb);
+  BENCHMARK_CONVERSION(cie::xyz_to_lrgb, xyz);
+  BENCHMARK_CONVERSION(cie::rgb_to_xyz, rgb);
+  BENCHMARK_CONVERSION(cie::xyz_to_rgb, xyz);
+  BENCHMARK_CONVERSION(cie::xyz_to_xyy, xyz);
+  BENCHMARK_CONVERSION(cie::xyy_to_xyz, xyy);
+  BENCHMARK_CONVERSION(cie::lrgb_to_xyy, lrgb);
+  BENCHMARK_CONVERSION(cie::xyy_to_lrgb, xyy);
+  BENCHMARK_CONVERSION(cie::rgb_to_xyy, rgb);
+  BENCHMARK_CONVERSION(cie::xyy_to_rgb, xyy);
+  BENCHMARK_CONVERSION(cie::xyz_to_xy, xyz);
+  BENCHMARK_CONVERSION(cie::lrgb_to_xy, lrgb);
+  BENCHMARK_CONVERSION(cie::rgb_to_xy, rgb);
+  BENCHMARK_CONVERSION(cie::xyz_to_lab, xyz);
+  BENCHMARK_CONVERSION(cie::lab_to_xyz, lab);
+  BENCHMARK_CONVERSION(cie::lrgb_to_lab, lrgb);
+  BENCHMARK_CONVERSION(cie::lab_to_lrgb, lab);
+  BENCHMARK_CONVERSION(cie::rgb_to_lab, rgb);
+  BENCHMARK_CONVERSION(cie::lab_to_rgb, lab);
+  BENCHMARK_CONVERSION(cie::lab_to_lchab, lab);
+  BENCHMARK_CONVERSION(cie::lchab_to_lab, lch);
+  BENCHMARK_CONVERSION(cie::lrgb_to_lchab, lrgb);
+  BENCHMARK_CONVERSION(cie::lchab_to_lrgb, lch);
+  BENCHMARK_CONVERSION(cie::rgb_to_lchab, rgb);
+  BENCHMARK_CONVERSION(cie::lchab_to_rgb, lch);
+
+  BENCHMARK_CONVERSION(ok::xyz_to_oklab, xyz);
+  BENCHMARK_CONVERSION(ok::oklab_to_xyz, oklab);
+  BENCHMARK_CONVERSION(ok::oklab_to_lrgb, oklab);
+  BENCHMARK_CONVERSION(ok::lrgb_to_oklab, lrgb);
+  BENCHMARK_CONVERSION(ok::oklab_to_rgb, oklab);
+  BENCHMARK_CONVERSION(ok::rgb_to_oklab, rgb);
+  BENCHMARK_CONVERSION(ok::okhsv_to_oklab, okhsv);
+  BENCHMARK_CONVERSION(ok::oklab_to_okhsv, oklab);
+  BENCHMARK_CONVERSION(ok::okhsv_to_lrgb, okhsv);
+  BENCHMARK_CONVERSION(ok::lrgb_to_okhsv, lrgb);
+  BENCHMARK_CONVERSION(ok::okhsv_to_rgb, okhsv);
+  BENCHMARK_CONVERSION(ok::rgb_to_okhsv, rgb);
+  BENCHMARK_CONVERSION(ok::okhsl_to_oklab, okhsl);
+  BENCHMARK_CONVERSION(ok::oklab_to_okhsl, oklab);
+  BENCHMARK_CONVERSION(ok::okhsl_to_lrgb, okhsl);
+  BENCHMARK_CONVERSION(ok::lrgb_to_okhsl, lrgb);
+  BENCHMARK_CONVERSION(ok::okhsl_to_rgb, okhsl);
+  BENCHMARK_CONVERSION(ok::rgb_to_okhsl, rgb);
+  BENCHMARK_CONVERSION(ok::okhwb_to_okhsv, okhwb);
+  BENCHMARK_CONVERSION(ok::okhsv_to_okhwb, okhsv);
+  BENCHMARK_CONVERSION(ok::okhwb_to_lrgb, okhwb);
+  BENCHMARK_CONVERSION(ok::lrgb_to_okhwb, lrgb);
+  BENCHMARK_CONVERSION(ok::okhwb_to_rgb, okhwb);
+  BENCHMARK_CONVERSION(ok::rgb_to_okhwb, rgb);
+  BENCHMARK_CONVERSION(ok::okhwb_to_oklab, okhwb);
+  BENCHMARK_CONVERSION(ok::oklab_to_okhwb, oklab);
+
+  BENCHMARK_CONVERSION(itu::bt_2020::ycbcr_to_lrgb, ycbcr);
+  BENCHMARK_CONVERSION(itu::bt_2020::lrgb_to_ycbcr, lrgb);
+  BENCHMARK_CONVERSION(itu::bt_2020::ycbcr_to_rgb, ycbcr);
+  BENCHMARK_CONVERSION(itu::bt_2020::rgb_to_ycbcr, rgb);
+  BENCHMARK_CONVERSION(itu::bt_2020::yccbccrc_to_lrgb, yccbccrc);
+  BENCHMARK_CONVERSION(itu::bt_2020::lrgb_to_yccbccrc, lrgb);
+  BENCHMARK_CONVERSION(itu::bt_2020::yccbccrc_to_rgb, yccbccrc);
+  BENCHMARK_CONVERSION(itu::bt_2020::rgb_to_yccbccrc, rgb);
+}
@@ -0,0 +1,104 @@
+#include "matrix.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/matrix.hpp"
+#include "kmath/affine_3d.hpp"
+#include "kmath/matrix_array.hpp"
+#include "kmath/matrix_n.hpp"
+
+
+using namespace kmath;
+
+
+// Sizes of the systems of screw and motor Jacobians
+using Mat6 = MatN<6, 6>;
+using Mat12 = MatN<12, 12>;
+using Mat12x6 = MatN<12, 6>;
+
+
+template<size_t R, size_t C>
+static MatN<R, C> random_matn() {
+  MatN<R, C> m;
+  for (size_t j = 0; j < C; j++) {
+    for (size_t i = 0; i < R; i++) {
+      m(i, j) = random_float(-1.0f, 1.0f);
+    }
+  }
+  return m;
+}
+
+
+static Mat4 random_transform() {
+  const Vec3 x = random_vec3(-1.0f, 1.0f);
+  const Vec3 y = random_vec3(-1.0f, 1.0f);
+  const Vec3 z = random_vec3(-1.0f, 1.0f) + Vec3(0.0f, 0.0f, 2.0f);
+  const Vec3 t = random_vec3(-10.0f, 10.0f);
+  return Mat4(Vec4(x.x, x.y, x.z, 0.0f), Vec4(y.x, y.y, y.z, 0.0f), Vec4(z.x, z.y, z.z, 0.0f), Vec4(t.x, t.y, t.z, 1.0f));
+}
+
+
+void bench_matrix4() {
+  const std::vector<Mat4> a = random_inputs<Mat4>(random_transform);
+  const Mat4 b = random_transform();
+  const std::vector<Vec4> v = random_inputs<Vec4>([]() { return Vec4(random_vec3(-10.0f, 10.0f), 1.0f); });
+
+  BENCHMARK("Mat4 * Mat4", a, [&](const Mat4 &m) { return m * b; });
+  BENCHMARK("Mat4 * Vec4", v, [&](const Vec4 &p) { return b * p; });
+  BENCHMARK("inverse(Mat4)", a, [](const Mat4 &m) { return inverse(m); });
+  BENCHMARK("transpose(Mat4)", a, [](const Mat4 &m) { return transpose(m); });
+
+  std::vector<Affine3> affines;
+  for (const Mat4 &m: a) {
+    affines.push_back(Affine3::from_mat4(m));
+  }
+  const Affine3 c = Affine3::from_mat4(b);
+  const std::vector<Vec3> points = random_inputs<Vec3>([]() { return random_vec3(-10.0f, 10.0f); });
+
+  BENCHMARK("Affine3 * Affine3", affines, [&](const Affine3 &t) { return t * c; });
+  BENCHMARK("transform_point(Affine3)", points, [&](const Vec3 &p) { return transform_point(p, c); });
+  BENCHMARK("affine_inverse(Affine3)", affines, [](const Affine3 &t) { return affine_inverse(t); });
+
+  // SoA batches, one matrix per pack lane
+  const Mat4Array soa(a);
+  Mat4Array result;
+  std::cout << Benchmarking::get_singleton()->run("multiply(Mat4Array)", soa.size(), [&]() {
+    multiply(soa, soa, result);
+    do_not_optimize(result.column(0).component(0));
+  }) << std::endl;
+  std::cout << Benchmarking::get_singleton()->run("inverse(Mat4Array)", soa.size(), [&]() {
+    inverse(soa, result);
+    do_not_optimize(result.column(0).component(0));
+  }) << std::endl;
+
+  // Fixed size solves, one system per element
+  const std::vector<Mat6> systems6 = random_inputs<Mat6>(random_matn<6, 6>);
+  const std::vector<Mat12> systems12 = random_inputs<Mat12>([]() {
+    // Symmetric positive definite
+    const Mat12 m = random_matn<12, 12>();
+    return transpose(m) * m + Mat12::IDENTITY;
+  });
+  const std::vector<Mat12x6> jacobians = random_inputs<Mat12x6>(random_matn<12, 6>);
+  const VecN<6> b6 = random_matn<6, 1>();
+  const VecN<12> b12 = random_matn<12, 1>();
+
+  BENCHMARK("LU solve MatN<6, 6>", systems6, [&](Mat6 lu) {
+    _LUPivots<6> pivots;
+    VecN<6> x = b6;
+    lu_decompose(lu, pivots);
+    lu_solve(lu, pivots, x);
+    return x;
+  });
+  BENCHMARK("Cholesky solve MatN<12, 12>", systems12, [&](Mat12 l) {
+    VecN<12> x = b12;
+    cholesky_decompose(l);
+    cholesky_solve(l, x);
+    return x;
+  });
+  BENCHMARK("QR least squares MatN<12, 6>", jacobians, [&](Mat12x6 qr) {
+    VecN<6> tau;
+    VecN<12> x = b12;
+    qr_decompose(qr, tau);
+    qr_solve(qr, tau, x);
+    return x;
+  });
+}
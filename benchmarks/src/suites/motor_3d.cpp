@@ -0,0 +1,73 @@
+#include "motor_3d.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/motor_3d.hpp"
+#include "kmath/similarity_3d.hpp"
+#include "kmath/transform_hierarchy.hpp"
+
+
+using namespace kmath;
+
+
+static Motor3 random_motor() {
+  const Vec3 axis = normalized(random_vec3(-1.0f, 1.0f));
+  return Motor3::from_axis_angle_translation(axis, random_float(-3.0f, 3.0f), random_vec3(-10.0f, 10.0f));
+}
+
+
+void bench_motor3() {
+  const std::vector<Motor3> a = random_inputs<Motor3>(random_motor);
+  const Motor3 b = random_motor();
+  const std::vector<Vec3> points = random_inputs<Vec3>([]() { return random_vec3(-10.0f, 10.0f); });
+
+  BENCHMARK("compose", a, [&](const Motor3 &m) { return m * b; });
+  BENCHMARK("transform_point", points, [&](const Vec3 &p) { return transform_point(p, b); });
+  BENCHMARK("transform_direction", points, [&](const Vec3 &p) { return transform_direction(p, b); });
+  BENCHMARK("sclerp", a, [&](const Motor3 &m) { return sclerp(m, b, 0.3f); });
+  BENCHMARK("normalized", a, [](const Motor3 &m) { return normalized(m); });
+
+  // Uniform scale transforms, against the Mat4 they replace
+  const std::vector<Similarity3> similarities = random_inputs<Similarity3>([]() {
+    return Similarity3(get_rotor(random_motor()), random_vec3(-10.0f, 10.0f), random_float(0.1f, 10.0f));
+  });
+  std::vector<Mat4> matrices;
+  for (const Similarity3 &x: similarities) {
+    matrices.push_back(as_transform(x));
+  }
+  const Similarity3 s = similarities[0];
+  const Mat4 s_matrix = as_transform(s);
+  BENCHMARK("Similarity3 compose", similarities, [&](const Similarity3 &x) { return x * s; });
+  BENCHMARK("Mat4 compose", matrices, [&](const Mat4 &x) { return x * s_matrix; });
+  BENCHMARK("Similarity3 inverse", similarities, [](const Similarity3 &x) { return inverse(x); });
+  BENCHMARK("Mat4 inverse", matrices, [](const Mat4 &x) { return inverse(x); });
+  BENCHMARK("Similarity3 transform_point", points, [&](const Vec3 &p) { return transform_point(p, s); });
+
+  // 100k nodes in a tree of 4 children per node, 5% of them change every frame. The ops are the
+  // nodes of the hierarchy.
+  constexpr const size_t NODES = 100000;
+  MotorHierarchy3 hierarchy;
+  hierarchy.reserve(NODES);
+  for (size_t i = 0; i < NODES; i++) {
+    hierarchy.add(random_motor(), (i == 0)? MotorHierarchy3::NO_PARENT : (i - 1) / 4);
+  }
+  hierarchy.update();
+
+  size_t frame = 0;
+  Benchmarking *benchmarking = Benchmarking::get_singleton();
+  std::cout << benchmarking->run("hierarchy update 5% dirty", NODES, [&]() {
+    frame++;
+    for (size_t i = frame % 20; i < NODES; i += 20) {
+      hierarchy.set_local(i, a[i % a.size()]);
+    }
+    do_not_optimize(hierarchy.update());
+  }) << std::endl;
+
+  std::vector<Motor3> worlds(NODES);
+  std::cout << benchmarking->run("hierarchy full rebuild", NODES, [&]() {
+    worlds[0] = hierarchy.local(0);
+    for (size_t i = 1; i < NODES; i++) {
+      worlds[i] = worlds[hierarchy.parent(i)] * hierarchy.local(i);
+    }
+    do_not_optimize(worlds.data());
+  }) << std::endl;
+}
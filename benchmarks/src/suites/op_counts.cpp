@@ -0,0 +1,59 @@
+#include "op_counts.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/instrument.hpp"
+#include "kmath/matrix.hpp"
+#include "kmath/motor_2d.hpp"
+#include "kmath/motor_3d.hpp"
+#include "kmath/pga_3d.hpp"
+#include "kmath/similarity_3d.hpp"
+
+#include <iostream>
+
+
+using namespace kmath;
+using C = instrument::Counted<float>;
+
+
+// Not timed: exact operation counts of the kernels, see instrument.hpp. The budgets of the
+// op_counts unit tests fail when they increase.
+void bench_op_counts() {
+  const _Motor3<C> a = _Motor3<C>::from_rotor_translation(
+    _Rotor3<C>::from_axis_angle(normalized(_Vec3<C>(1.0f, 2.0f, -1.0f)), C(0.7f)),
+    _Vec3<C>(1.0f, 2.0f, 3.0f)
+  );
+  const _Motor3<C> b = _Motor3<C>::from_rotor_translation(
+    _Rotor3<C>::from_axis_angle(_Vec3<C>(0.0f, 1.0f, 0.0f), C(1.1f)),
+    _Vec3<C>(-1.0f, 0.0f, 2.0f)
+  );
+  const _Rotor3<C> r = get_rotor(a);
+  const _Vec3<C> p(1.0f, 2.0f, 3.0f);
+  const _Line3<C> line(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f);
+  const _Mvec3<C> u = _Mvec3<C>::e12 + _Mvec3<C>::e0 * C(2.0f);
+  const _Mvec3<C> v = _Mvec3<C>::e123 - _Mvec3<C>::e1;
+  const _Similarity3<C> s(r, p, C(2.0f));
+  const _Mat4<C> m = as_transform(a);
+  const _Motor2<C> a2 = _Motor2<C>::from_angle_translation(C(0.7f), _Vec2<C>(1.0f, 2.0f));
+  const _Motor2<C> b2 = _Motor2<C>::from_angle_translation(C(1.1f), _Vec2<C>(-1.0f, 0.0f));
+
+  const auto report = [](const std::string_view name, const auto &kernel) {
+    instrument::report(std::cout, name, instrument::count_ops(kernel));
+  };
+  report("Rotor3 * Rotor3", [&]() { return r * r; });
+  report("transform(Vec3, Rotor3)", [&]() { return transform(p, r); });
+  report("Motor3 * Motor3", [&]() { return a * b; });
+  report("transform_point(Vec3, Motor3)", [&]() { return transform_point(p, a); });
+  report("transform(Line3, Motor3)", [&]() { return transform(line, a); });
+  report("normalized(Motor3)", [&]() { return normalized(a); });
+  report("sclerp", [&]() { return sclerp(a, b, C(0.3f)); });
+  report("Motor2 * Motor2", [&]() { return a2 * b2; });
+  report("transform_point(Vec2, Motor2)", [&]() { return transform_point(p.xy(), a2); });
+  report("sclerp(Motor2)", [&]() { return sclerp(a2, b2, C(0.3f)); });
+  report("Mvec3 * Mvec3", [&]() { return u * v; });
+  report("Similarity3 * Similarity3", [&]() { return s * s; });
+  report("inverse(Similarity3)", [&]() { return inverse(s); });
+  report("Mat4 * Vec4", [&]() { return m * _Vec4<C>(p, 1.0f); });
+  report("Mat4 * Mat4", [&]() { return m * m; });
+  report("inverse(Mat4)", [&]() { return inverse(m); });
+  std::cout << std::endl;
+}
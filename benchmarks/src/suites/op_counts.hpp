@@ -0,0 +1,4 @@
+#pragma once
+
+
+void bench_op_counts();
@@ -0,0 +1,43 @@
+#include "pga_3d.hpp"
+#include "../benchmarking.hpp"
+
+#include "kmath/graded_mvec_3d.hpp"
+#include "kmath/lazy_mvec_3d.hpp"
+#include "kmath/pga_3d.hpp"
+
+
+using namespace kmath;
+
+
+static Mvec3 random_mvec3() {
+  float values[16];
+  for (float &v : values) {
+    v = random_float(-1.0f, 1.0f);
+  }
+  return Mvec3(values);
+}
+
+
+void bench_mvec3() {
+  const std::vector<Mvec3> a = random_inputs<Mvec3>(random_mvec3);
+  const Mvec3 b = random_mvec3();
+
+  BENCHMARK("geometric product", a, [&](const Mvec3 &m) { return m * b; });
+  BENCHMARK("outer product", a, [&](const Mvec3 &m) { return m & b; });
+  BENCHMARK("regressive product", a, [&](const Mvec3 &m) { return m | b; });
+  BENCHMARK("inner product", a, [&](const Mvec3 &m) { return m || b; });
+  BENCHMARK("sandwich", a, [&](const Mvec3 &m) { return m * b * m.rev(); });
+  BENCHMARK("norm_squared", a, [&](const Mvec3 &m) { return m.norm_squared(); });
+  BENCHMARK("norm_squared of a product lazy", a, [&](const Mvec3 &m) { return (lazy::expr(m) * b).norm_squared(); });
+
+  // Projection of points on a plane, dense and graded
+  const std::vector<Vec3> positions = random_inputs<Vec3>([]() { return random_vec3(-10.0f, 10.0f); });
+  const Mvec3 plane = Mvec3::plane(1.0f, 2.0f, -2.0f, 3.0f);
+  const Mvec3Vector graded_plane(plane);
+  BENCHMARK("project on plane", positions, [&](const Vec3 &p) { return ((plane || Mvec3::point(p)) * plane).grade(3); });
+  BENCHMARK("project on plane lazy", positions, [&](const Vec3 &p) { return ((lazy::expr(plane) || Mvec3::point(p)) * plane).grade(3); });
+  BENCHMARK("project on plane graded", positions, [&](const Vec3 &p) { return geometric_product<MVEC3_GRADES<3>>(graded_plane || Mvec3Trivector::point(p), graded_plane); });
+  const std::vector<Mvec3Even> motors = random_inputs<Mvec3Even>([]() { return Mvec3Even(random_mvec3()); });
+  const Mvec3Even motor(b);
+  BENCHMARK("motor product graded", motors, [&](const Mvec3Even &m) { return m * motor; });
+}
@@ -21,6 +21,7 @@
 
 #include "pga.hpp"
 #include "kmath/constants.hpp"
+#include "kmath/graded_mvec_3d.hpp"
 #include "raylib.h"
 
 
@@ -28,11 +29,12 @@ using namespace kmath;
 
 
 void draw_plane(const Vec3 &p_next_to, const Mvec3 &p_plane, const Color &p_color) {
-  Mvec3 pos = Mvec3::point(p_next_to);
-  pos = ((p_plane || pos) * p_plane).grade(3).point_normalize(); // Project point on the plane
+  const Mvec3Vector plane(p_plane);
+  // Project point on the plane, only the point part of the product is computed
+  const Mvec3Trivector pos = geometric_product<MVEC3_GRADES<3>>(plane || Mvec3Trivector::point(p_next_to), plane).point_normalize();
 
-  Mvec3 default_plane = Mvec3::plane(0.0, 1.0, 0.0, 0.0);
-  Mvec3 rotation_axis = (p_plane.plane_normalize() & default_plane.plane_normalize()).grade(2);
+  const Mvec3Vector default_plane = Mvec3Vector::plane(0.0f, 1.0f, 0.0f, 0.0f);
+  Mvec3Bivector rotation_axis = plane.plane_normalize() & default_plane.plane_normalize();
   float rotation_angle = std::acos(rotation_axis.norm());
   rotation_axis = rotation_axis.line_normalize();
 
@@ -46,7 +48,7 @@ void draw_plane(const Vec3 &p_next_to, const Mvec3 &p_plane, const Color &p_colo
     rotation_axis[Mvec3::Basis::e31],
     rotation_axis[Mvec3::Basis::e12]
   );
-  float scale = p_plane.norm();
+  float scale = plane.norm();
   
   Mesh p = GenMeshPlane(1.0, 1.0, 1, 1);
   Model m = LoadModelFromMesh(p);
@@ -61,16 +63,19 @@ void draw_plane(const Vec3 &p_next_to, const Mvec3 &p_plane, const Color &p_colo
   );
 
   UnloadModel(m);
-  draw_line(p_next_to, rotation_axis, p_color);
+  draw_line(p_next_to, as_mvec(rotation_axis), p_color);
 }
 
 
 void draw_line(const Vec3 &p_next_to, const Mvec3 &p_line, const Color &p_color) {
-  Mvec3 pos = Mvec3::point(p_next_to);
-  pos = ((pos || p_line) * p_line).grade(3).point_normalize(); // Project point on the line
+  const Mvec3Bivector line(p_line);
+  // Project point on the line
+  const Mvec3Trivector pos = geometric_product<MVEC3_GRADES<3>>(Mvec3Trivector::point(p_next_to) || line, line).point_normalize();
 
-  Mvec3 dir = -Mvec3::e0 * p_line;
-  Mvec3 tip = (pos + dir).grade(3);
+  // e0 * line, the direction of the line
+  const Mvec3Vector e0 = Mvec3Vector::plane(0.0f, 0.0f, 0.0f, -1.0f);
+  const Mvec3Trivector dir = -geometric_product<MVEC3_GRADES<3>>(e0, line);
+  const Mvec3Trivector tip = pos + dir;
 
   DrawLine3D(
     Vector3(
@@ -96,7 +101,8 @@ void draw_line(const Vec3 &p_next_to, const Mvec3 &p_line, const Color &p_color)
 }
 
 void draw_point(const Mvec3 &p_point, const Color &p_color) {
-  Mvec3 normalized = p_point / p_point.norm();
+  const Mvec3Trivector point(p_point);
+  const Mvec3Trivector normalized = point / point.norm();
 
   DrawPoint3D(
     Vector3(
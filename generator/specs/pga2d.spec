@@ -0,0 +1,18 @@
+# 2D projective geometric algebra, the types of euclidian_flat_2d.hpp and motor_2d.hpp
+algebra 2 0 1
+
+type Line2 e1 e2 e0
+type Point2 e20 e01 e12
+type Motor2 s e12 e01 e02
+
+product _pga2_motor_product geometric Motor2 Motor2 Motor2
+product _pga2_line_product geometric Line2 Line2 Motor2
+product _pga2_point_product geometric Point2 Point2 Motor2
+product _pga2_meet outer Line2 Line2 Point2
+product _pga2_join regressive Point2 Point2 Line2
+product _pga2_inner inner Line2 Point2 Line2
+
+sandwich _pga2_transform_line Motor2 Line2 Line2
+sandwich _pga2_transform_point Motor2 Point2 Point2
+sandwich _pga2_reflect_line Line2 Line2 Line2
+sandwich _pga2_reflect_point Line2 Point2 Point2
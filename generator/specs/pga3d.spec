@@ -0,0 +1,17 @@
+# 3D projective geometric algebra, the types of euclidian_flat_3d.hpp and motor_3d.hpp
+algebra 3 0 1
+
+type Plane3 e1 e2 e3 e0
+type Line3 e23 e31 e12 e01 e02 e03
+type Point3 e032 e013 e021 e123
+type Motor3 s e23 e31 e12 e0123 e01 e02 e03
+
+product _pga3_motor_product geometric Motor3 Motor3 Motor3
+product _pga3_meet outer Plane3 Plane3 Line3
+product _pga3_meet_line outer Plane3 Line3 Point3
+product _pga3_join regressive Point3 Point3 Line3
+product _pga3_join_point regressive Line3 Point3 Plane3
+
+sandwich _pga3_transform_plane Motor3 Plane3 Plane3
+sandwich _pga3_transform_line Motor3 Line3 Line3
+sandwich _pga3_transform_point Motor3 Point3 Point3
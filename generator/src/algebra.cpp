@@ -0,0 +1,142 @@
+#include "algebra.hpp"
+
+#include <bit>
+#include <cstdlib>
+
+
+namespace generator {
+  // Swaps sorting the vectors of a then b in increasing order
+  static unsigned reorder_swaps(const unsigned a, const unsigned b) {
+    unsigned swaps = 0;
+    for (unsigned v = a >> 1; v != 0; v >>= 1) {
+      swaps += unsigned(std::popcount(v & b));
+    }
+    return swaps;
+  }
+
+
+  Algebra::Algebra(const Signature &p_signature): signature(p_signature) {
+    if (dimension() == 0 || dimension() > 9) {
+      // Vectors are named with a single digit
+      std::abort();
+    }
+  }
+
+
+  size_t Algebra::dimension() const {
+    return signature.p + signature.q + signature.r;
+  }
+
+
+  unsigned Algebra::pseudoscalar() const {
+    return (1u << dimension()) - 1u;
+  }
+
+
+  int Algebra::square(const size_t vector) const {
+    if (vector < signature.r) return 0;
+    return (vector < signature.r + signature.p)? 1 : -1;
+  }
+
+
+  unsigned Algebra::grade(const unsigned blade) {
+    return unsigned(std::popcount(blade));
+  }
+
+
+  std::string Algebra::blade_name(const unsigned blade) const {
+    if (blade == 0) return "s";
+    std::string name = "e";
+    for (size_t vector = 0; vector < dimension(); vector++) {
+      if (blade & (1u << vector)) name += std::to_string((signature.r > 0)? vector : vector + 1);
+    }
+    return name;
+  }
+
+
+  bool Algebra::parse_blade(const std::string &name, unsigned &r_blade, int &r_sign) const {
+    if (name == "s") {
+      r_blade = 0;
+      r_sign = 1;
+      return true;
+    }
+    if (name.size() < 2 || name[0] != 'e') return false;
+
+    const unsigned first = (signature.r > 0)? 0 : 1;
+    unsigned blade = 0;
+    int sign = 1;
+    for (size_t i = 1; i < name.size(); i++) {
+      if (name[i] < '0' || name[i] > '9') return false;
+      const unsigned digit = unsigned(name[i] - '0');
+      if (digit < first || digit - first >= dimension()) return false;
+      const unsigned vector = 1u << (digit - first);
+      if (blade & vector) return false;
+      // Moving the vector to its place among the previous ones
+      if (std::popcount(blade & ~(vector - 1u)) % 2 == 1) sign = -sign;
+      blade |= vector;
+    }
+    r_blade = blade;
+    r_sign = sign;
+    return true;
+  }
+
+
+  BladeProduct Algebra::product(const Product product, const unsigned a, const unsigned b) const {
+    switch (product) {
+    case Product::GEOMETRIC:
+      return _geometric(a, b);
+    case Product::OUTER:
+      return _outer(a, b);
+    case Product::REGRESSIVE: {
+      const BladeProduct ca = _complement(a);
+      const BladeProduct cb = _complement(b);
+      const BladeProduct outer = _outer(ca.blade, cb.blade);
+      if (outer.sign == 0) return { 0, 0 };
+      const BladeProduct result = _uncomplement(outer.blade);
+      return { ca.sign * cb.sign * outer.sign * result.sign, result.blade };
+    }
+    case Product::INNER: {
+      const BladeProduct result = _geometric(a, b);
+      const unsigned ga = grade(a);
+      const unsigned gb = grade(b);
+      if (result.sign == 0 || grade(result.blade) != ((ga > gb)? ga - gb : gb - ga)) return { 0, 0 };
+      return result;
+    }
+    }
+    return { 0, 0 };
+  }
+
+
+  int Algebra::reverse_sign(const unsigned blade) {
+    const unsigned g = grade(blade);
+    return ((g / 2) % 2 == 0)? 1 : -1;
+  }
+
+
+  BladeProduct Algebra::_geometric(const unsigned a, const unsigned b) const {
+    int sign = (reorder_swaps(a, b) % 2 == 0)? 1 : -1;
+    for (size_t v = 0; v < dimension(); v++) {
+      if ((a & b) >> v & 1u) sign *= square(v);
+    }
+    return { sign, a ^ b };
+  }
+
+
+  BladeProduct Algebra::_outer(const unsigned a, const unsigned b) const {
+    if (a & b) return { 0, 0 };
+    return { (reorder_swaps(a, b) % 2 == 0)? 1 : -1, a | b };
+  }
+
+
+  BladeProduct Algebra::_complement(const unsigned blade) const {
+    const unsigned complement = pseudoscalar() ^ blade;
+    return { reverse_sign(blade) * ((reorder_swaps(blade, complement) % 2 == 0)? 1 : -1), complement };
+  }
+
+
+  BladeProduct Algebra::_uncomplement(const unsigned blade) const {
+    // complement(x) = sign * blade, with x the other vectors
+    const unsigned x = pseudoscalar() ^ blade;
+    return { _complement(x).sign, x };
+  }
+}
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+
+
+// Clifford algebra R(p, q, r): r basis vectors squaring to 0, then p squaring to 1, then q squaring
+// to -1. Vectors are numbered from e0 when the algebra is degenerate (e0 is the projective vector
+// of PGA) and from e1 otherwise, so that R(3, 0, 1) has e0, e1, e2, e3 and R(4, 1, 0) has e1 to
+// e5, e5 squaring to -1.
+//
+// Blades are bitmasks of their vectors, bit i being the vector i, in increasing order (e31 is the
+// blade 0b1010 with a sign of -1).
+namespace generator {
+  struct Signature {
+    unsigned p;
+    unsigned q;
+    unsigned r;
+  };
+
+
+  // Product of two blades: sign * blade, sign is 0 when the product is zero
+  struct BladeProduct {
+    int sign;
+    unsigned blade;
+  };
+
+
+  enum class Product {
+    GEOMETRIC,
+    OUTER,
+    REGRESSIVE,
+    INNER,
+  };
+
+
+  class Algebra {
+  public:
+    explicit Algebra(const Signature &signature);
+
+    size_t dimension() const;
+    unsigned pseudoscalar() const;
+    int square(const size_t vector) const;
+    static unsigned grade(const unsigned blade);
+
+    // Name of a blade in increasing order, "s" for the scalar and "e0" for the vector 0 of a
+    // degenerate algebra
+    std::string blade_name(const unsigned blade) const;
+
+    // Parses "s" (the scalar) or "e" followed by one digit per vector, in any order. Returns false
+    // when the name is not a blade of the algebra.
+    bool parse_blade(const std::string &name, unsigned &r_blade, int &r_sign) const;
+
+    BladeProduct product(const Product product, const unsigned a, const unsigned b) const;
+
+    // Sign of the reverse of a blade, (-1)^(g (g - 1) / 2)
+    static int reverse_sign(const unsigned blade);
+
+  private:
+    BladeProduct _geometric(const unsigned a, const unsigned b) const;
+    BladeProduct _outer(const unsigned a, const unsigned b) const;
+    // Complement of the reverse: ~blade ^ complement(blade) = pseudoscalar, the dual ~x * I with a
+    // euclidean metric. It does not use the metric, so that the regressive product is defined in
+    // degenerate algebras, and gives the join of kmath (pga_3d.hpp) in R(3, 0, 1).
+    BladeProduct _complement(const unsigned blade) const;
+    BladeProduct _uncomplement(const unsigned blade) const;
+
+  private:
+    Signature signature;
+  };
+}
@@ -0,0 +1,371 @@
+#include "kernel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <utility>
+
+
+namespace generator {
+  // ===============
+  // = Polynomials =
+  // ===============
+
+
+  static void add_term(Polynomial &r_polynomial, const Monomial &monomial, const long coefficient) {
+    const long sum = (r_polynomial[monomial] += coefficient);
+    if (sum == 0) {
+      r_polynomial.erase(monomial);
+    }
+  }
+
+
+  static Polynomial multiply(const Polynomial &a, const Polynomial &b, const long factor) {
+    Polynomial result;
+    for (const auto &[ma, ca]: a) {
+      for (const auto &[mb, cb]: b) {
+        Monomial monomial;
+        std::merge(ma.begin(), ma.end(), mb.begin(), mb.end(), std::back_inserter(monomial));
+        add_term(result, monomial, factor * ca * cb);
+      }
+    }
+    return result;
+  }
+
+
+  Multivector operand(const BladeType &type, const unsigned operand) {
+    Multivector result;
+    for (unsigned i = 0; i < type.fields.size(); i++) {
+      add_term(result[type.fields[i].blade], { operand * VARIABLES_PER_OPERAND + i }, type.fields[i].sign);
+    }
+    return result;
+  }
+
+
+  Multivector product(const Algebra &algebra, const Product product, const Multivector &a, const Multivector &b) {
+    Multivector result;
+    for (const auto &[blade_a, pa]: a) {
+      for (const auto &[blade_b, pb]: b) {
+        const BladeProduct blade = algebra.product(product, blade_a, blade_b);
+        if (blade.sign == 0) continue;
+        for (const auto &[monomial, coefficient]: multiply(pa, pb, blade.sign)) {
+          add_term(result[blade.blade], monomial, coefficient);
+        }
+      }
+    }
+    std::erase_if(result, [](const auto &blade) { return blade.second.empty(); });
+    return result;
+  }
+
+
+  Multivector reverse(const Multivector &a) {
+    Multivector result = a;
+    for (auto &[blade, polynomial]: result) {
+      for (auto &[monomial, coefficient]: polynomial) {
+        coefficient *= Algebra::reverse_sign(blade);
+      }
+    }
+    return result;
+  }
+
+
+  // ===============
+  // = Expressions =
+  // ===============
+
+
+  static ExpressionPtr variable(const unsigned index) {
+    // Variables of the operand 2 are the temporaries of a staged kernel
+    if (index / VARIABLES_PER_OPERAND == 2) {
+      return std::make_shared<const Expression>(Expression{ .kind = Expression::Kind::TEMPORARY, .index = index % VARIABLES_PER_OPERAND });
+    }
+    return std::make_shared<const Expression>(Expression{ .kind = Expression::Kind::VARIABLE, .index = index });
+  }
+
+
+  static ExpressionPtr temporary(const unsigned index) {
+    return std::make_shared<const Expression>(Expression{ .kind = Expression::Kind::TEMPORARY, .index = index });
+  }
+
+
+  static ExpressionPtr multiply(const ExpressionPtr &a, const ExpressionPtr &b) {
+    return std::make_shared<const Expression>(Expression{ .kind = Expression::Kind::PRODUCT, .operands = { a, b } });
+  }
+
+
+  static ExpressionPtr monomial_expression(const Monomial &monomial) {
+    ExpressionPtr result = variable(monomial[0]);
+    for (size_t i = 1; i < monomial.size(); i++) {
+      result = multiply(result, variable(monomial[i]));
+    }
+    return result;
+  }
+
+
+  // Sum of coefficient * expression, the terms sharing a factor other than 1 are added before being
+  // scaled: 2 a - 2 b + c is computed as c + 2 (a - b). Returns nullptr for an empty sum (zero).
+  static ExpressionPtr linear_combination(const std::vector<std::pair<long, ExpressionPtr>> &terms) {
+    std::map<long, std::vector<std::pair<int, ExpressionPtr>>> groups;
+    for (const auto &[coefficient, expression]: terms) {
+      groups[std::abs(coefficient)].push_back({ (coefficient > 0)? 1 : -1, expression });
+    }
+
+    std::vector<std::pair<int, ExpressionPtr>> parts;
+    for (auto &[factor, group]: groups) {
+      std::stable_partition(group.begin(), group.end(), [](const auto &term) { return term.first > 0; });
+      if (factor == 1) {
+        parts.insert(parts.end(), group.begin(), group.end());
+        continue;
+      }
+
+      // A group of negative terms is negated as a whole
+      const int sign = group[0].first;
+      ExpressionPtr sum = group[0].second;
+      if (group.size() > 1) {
+        Expression expression{ .kind = Expression::Kind::SUM };
+        for (const auto &[term_sign, term]: group) {
+          expression.operands.push_back(term);
+          expression.signs.push_back(term_sign * sign);
+        }
+        sum = std::make_shared<const Expression>(std::move(expression));
+      }
+      parts.push_back({ sign, std::make_shared<const Expression>(Expression{ .kind = Expression::Kind::SCALE, .factor = factor, .operands = { sum } }) });
+    }
+    std::stable_partition(parts.begin(), parts.end(), [](const auto &part) { return part.first > 0; });
+
+    if (parts.empty()) return nullptr;
+    if (parts.size() == 1 && parts[0].first > 0) return parts[0].second;
+    Expression expression{ .kind = Expression::Kind::SUM };
+    for (const auto &[sign, part]: parts) {
+      expression.operands.push_back(part);
+      expression.signs.push_back(sign);
+    }
+    return std::make_shared<const Expression>(std::move(expression));
+  }
+
+
+  static ExpressionPtr expanded_expression(const Polynomial &polynomial) {
+    std::vector<std::pair<long, ExpressionPtr>> terms;
+    for (const auto &[monomial, coefficient]: polynomial) {
+      terms.push_back({ coefficient, monomial_expression(monomial) });
+    }
+    return linear_combination(terms);
+  }
+
+
+  // ===========
+  // = Kernels =
+  // ===========
+
+
+  static void count(const ExpressionPtr &expression, size_t &r_multiplications, size_t &r_additions) {
+    if (expression == nullptr) return;
+    switch (expression->kind) {
+    case Expression::Kind::VARIABLE:
+    case Expression::Kind::TEMPORARY:
+      return;
+    case Expression::Kind::PRODUCT:
+      r_multiplications += expression->operands.size() - 1;
+      break;
+    case Expression::Kind::SCALE:
+      r_multiplications += 1;
+      break;
+    case Expression::Kind::SUM:
+      r_additions += expression->operands.size() - 1;
+      // A leading negation
+      r_additions += std::all_of(expression->signs.begin(), expression->signs.end(), [](const int sign) { return sign < 0; });
+      break;
+    }
+    for (const ExpressionPtr &operand: expression->operands) {
+      count(operand, r_multiplications, r_additions);
+    }
+  }
+
+
+  size_t Kernel::multiplications() const {
+    size_t multiplications = 0;
+    size_t additions = 0;
+    for (const ExpressionPtr &expression: temporaries) count(expression, multiplications, additions);
+    for (const ExpressionPtr &expression: outputs) count(expression, multiplications, additions);
+    return multiplications;
+  }
+
+
+  size_t Kernel::additions() const {
+    size_t multiplications = 0;
+    size_t additions = 0;
+    for (const ExpressionPtr &expression: temporaries) count(expression, multiplications, additions);
+    for (const ExpressionPtr &expression: outputs) count(expression, multiplications, additions);
+    return additions;
+  }
+
+
+  Kernel expanded_kernel(const std::vector<Polynomial> &outputs) {
+    Kernel kernel;
+    for (const Polynomial &output: outputs) {
+      kernel.outputs.push_back(expanded_expression(output));
+    }
+    return kernel;
+  }
+
+
+  Kernel quadratic_kernel(const std::vector<Polynomial> &outputs) {
+    // Entry (output, x variable) of the matrix, a quadratic polynomial of v
+    std::vector<std::map<unsigned, Polynomial>> entries(outputs.size());
+    for (size_t i = 0; i < outputs.size(); i++) {
+      for (const auto &[monomial, coefficient]: outputs[i]) {
+        Monomial v;
+        unsigned x = 0;
+        for (const unsigned variable: monomial) {
+          if (variable / VARIABLES_PER_OPERAND == 1) {
+            x = variable;
+          } else {
+            v.push_back(variable);
+          }
+        }
+        add_term(entries[i][x], v, coefficient);
+      }
+    }
+
+    // Entries are shared up to their sign, the first coefficient of a canonical entry is positive
+    const auto canonical = [](const Polynomial &entry, int &r_sign) {
+      r_sign = (entry.begin()->second > 0)? 1 : -1;
+      Polynomial result = entry;
+      for (auto &[monomial, coefficient]: result) {
+        coefficient *= r_sign;
+      }
+      return result;
+    };
+    std::map<Monomial, size_t> monomial_uses;
+    std::map<Polynomial, size_t> entry_uses;
+    for (const auto &output: entries) {
+      for (const auto &[x, entry]: output) {
+        // The monomial of an entry of a single term is used by every occurence of the entry
+        int sign;
+        const bool shared = entry_uses[canonical(entry, sign)]++ > 0;
+        if (shared && entry.size() > 1) continue;
+        for (const auto &[monomial, coefficient]: entry) {
+          monomial_uses[monomial]++;
+        }
+      }
+    }
+
+    Kernel kernel;
+    std::map<Monomial, ExpressionPtr> monomials;
+    for (const auto &[monomial, uses]: monomial_uses) {
+      if (uses > 1) {
+        monomials[monomial] = temporary(unsigned(kernel.temporaries.size()));
+        kernel.temporaries.push_back(monomial_expression(monomial));
+      } else {
+        monomials[monomial] = monomial_expression(monomial);
+      }
+    }
+
+    std::map<Polynomial, ExpressionPtr> shared_entries;
+    for (size_t i = 0; i < outputs.size(); i++) {
+      std::vector<std::pair<long, ExpressionPtr>> terms;
+      for (const auto &[x, entry]: entries[i]) {
+        // x * c * monomial
+        if (entry.size() == 1) {
+          terms.push_back({ entry.begin()->second, multiply(variable(x), monomials[entry.begin()->first]) });
+          continue;
+        }
+
+        int sign;
+        const Polynomial key = canonical(entry, sign);
+        ExpressionPtr &expression = shared_entries[key];
+        if (expression == nullptr) {
+          std::vector<std::pair<long, ExpressionPtr>> entry_terms;
+          for (const auto &[monomial, coefficient]: key) {
+            entry_terms.push_back({ coefficient, monomials[monomial] });
+          }
+          expression = linear_combination(entry_terms);
+          if (entry_uses[key] > 1) {
+            kernel.temporaries.push_back(expression);
+            expression = temporary(unsigned(kernel.temporaries.size() - 1));
+          }
+        }
+        terms.push_back({ sign, multiply(variable(x), expression) });
+      }
+      kernel.outputs.push_back(linear_combination(terms));
+    }
+    return kernel;
+  }
+
+
+  Kernel staged_kernel(const std::vector<Polynomial> &temporaries, const std::vector<Polynomial> &outputs) {
+    Kernel kernel;
+    for (const Polynomial &polynomial: temporaries) {
+      kernel.temporaries.push_back(expanded_expression(polynomial));
+    }
+    for (const Polynomial &output: outputs) {
+      kernel.outputs.push_back(expanded_expression(output));
+    }
+    return kernel;
+  }
+
+
+  // ================
+  // = Verification =
+  // ================
+
+
+  static double evaluate(const ExpressionPtr &expression, const std::vector<double> &variables, const std::vector<double> &temporaries) {
+    if (expression == nullptr) return 0.0;
+    switch (expression->kind) {
+    case Expression::Kind::VARIABLE:
+      return variables[expression->index];
+    case Expression::Kind::TEMPORARY:
+      return temporaries[expression->index];
+    case Expression::Kind::PRODUCT: {
+      double result = 1.0;
+      for (const ExpressionPtr &operand: expression->operands) {
+        result *= evaluate(operand, variables, temporaries);
+      }
+      return result;
+    }
+    case Expression::Kind::SUM: {
+      double result = 0.0;
+      for (size_t i = 0; i < expression->operands.size(); i++) {
+        result += expression->signs[i] * evaluate(expression->operands[i], variables, temporaries);
+      }
+      return result;
+    }
+    case Expression::Kind::SCALE:
+      return double(expression->factor) * evaluate(expression->operands[0], variables, temporaries);
+    }
+    return 0.0;
+  }
+
+
+  bool check_kernel(const Kernel &kernel, const std::vector<Polynomial> &outputs) {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<double> distribution(-1.0, 1.0);
+    for (int trial = 0; trial < 8; trial++) {
+      std::vector<double> variables(2 * VARIABLES_PER_OPERAND);
+      for (double &variable: variables) {
+        variable = distribution(generator);
+      }
+      std::vector<double> temporaries;
+      for (const ExpressionPtr &expression: kernel.temporaries) {
+        temporaries.push_back(evaluate(expression, variables, temporaries));
+      }
+
+      for (size_t i = 0; i < outputs.size(); i++) {
+        double expected = 0.0;
+        for (const auto &[monomial, coefficient]: outputs[i]) {
+          double term = double(coefficient);
+          for (const unsigned variable: monomial) {
+            term *= variables[variable];
+          }
+          expected += term;
+        }
+        if (std::abs(evaluate(kernel.outputs[i], variables, temporaries) - expected) > 1e-9 * (1.0 + std::abs(expected))) {
+          return false;
+        }
+      }
+    }
+    return true;
+  }
+}
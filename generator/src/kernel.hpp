@@ -0,0 +1,110 @@
+#pragma once
+
+#include "algebra.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+
+// Symbolic products of blade types and the straight line programs that evaluate them
+namespace generator {
+  // ===============
+  // = Blade types =
+  // ===============
+
+
+  // A member of a kmath type (e31 of _Line3), the coefficient of sign * blade
+  struct Field {
+    std::string name;
+    unsigned blade;
+    int sign;
+  };
+
+
+  // The members of a kmath type, in the order of its constructor
+  struct BladeType {
+    std::string name;
+    std::vector<Field> fields;
+  };
+
+
+  // ===============
+  // = Polynomials =
+  // ===============
+
+
+  // A variable is a field of an operand, operand * VARIABLES_PER_OPERAND + field
+  constexpr const unsigned VARIABLES_PER_OPERAND = 64;
+
+  // Sorted variables, with repetitions
+  using Monomial = std::vector<unsigned>;
+  using Polynomial = std::map<Monomial, long>;
+
+  // Polynomial coefficient of every non zero blade
+  using Multivector = std::map<unsigned, Polynomial>;
+
+
+  Multivector operand(const BladeType &type, const unsigned operand);
+  Multivector product(const Algebra &algebra, const Product product, const Multivector &a, const Multivector &b);
+  Multivector reverse(const Multivector &a);
+
+
+  // ==========================
+  // = Straight line programs =
+  // ==========================
+
+
+  struct Expression;
+  using ExpressionPtr = std::shared_ptr<const Expression>;
+
+  struct Expression {
+    enum class Kind {
+      VARIABLE,
+      TEMPORARY,
+      PRODUCT,
+      SUM,
+      SCALE,
+    };
+
+    Kind kind;
+    // Variable or temporary index
+    unsigned index = 0;
+    // Integer factor of SCALE
+    long factor = 1;
+    // Factors of PRODUCT, terms of SUM, the scaled expression of SCALE
+    std::vector<ExpressionPtr> operands = {};
+    // Sign of every term of SUM
+    std::vector<int> signs = {};
+  };
+
+
+  // Temporaries are evaluated in order and may use the previous ones, outputs are the fields of the
+  // result type
+  struct Kernel {
+    std::vector<ExpressionPtr> temporaries;
+    std::vector<ExpressionPtr> outputs;
+
+    size_t multiplications() const;
+    size_t additions() const;
+  };
+
+
+  // Evaluates every output from the coefficients of the products, without factorization
+  Kernel expanded_kernel(const std::vector<Polynomial> &outputs);
+
+  // Evaluates x -> v x ~v as a matrix applied to x: the quadratic monomials of v and the entries of
+  // the matrix are computed once and shared by the outputs. x is the operand 1, v the operand 0.
+  Kernel quadratic_kernel(const std::vector<Polynomial> &outputs);
+
+  // Same as the expanded kernel, with the blades of an intermediate product as temporaries,
+  // variables of the operand 2 refer to them
+  Kernel staged_kernel(const std::vector<Polynomial> &temporaries, const std::vector<Polynomial> &outputs);
+
+
+  // Evaluates the outputs of a kernel and of the polynomials for random variables, and returns
+  // whether they match
+  bool check_kernel(const Kernel &kernel, const std::vector<Polynomial> &outputs);
+}
@@ -0,0 +1,274 @@
+#include "algebra.hpp"
+#include "kernel.hpp"
+#include "spec.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+
+// Generates the product and sandwich kernels of a spec (see spec.hpp) into a kmath header:
+//
+//   KMathGenerator <spec> <header>
+
+
+using namespace generator;
+
+
+constexpr const char *LICENSE =
+  "// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)\n"
+  "// \n"
+  "// Permission is hereby granted, free of charge, to any person obtaining a copy\n"
+  "// of this software and associated documentation files (the “Software”), to deal\n"
+  "// in the Software without restriction, including without limitation the rights\n"
+  "// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell\n"
+  "// copies of the Software, and to permit persons to whom the Software is\n"
+  "// furnished to do so, subject to the following conditions:\n"
+  "// \n"
+  "// The above copyright notice and this permission notice shall be included in all\n"
+  "// copies or substantial portions of the Software.\n"
+  "//\n"
+  "// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR\n"
+  "// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,\n"
+  "// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE\n"
+  "// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER\n"
+  "// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,\n"
+  "// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE\n"
+  "// SOFTWARE.\n";
+
+
+// ============
+// = Printing =
+// ============
+
+
+struct Operands {
+  std::string names[2];
+  const BladeType *types[2];
+};
+
+
+static std::string print(const ExpressionPtr &expression, const Operands &operands, const bool nested) {
+  if (expression == nullptr) return "T(0)";
+  switch (expression->kind) {
+  case Expression::Kind::VARIABLE: {
+    const unsigned operand = expression->index / VARIABLES_PER_OPERAND;
+    return operands.names[operand] + "." + operands.types[operand]->fields[expression->index % VARIABLES_PER_OPERAND].name;
+  }
+  case Expression::Kind::TEMPORARY: {
+    std::string name = "t";
+    name += std::to_string(expression->index);
+    return name;
+  }
+  case Expression::Kind::PRODUCT: {
+    std::string result;
+    for (const ExpressionPtr &operand: expression->operands) {
+      if (!result.empty()) {
+        result += " * ";
+      }
+      result += print(operand, operands, true);
+    }
+    return result;
+  }
+  case Expression::Kind::SCALE:
+    return "T(" + std::to_string(expression->factor) + ") * " + print(expression->operands[0], operands, true);
+  case Expression::Kind::SUM: {
+    std::string result;
+    for (size_t i = 0; i < expression->operands.size(); i++) {
+      const std::string term = print(expression->operands[i], operands, true);
+      if (i == 0) {
+        result += (expression->signs[i] < 0)? "- " + term : term;
+      } else {
+        result += ((expression->signs[i] < 0)? " - " : " + ") + term;
+      }
+    }
+    return nested? "(" + result + ")" : result;
+  }
+  }
+  return "";
+}
+
+
+static bool uses_scalar_type(const ExpressionPtr &expression) {
+  if (expression == nullptr || expression->kind == Expression::Kind::SCALE) return true;
+  for (const ExpressionPtr &operand: expression->operands) {
+    if (uses_scalar_type(operand)) return true;
+  }
+  return false;
+}
+
+
+static const char *product_name(const Product product) {
+  switch (product) {
+  case Product::GEOMETRIC: return "geometric";
+  case Product::OUTER: return "outer";
+  case Product::REGRESSIVE: return "regressive";
+  case Product::INNER: return "inner";
+  }
+  return "";
+}
+
+
+// ===========
+// = Kernels =
+// ===========
+
+
+// Polynomials of the fields of the result type, false when the product has blades the result type
+// does not store
+static bool result_fields(const Algebra &algebra, const Multivector &result, const BladeType &type, std::vector<Polynomial> &r_fields, std::string &r_missing) {
+  r_fields.clear();
+  for (const Field &field: type.fields) {
+    Polynomial polynomial;
+    const auto blade = result.find(field.blade);
+    if (blade != result.end()) {
+      polynomial = blade->second;
+      for (auto &[monomial, coefficient]: polynomial) {
+        coefficient *= field.sign;
+      }
+    }
+    r_fields.push_back(polynomial);
+  }
+  for (const auto &[blade, polynomial]: result) {
+    bool stored = false;
+    for (const Field &field: type.fields) {
+      stored |= (field.blade == blade);
+    }
+    if (!stored) {
+      r_missing = algebra.blade_name(blade);
+      return false;
+    }
+  }
+  return true;
+}
+
+
+// Generates the kernel of a spec line, the cheapest of the candidate kernels for sandwiches
+static bool generate(const Algebra &algebra, const Spec &spec, const KernelSpec &kernel_spec, Kernel &r_kernel) {
+  const BladeType &a = spec.types[kernel_spec.a];
+  const BladeType &b = spec.types[kernel_spec.b];
+  const BladeType &result = spec.types[kernel_spec.result];
+  const Multivector ma = operand(a, 0);
+  const Multivector mb = operand(b, 1);
+
+  std::vector<Polynomial> outputs;
+  std::string missing;
+  std::vector<Kernel> candidates;
+  if (!kernel_spec.sandwich) {
+    if (!result_fields(algebra, product(algebra, kernel_spec.product, ma, mb), result, outputs, missing)) {
+      std::cerr << "line " << kernel_spec.line << ": the product has a component on " << missing << " that " << result.name << " does not store" << std::endl;
+      return false;
+    }
+    candidates.push_back(expanded_kernel(outputs));
+  } else {
+    const Multivector vx = product(algebra, Product::GEOMETRIC, ma, mb);
+    if (!result_fields(algebra, product(algebra, Product::GEOMETRIC, vx, reverse(ma)), result, outputs, missing)) {
+      std::cerr << "line " << kernel_spec.line << ": the sandwich has a component on " << missing << " that " << result.name << " does not store" << std::endl;
+      return false;
+    }
+    candidates.push_back(quadratic_kernel(outputs));
+
+    // v * x as temporaries, the variables of the operand 2, then (v * x) * ~v
+    std::vector<Polynomial> staged;
+    Multivector temporaries;
+    for (const auto &[blade, polynomial]: vx) {
+      temporaries[blade][{ 2 * VARIABLES_PER_OPERAND + unsigned(staged.size()) }] = 1;
+      staged.push_back(polynomial);
+    }
+    std::vector<Polynomial> staged_outputs;
+    result_fields(algebra, product(algebra, Product::GEOMETRIC, temporaries, reverse(ma)), result, staged_outputs, missing);
+    candidates.push_back(staged_kernel(staged, staged_outputs));
+  }
+
+  bool found = false;
+  for (const Kernel &candidate: candidates) {
+    if (!check_kernel(candidate, outputs)) {
+      std::cerr << "line " << kernel_spec.line << ": a generated kernel does not match the product" << std::endl;
+      return false;
+    }
+    if (!found || candidate.multiplications() + candidate.additions() < r_kernel.multiplications() + r_kernel.additions()) {
+      r_kernel = candidate;
+      found = true;
+    }
+  }
+  return true;
+}
+
+
+static void write_kernel(std::ostream &out, const Spec &spec, const KernelSpec &kernel_spec, const Kernel &kernel) {
+  const BladeType &a = spec.types[kernel_spec.a];
+  const BladeType &b = spec.types[kernel_spec.b];
+  const BladeType &result = spec.types[kernel_spec.result];
+  const Operands operands{ .names = { kernel_spec.sandwich? "v" : "a", kernel_spec.sandwich? "x" : "b" }, .types = { &a, &b } };
+
+  if (kernel_spec.sandwich) {
+    out << "  // " << a.name << " * " << b.name << " * ~" << a.name << " into a " << result.name;
+  } else {
+    out << "  // " << product_name(kernel_spec.product) << " product of " << a.name << " and " << b.name << " into a " << result.name;
+  }
+  out << ": " << kernel.multiplications() << " mul, " << kernel.additions() << " add\n";
+  out << "  template<typename R, typename " << (kernel_spec.sandwich? "V, typename X>\n" : "A, typename B>\n");
+  out << "  constexpr R " << kernel_spec.function << "(const " << (kernel_spec.sandwich? "V &v, const X &x" : "A &a, const B &b") << ") {\n";
+
+  bool scalar_type = !kernel.temporaries.empty();
+  for (const ExpressionPtr &expression: kernel.outputs) {
+    scalar_type |= uses_scalar_type(expression);
+  }
+  if (scalar_type) {
+    out << "    using T = decltype(R::" << result.fields[0].name << ");\n";
+  }
+  for (size_t i = 0; i < kernel.temporaries.size(); i++) {
+    out << "    const T t" << i << " = " << print(kernel.temporaries[i], operands, false) << ";\n";
+  }
+  out << "    return R(\n";
+  for (size_t i = 0; i < kernel.outputs.size(); i++) {
+    out << "      " << print(kernel.outputs[i], operands, false) << ((i + 1 < kernel.outputs.size())? ",\n" : "\n");
+  }
+  out << "    );\n";
+  out << "  }\n";
+}
+
+
+int main(const int argc, const char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "usage: KMathGenerator <spec> <header>" << std::endl;
+    return 1;
+  }
+  const std::optional<Spec> spec = parse_spec(argv[1]);
+  if (!spec.has_value()) return 1;
+  const Algebra algebra(spec->signature);
+
+  std::ostringstream out;
+  out << LICENSE << "\n\n";
+  out << "#pragma once\n\n\n";
+  out << "// Kernels of R(" << spec->signature.p << ", " << spec->signature.q << ", " << spec->signature.r << ") generated by KMathGenerator from ";
+  out << std::filesystem::path(argv[1]).filename().string() << ", regenerate them with the\n";
+  out << "// kmath_generate target instead of editing this file.\n";
+  out << "//\n";
+  out << "// The kernels are templates over the types of the spec: the operands are read through their\n";
+  out << "// fields, the result is built from its fields in the order of the spec. T is the scalar type\n";
+  out << "// of the result.\n";
+  out << "namespace kmath {\n";
+  for (size_t i = 0; i < spec->kernels.size(); i++) {
+    Kernel kernel;
+    if (!generate(algebra, *spec, spec->kernels[i], kernel)) {
+      std::cerr << argv[1] << ": generation failed" << std::endl;
+      return 1;
+    }
+    out << ((i == 0)? "" : "\n\n");
+    write_kernel(out, *spec, spec->kernels[i], kernel);
+  }
+  out << "}\n";
+
+  std::ofstream header(argv[2]);
+  header << out.str();
+  if (!header) {
+    std::cerr << argv[2] << ": cannot write the header" << std::endl;
+    return 1;
+  }
+  std::cout << argv[2] << ": " << spec->kernels.size() << " kernels" << std::endl;
+  return 0;
+}
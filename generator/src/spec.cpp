@@ -0,0 +1,120 @@
+#include "spec.hpp"
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+
+namespace generator {
+  static bool error(const std::string &path, const size_t line, const std::string &message) {
+    std::cerr << path << ":" << line << ": " << message << std::endl;
+    return false;
+  }
+
+
+  static bool find_type(const Spec &spec, const std::string &name, size_t &r_index) {
+    for (size_t i = 0; i < spec.types.size(); i++) {
+      if (spec.types[i].name == name) {
+        r_index = i;
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  static bool parse_product(const std::string &name, Product &r_product) {
+    if (name == "geometric") r_product = Product::GEOMETRIC;
+    else if (name == "outer") r_product = Product::OUTER;
+    else if (name == "regressive") r_product = Product::REGRESSIVE;
+    else if (name == "inner") r_product = Product::INNER;
+    else return false;
+    return true;
+  }
+
+
+  static bool parse_line(const std::string &path, const size_t line, std::istringstream &words, std::optional<Algebra> &r_algebra, Spec &r_spec) {
+    std::string keyword;
+    if (!(words >> keyword)) return true;
+
+    if (keyword == "algebra") {
+      if (r_algebra.has_value()) return error(path, line, "the algebra is already declared");
+      Signature signature;
+      if (!(words >> signature.p >> signature.q >> signature.r)) return error(path, line, "expected: algebra <p> <q> <r>");
+      if (signature.p + signature.q + signature.r == 0 || signature.p + signature.q + signature.r > 9) {
+        return error(path, line, "the algebra must have between 1 and 9 basis vectors");
+      }
+      r_spec.signature = signature;
+      r_algebra.emplace(signature);
+      return true;
+    }
+    if (!r_algebra.has_value()) return error(path, line, "the algebra must be declared first");
+
+    if (keyword == "type") {
+      BladeType type;
+      if (!(words >> type.name)) return error(path, line, "expected: type <name> <field>...");
+      std::string field;
+      while (words >> field) {
+        unsigned blade;
+        int sign;
+        if (!r_algebra->parse_blade(field, blade, sign)) return error(path, line, "'" + field + "' is not a blade of the algebra");
+        for (const Field &other: type.fields) {
+          if (other.blade == blade) return error(path, line, "'" + field + "' is the blade of '" + other.name + "'");
+        }
+        type.fields.push_back(Field{ .name = field, .blade = blade, .sign = sign });
+      }
+      if (type.fields.empty()) return error(path, line, "a type needs at least one field");
+      size_t index;
+      if (find_type(r_spec, type.name, index)) return error(path, line, "type '" + type.name + "' is already declared");
+      r_spec.types.push_back(type);
+      return true;
+    }
+
+    if (keyword == "product" || keyword == "sandwich") {
+      KernelSpec kernel{ .sandwich = (keyword == "sandwich"), .line = line };
+      std::string product, a, b, result;
+      if (!(words >> kernel.function)) return error(path, line, "expected a function name");
+      if (!kernel.sandwich) {
+        if (!(words >> product) || !parse_product(product, kernel.product)) {
+          return error(path, line, "expected a product: geometric, outer, regressive or inner");
+        }
+      }
+      if (!(words >> a >> b >> result)) return error(path, line, "expected the operand and result types");
+      for (const auto &[name, index]: { std::pair{ a, &kernel.a }, std::pair{ b, &kernel.b }, std::pair{ result, &kernel.result } }) {
+        if (!find_type(r_spec, name, *index)) return error(path, line, "unknown type '" + name + "'");
+      }
+      r_spec.kernels.push_back(kernel);
+      return true;
+    }
+
+    return error(path, line, "unknown declaration '" + keyword + "'");
+  }
+
+
+  std::optional<Spec> parse_spec(const std::string &path) {
+    std::ifstream file(path);
+    if (!file) {
+      std::cerr << path << ": cannot open the file" << std::endl;
+      return std::nullopt;
+    }
+
+    Spec spec{};
+    std::optional<Algebra> algebra;
+    std::string text;
+    for (size_t line = 1; std::getline(file, text); line++) {
+      std::istringstream words(text.substr(0, text.find('#')));
+      if (!parse_line(path, line, words, algebra, spec)) return std::nullopt;
+      std::string extra;
+      words.clear();
+      if (words >> extra) {
+        error(path, line, "unexpected '" + extra + "'");
+        return std::nullopt;
+      }
+    }
+    if (!algebra.has_value()) {
+      error(path, 0, "no algebra declared");
+      return std::nullopt;
+    }
+    return spec;
+  }
+}
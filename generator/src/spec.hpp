@@ -0,0 +1,44 @@
+#pragma once
+
+#include "algebra.hpp"
+#include "kernel.hpp"
+
+#include <optional>
+#include <string>
+#include <vector>
+
+
+// Specification of a generated header, one declaration per line:
+//
+//   algebra <p> <q> <r>                               signature of the algebra
+//   type <name> <field>...                            a kmath type and its blades (s, e0, e31...)
+//   product <function> <product> <a> <b> <result>     result = a * b (geometric, outer,
+//                                                     regressive or inner)
+//   sandwich <function> <v> <x> <result>              result = v * x * ~v
+//
+// Everything after a # is a comment. The algebra comes first, types are declared before the
+// kernels using them.
+namespace generator {
+  struct KernelSpec {
+    std::string function = {};
+    // Products are bilinear kernels of a and b, sandwiches quadratic in a (v) and linear in b (x)
+    bool sandwich = false;
+    Product product = Product::GEOMETRIC;
+    size_t a = 0;
+    size_t b = 0;
+    size_t result = 0;
+    // Source line, for the errors
+    size_t line = 0;
+  };
+
+
+  struct Spec {
+    Signature signature;
+    std::vector<BladeType> types;
+    std::vector<KernelSpec> kernels;
+  };
+
+
+  // Returns an empty optional and prints the error on std::cerr when the spec is invalid
+  std::optional<Spec> parse_spec(const std::string &path);
+}
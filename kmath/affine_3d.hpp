@@ -0,0 +1,226 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "rotor_3d.hpp"
+#include "motor_3d.hpp"
+
+
+namespace kmath {
+  // ===========
+  // = Affine3 =
+  // ===========
+
+
+  // Affine transformation of the 3D space, stored as the first three rows of a _Mat4: the columns
+  // x, y and z are the image of the basis, w is the translation. The implicit last row is always
+  // (0, 0, 0, 1), so compositions and inverses only deal with the 3x3 linear part, and a transform
+  // takes 12 scalars instead of 16.
+  template<Number T>
+  struct _Affine3 {
+    _Vec3<T> x, y, z, w;
+
+  public:
+    static constexpr _Affine3<T> from_basis(const _Mat3<T> &basis, const _Vec3<T> &translation = _Vec3<T>::ZERO) {
+      return _Affine3<T>(basis.x, basis.y, basis.z, translation);
+    }
+
+
+    // The last row of the matrix is ignored, it must be (0, 0, 0, 1)
+    static constexpr _Affine3<T> from_mat4(const _Mat4<T> &m) {
+      return _Affine3<T>(m.x.xyz(), m.y.xyz(), m.z.xyz(), m.w.xyz());
+    }
+
+
+    static constexpr _Affine3<T> translation(const _Vec3<T> &translation) {
+      return from_basis(_Mat3<T>::IDENTITY, translation);
+    }
+
+
+    static constexpr _Affine3<T> scale(const T x, const T y, const T z) {
+      return from_basis(_Mat3<T>::scale(x, y, z));
+    }
+
+  public:
+    constexpr _Vec3<T> &operator[](const size_t i) { return reinterpret_cast<_Vec3<T>*>(this)[i]; }
+    constexpr T &operator()(const size_t i, const size_t j) { return reinterpret_cast<T*>(this)[i + 3 * j]; }
+    constexpr const T &operator()(const size_t i, const size_t j) const { return reinterpret_cast<const T*>(this)[i + 3 * j]; }
+
+  public:
+    static const _Affine3<T> IDENTITY;
+  };
+
+
+  template<Number T>
+  constexpr const _Affine3<T> _Affine3<T>::IDENTITY = _Affine3<T>(
+    _Vec3<T>(T(1), T(0), T(0)),
+    _Vec3<T>(T(0), T(1), T(0)),
+    _Vec3<T>(T(0), T(0), T(1)),
+    _Vec3<T>::ZERO
+  );
+
+
+  template<Number T>
+  constexpr _Mat3<T> get_basis(const _Affine3<T> &a) {
+    return _Mat3<T>(a.x, a.y, a.z);
+  }
+
+
+  template<Number T>
+  constexpr _Vec3<T> get_translation(const _Affine3<T> &a) {
+    return a.w;
+  }
+
+
+  template<Number T>
+  constexpr bool is_approx_zero(const _Affine3<T> &a) {
+    return is_approx_zero(a.x) && is_approx_zero(a.y) && is_approx_zero(a.z) && is_approx_zero(a.w);
+  }
+
+
+  // =============================
+  // = Affine3 specific function =
+  // =============================
+
+
+  template<Number T>
+  constexpr _Vec3<T> transform_direction(const _Vec3<T> &a, const _Affine3<T> &t) {
+    return t.x * a.x + t.y * a.y + t.z * a.z;
+  }
+
+
+  template<Number T>
+  constexpr _Vec3<T> transform_point(const _Vec3<T> &a, const _Affine3<T> &t) {
+    return transform_direction(a, t) + t.w;
+  }
+
+
+  // Inverse of any invertible affine transformation
+  template<Number T>
+  constexpr _Affine3<T> affine_inverse(const _Affine3<T> &t) {
+    const _Mat3<T> inv = inverse(get_basis(t));
+    return _Affine3<T>::from_basis(inv, -(inv * t.w));
+  }
+
+
+  // The inverse for an affine transformation without scaling (rigid transformation): the basis
+  // must be orthonormal.
+  template<Number T>
+  constexpr _Affine3<T> fast_inverse(const _Affine3<T> &t) {
+    const _Mat3<T> inv = transpose(get_basis(t));
+    return _Affine3<T>::from_basis(inv, -(inv * t.w));
+  }
+
+
+  // =====================
+  // = Affine3 operators =
+  // =====================
+
+
+  // Composition: (a * b) applies b first, then a
+  template<Number T>
+  constexpr _Affine3<T> operator*(const _Affine3<T> &a, const _Affine3<T> &b) {
+    return _Affine3<T>(
+      transform_direction(b.x, a),
+      transform_direction(b.y, a),
+      transform_direction(b.z, a),
+      transform_point(b.w, a)
+    );
+  }
+
+
+  template<Number T>
+  constexpr _Affine3<T> &operator*=(_Affine3<T> &a, const _Affine3<T> &b) {
+    a = a * b;
+    return a;
+  }
+
+
+  template<Number T>
+  constexpr _Vec4<T> operator*(const _Affine3<T> &a, const _Vec4<T> &b) {
+    return _Vec4<T>(transform_direction(b.xyz(), a) + a.w * b.w, b.w);
+  }
+
+
+  template<Number T>
+  constexpr _Affine3<T> operator+(const _Affine3<T> &a, const _Affine3<T> &b) {
+    return _Affine3<T>(
+      a.x + b.x,
+      a.y + b.y,
+      a.z + b.z,
+      a.w + b.w
+    );
+  }
+
+
+  template<Number T>
+  constexpr _Affine3<T> operator-(const _Affine3<T> &a, const _Affine3<T> &b) {
+    return _Affine3<T>(
+      a.x - b.x,
+      a.y - b.y,
+      a.z - b.z,
+      a.w - b.w
+    );
+  }
+
+
+  // ===============
+  // = Conversions =
+  // ===============
+
+
+  template<Number T>
+  constexpr _Mat4<T> as_transform(const _Affine3<T> &a) {
+    return _Mat4<T>(
+      _Vec4<T>(a.x, T(0)),
+      _Vec4<T>(a.y, T(0)),
+      _Vec4<T>(a.z, T(0)),
+      _Vec4<T>(a.w, T(1))
+    );
+  }
+
+
+  template<Number T>
+  inline _Affine3<T> as_affine(const _Motor3<T> &m) {
+    return _Affine3<T>::from_basis(as_basis(get_rotor(m)), get_translation(m));
+  }
+
+
+  // The basis must be a rotation matrix
+  template<Number T>
+  inline _Motor3<T> as_motor(const _Affine3<T> &a) {
+    return _Motor3<T>::from_rotor_translation(_Rotor3<T>::from_basis(get_basis(a)), a.w);
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Affine3<float> Affine3;
+  typedef _Affine3<double> Affine3d;
+}
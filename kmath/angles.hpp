@@ -180,8 +180,8 @@ namespace kmath {
 
   template<Number T>
   _Mat3<T> euler_to_basis(const _Vec3<T> &rotation, const EulerBasis basis = EulerBasis::YXZ) {
-    const _Vec3<T> c = cos(rotation);
-    const _Vec3<T> s = sin(rotation);
+    _Vec3<T> s, c;
+    sincos(rotation, s, c);
 
     switch (basis) {
     break;case EulerBasis::XZY:
@@ -258,6 +258,8 @@ namespace kmath {
         _Vec3<T>(s.x * s.y                   , -c.x * s.y                 , c.y      )
       );
     }
+    // Not a valid basis
+    return _Mat3<T>::IDENTITY;
   }
 
 
@@ -499,8 +501,8 @@ namespace kmath {
   template<Number T>
   _Rotor3<T> euler_to_rotor(const _Vec3<T> &euler, const EulerBasis basis = EulerBasis::YXZ) {
     const _Vec3<T> half_angles = T(0.5) * euler;
-    const _Vec3<T> c = cos(half_angles);
-    const _Vec3<T> s = sin(half_angles);
+    _Vec3<T> s, c;
+    sincos(half_angles, s, c);
 
     _Rotor3<T> result;
 
@@ -602,10 +604,10 @@ namespace kmath {
   _Vec3<T> rotor_to_euler(const _Rotor3<T> &rotor, const EulerBasis basis = EulerBasis::YXZ) {
     const T INV_SQRT_2 = T(1) / sqrt(T(2));
 
-    bool tait_bryan;
+    bool tait_bryan = true;
     Vec3i rotation_basis; // This is the indices for the rotation basis (a, b, c)
     Vec3i permutation; // Angle permutation for Tait-Bryan angles
-    T signature;
+    T signature = T(1);
 
     switch (basis) {
     break;case EulerBasis::XYZ:
@@ -341,6 +341,18 @@ namespace kmath {
   }
 
 
+  constexpr bool none(const bool a) {
+    return !a;
+  }
+
+
+  template<template<typename> typename ST>
+  requires ArrayTemplate<ST>
+  constexpr bool none(const ST<bool> a) {
+    return !any(a);
+  }
+
+
   template<template<typename> typename ST>
   requires ArrayTemplate<ST>
   constexpr ST<bool> operator&&(const ST<bool> a, const ST<bool> b) {
@@ -723,6 +735,14 @@ namespace kmath {
   }
 
 
+  // Computes both the sine and the cosine of a, types with a vectorized kernel share the range reduction
+  template<Number V>
+  inline void sincos(const V a, V &sin_a, V &cos_a) {
+    sin_a = sin(a);
+    cos_a = cos(a);
+  }
+
+
   template<Number V>
   inline V tan(const V a) {
     return apply(a, [](const auto a) {
@@ -0,0 +1,140 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "dispatch.hpp"
+#include "decomposition_3d.hpp"
+#include "frustum_3d.hpp"
+#include "matrix.hpp"
+#include "motor_2d.hpp"
+#include "motor_3d.hpp"
+#include "pga_3d.hpp"
+#include "vector.hpp"
+#include "color/base.hpp"
+#include "color/ok.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+
+// Batch functions over contiguous arrays of float vectors (AoS). Unlike the templates of
+// vector_array.hpp, which use the instruction set the caller is compiled for, these are compiled
+// into the library once per CPU tier and dispatched at runtime (see dispatch.hpp).
+//
+// result must hold at least as many elements as the input, and may alias it.
+namespace kmath::batch {
+  // Inputs of at least this many elements are split across threads by the functions documented
+  // as threaded
+  constexpr const size_t PARALLEL_THRESHOLD = 1 << 16;
+
+
+  // =================
+  // = Vector3 batch =
+  // =================
+
+
+  void normalize(const std::span<const Vec3> v, const std::span<Vec3> result);
+  void length(const std::span<const Vec3> v, const std::span<float> result);
+
+
+  // ================
+  // = Matrix batch =
+  // ================
+
+
+  // result[i] = m * v[i]
+  void transform(const Mat4 &m, const std::span<const Vec4> v, const std::span<Vec4> result);
+
+
+  // result[i] = (m * Vec4(points[i], 1)).xyz(), for affine transforms. Threaded.
+  void transform_points(const Mat4 &m, const std::span<const Vec3> points, const std::span<Vec3> result);
+  void transform_points(const Mat4d &m, const std::span<const Vec3d> points, const std::span<Vec3d> result);
+
+
+  // result[i] = homogeneous_projection(m * Vec4(points[i], 1)), for projections. Threaded.
+  void project_points(const Mat4 &m, const std::span<const Vec3> points, const std::span<Vec3> result);
+  void project_points(const Mat4d &m, const std::span<const Vec3d> points, const std::span<Vec3d> result);
+
+
+  // result[i] = decompose(m[i]), the polar decompositions are computed for a pack of matrices at
+  // once
+  void decompose(const std::span<const Mat4> m, const std::span<Decomposition3> result);
+
+
+  // ===============
+  // = Motor batch =
+  // ===============
+
+
+  // result[i] = transform_point(points[i], m)
+  void transform_points(const Motor3 &m, const std::span<const Vec3> points, const std::span<Vec3> result);
+
+
+  // result[i] = transform_point(points[i], m), for 2D sprites and UI. Threaded.
+  void transform_points(const Motor2 &m, const std::span<const Vec2> points, const std::span<Vec2> result);
+
+
+  // =================
+  // = Culling batch =
+  // =================
+
+
+  // Bit i % 64 of visible[i / 64] is set when spheres[i] intersects the frustum, see is_visible.
+  // visible must hold at least (size + 63) / 64 words, the bits past the size are cleared.
+  // Threaded.
+  void cull_spheres(const Frustum3 &frustum, const std::span<const Sphere3> spheres, const std::span<std::uint64_t> visible);
+
+
+  // Same as cull_spheres, for boxes
+  void cull_aabbs(const Frustum3 &frustum, const std::span<const Aabb3> boxes, const std::span<std::uint64_t> visible);
+
+
+  // =====================
+  // = Multivector batch =
+  // =====================
+
+
+  // result[i] = a[i] * b[i], a[i] & b[i], a[i] | b[i] and a[i] || b[i]. The blades of a pack of
+  // multivectors are transposed into one pack per blade, and the dense formulas of pga_3d.hpp
+  // compute the whole pack at once. a and b must have the same size. Threaded.
+  void geometric_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result);
+  void geometric_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result);
+  void outer_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result);
+  void outer_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result);
+  void regressive_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result);
+  void regressive_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result);
+  void inner_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result);
+  void inner_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result);
+
+
+  // ===============
+  // = Color batch =
+  // ===============
+
+
+  // Same as ok::rgb_to_oklab and ok::oklab_to_rgb (gamma 2.2), with the vectorized cbrt and pow
+  // of simd.hpp: results may differ from the scalar functions by a few ulps.
+  void rgb_to_oklab(const std::span<const Rgb> rgb, const std::span<ok::OkLab> result);
+  void oklab_to_rgb(const std::span<const ok::OkLab> lab, const std::span<Rgb> result);
+}
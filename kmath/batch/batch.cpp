@@ -0,0 +1,182 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../batch.hpp"
+#include "../private/batch_table.hpp"
+#include "../private/parallel.hpp"
+
+
+namespace kmath::batch {
+  namespace {
+    // See parallel.hpp
+    template<typename F>
+    void _parallel_for(const size_t count, F &&body) {
+      kmath::_parallel_for(count, PARALLEL_THRESHOLD, body);
+    }
+
+
+    // The ranges of _parallel_for are multiples of 64 elements, so they never share a word of
+    // the bitmask
+    template<typename V, typename K>
+    void _run_culling(const K kernel, const Frustum3 &frustum, const std::span<const V> volumes, const std::span<std::uint64_t> visible) {
+      KMATH_ASSERT(visible.size() >= (volumes.size() + 63) / 64);
+      _parallel_for(volumes.size(), [&](const size_t begin, const size_t end) {
+        kernel(frustum, volumes.data() + begin, visible.data() + begin / 64, end - begin);
+      });
+    }
+
+
+    template<typename M, typename V, typename K>
+    void _run_threaded(const K kernel, const M &m, const std::span<const V> points, const std::span<V> result) {
+      KMATH_ASSERT(result.size() >= points.size());
+      _parallel_for(points.size(), [&](const size_t begin, const size_t end) {
+        kernel(m, points.data() + begin, result.data() + begin, end - begin);
+      });
+    }
+
+
+    template<typename M, typename K>
+    void _run_products(const K kernel, const _Mvec3Product product, const std::span<const M> a, const std::span<const M> b, const std::span<M> result) {
+      KMATH_ASSERT(a.size() == b.size());
+      KMATH_ASSERT(result.size() >= a.size());
+      _parallel_for(a.size(), [&](const size_t begin, const size_t end) {
+        kernel(product, a.data() + begin, b.data() + begin, result.data() + begin, end - begin);
+      });
+    }
+  }
+
+
+  void normalize(const std::span<const Vec3> v, const std::span<Vec3> result) {
+    KMATH_ASSERT(result.size() >= v.size());
+    _batch::_kernels().normalize(v.data(), result.data(), v.size());
+  }
+
+
+  void length(const std::span<const Vec3> v, const std::span<float> result) {
+    KMATH_ASSERT(result.size() >= v.size());
+    _batch::_kernels().length(v.data(), result.data(), v.size());
+  }
+
+
+  void transform(const Mat4 &m, const std::span<const Vec4> v, const std::span<Vec4> result) {
+    KMATH_ASSERT(result.size() >= v.size());
+    _batch::_kernels().transform(m, v.data(), result.data(), v.size());
+  }
+
+
+  void transform_points(const Motor3 &m, const std::span<const Vec3> points, const std::span<Vec3> result) {
+    KMATH_ASSERT(result.size() >= points.size());
+    _batch::_kernels().transform_points(m, points.data(), result.data(), points.size());
+  }
+
+
+  void transform_points(const Motor2 &m, const std::span<const Vec2> points, const std::span<Vec2> result) {
+    _run_threaded(_batch::_kernels().motor2_transform_points, m, points, result);
+  }
+
+
+  void transform_points(const Mat4 &m, const std::span<const Vec3> points, const std::span<Vec3> result) {
+    _run_threaded(_batch::_kernels().mat4_transform_points, m, points, result);
+  }
+
+
+  void transform_points(const Mat4d &m, const std::span<const Vec3d> points, const std::span<Vec3d> result) {
+    _run_threaded(_batch::_kernels().mat4d_transform_points, m, points, result);
+  }
+
+
+  void project_points(const Mat4 &m, const std::span<const Vec3> points, const std::span<Vec3> result) {
+    _run_threaded(_batch::_kernels().mat4_project_points, m, points, result);
+  }
+
+
+  void project_points(const Mat4d &m, const std::span<const Vec3d> points, const std::span<Vec3d> result) {
+    _run_threaded(_batch::_kernels().mat4d_project_points, m, points, result);
+  }
+
+
+  void decompose(const std::span<const Mat4> m, const std::span<Decomposition3> result) {
+    KMATH_ASSERT(result.size() >= m.size());
+    _batch::_kernels().decompose(m.data(), result.data(), m.size());
+  }
+
+
+  void cull_spheres(const Frustum3 &frustum, const std::span<const Sphere3> spheres, const std::span<std::uint64_t> visible) {
+    _run_culling(_batch::_kernels().cull_spheres, frustum, spheres, visible);
+  }
+
+
+  void cull_aabbs(const Frustum3 &frustum, const std::span<const Aabb3> boxes, const std::span<std::uint64_t> visible) {
+    _run_culling(_batch::_kernels().cull_aabbs, frustum, boxes, visible);
+  }
+
+
+  void rgb_to_oklab(const std::span<const Rgb> rgb, const std::span<ok::OkLab> result) {
+    KMATH_ASSERT(result.size() >= rgb.size());
+    _batch::_kernels().rgb_to_oklab(rgb.data(), result.data(), rgb.size());
+  }
+
+
+  void oklab_to_rgb(const std::span<const ok::OkLab> lab, const std::span<Rgb> result) {
+    KMATH_ASSERT(result.size() >= lab.size());
+    _batch::_kernels().oklab_to_rgb(lab.data(), result.data(), lab.size());
+  }
+
+
+  void geometric_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result) {
+    _run_products(_batch::_kernels().mvec3_product, _Mvec3Product::GEOMETRIC, a, b, result);
+  }
+
+
+  void geometric_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result) {
+    _run_products(_batch::_kernels().mvec3d_product, _Mvec3Product::GEOMETRIC, a, b, result);
+  }
+
+
+  void outer_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result) {
+    _run_products(_batch::_kernels().mvec3_product, _Mvec3Product::OUTER, a, b, result);
+  }
+
+
+  void outer_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result) {
+    _run_products(_batch::_kernels().mvec3d_product, _Mvec3Product::OUTER, a, b, result);
+  }
+
+
+  void regressive_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result) {
+    _run_products(_batch::_kernels().mvec3_product, _Mvec3Product::REGRESSIVE, a, b, result);
+  }
+
+
+  void regressive_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result) {
+    _run_products(_batch::_kernels().mvec3d_product, _Mvec3Product::REGRESSIVE, a, b, result);
+  }
+
+
+  void inner_product(const std::span<const Mvec3> a, const std::span<const Mvec3> b, const std::span<Mvec3> result) {
+    _run_products(_batch::_kernels().mvec3_product, _Mvec3Product::INNER, a, b, result);
+  }
+
+
+  void inner_product(const std::span<const Mvec3d> a, const std::span<const Mvec3d> b, const std::span<Mvec3d> result) {
+    _run_products(_batch::_kernels().mvec3d_product, _Mvec3Product::INNER, a, b, result);
+  }
+}
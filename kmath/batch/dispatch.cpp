@@ -0,0 +1,126 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#include "../dispatch.hpp"
+#include "../private/batch_table.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <string_view>
+
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define KMATH_DISPATCH_X86 1
+#else
+#define KMATH_DISPATCH_X86 0
+#endif
+
+
+namespace kmath {
+  namespace {
+    const _batch::_BatchKernels &_tier_kernels(const CpuTier tier) {
+      switch (tier) {
+        case CpuTier::SSE4_2: return _batch::sse4_2::KERNELS;
+        case CpuTier::AVX2: return _batch::avx2::KERNELS;
+        case CpuTier::AVX512: return _batch::avx512::KERNELS;
+        default: return _batch::baseline::KERNELS;
+      }
+    }
+
+
+    struct _Dispatch {
+      const CpuTier detected;
+      std::atomic<CpuTier> tier;
+      std::atomic<const _batch::_BatchKernels*> kernels;
+
+    public:
+      _Dispatch(): detected(detect_cpu_tier()), tier(detected), kernels(&_tier_kernels(detected)) {
+        const char *p_forced = std::getenv("KMATH_CPU_TIER");
+        if (p_forced == nullptr) return;
+
+        constexpr const CpuTier TIERS[] = { CpuTier::BASELINE, CpuTier::SSE4_2, CpuTier::AVX2, CpuTier::AVX512 };
+        for (const CpuTier t: TIERS) {
+          if (std::string_view(p_forced) == cpu_tier_name(t)) {
+            set(t);
+          }
+        }
+      }
+
+
+      CpuTier set(const CpuTier forced) {
+        const CpuTier effective = (forced < detected)? forced : detected;
+        kernels.store(&_tier_kernels(effective), std::memory_order_release);
+        tier.store(effective, std::memory_order_release);
+        return effective;
+      }
+    };
+
+
+    _Dispatch &_dispatch() {
+      static _Dispatch dispatch;
+      return dispatch;
+    }
+  }
+
+
+  CpuTier detect_cpu_tier() {
+#if KMATH_DISPATCH_X86
+    __builtin_cpu_init();
+    const bool avx2 = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+    if (avx2 && __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl") && __builtin_cpu_supports("avx512dq")) {
+      return CpuTier::AVX512;
+    }
+    if (avx2) {
+      return CpuTier::AVX2;
+    }
+    if (__builtin_cpu_supports("sse4.2")) {
+      return CpuTier::SSE4_2;
+    }
+#endif
+    return CpuTier::BASELINE;
+  }
+
+
+  CpuTier cpu_tier() {
+    return _dispatch().tier.load(std::memory_order_acquire);
+  }
+
+
+  CpuTier set_cpu_tier(const CpuTier tier) {
+    return _dispatch().set(tier);
+  }
+
+
+  const char *cpu_tier_name(const CpuTier tier) {
+    switch (tier) {
+      case CpuTier::BASELINE: return "baseline";
+      case CpuTier::SSE4_2: return "sse4.2";
+      case CpuTier::AVX2: return "avx2";
+      case CpuTier::AVX512: return "avx512";
+    }
+    return "unknown";
+  }
+
+
+  const _batch::_BatchKernels &_batch::_kernels() {
+    return *_dispatch().kernels.load(std::memory_order_acquire);
+  }
+}
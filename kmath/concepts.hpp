@@ -200,8 +200,9 @@ namespace kmath {
   };
 
 
+  // Specialized by types that do not use bool as their boolean type (e.g. SIMD packs and their masks)
   template<typename T>
-  using _bool_parameter = _parameter_swap<T, bool>;
+  struct _bool_parameter : _parameter_swap<T, bool> {};
 
 
   template<typename T>
@@ -0,0 +1,142 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "rotor_3d.hpp"
+
+#include <limits>
+#include <utility>
+
+
+namespace kmath {
+  // =======================
+  // = Polar decomposition =
+  // =======================
+
+
+  // Coefficient wise select, with a scalar or a pack condition
+  template<Number T, typename B>
+  constexpr _Mat3<T> _select(const B condition, const _Mat3<T> &a, const _Mat3<T> &b) {
+    _Mat3<T> result;
+    for (size_t j = 0; j < 3; j++) {
+      for (size_t i = 0; i < 3; i++) {
+        result(i, j) = select(condition, a(i, j), b(i, j));
+      }
+    }
+    return result;
+  }
+
+
+  // Machine epsilon of the scalar type of T, T being a scalar or a pack
+  template<Number T>
+  constexpr T _machine_epsilon() {
+    if constexpr (requires(const T t) { t.lane(0); }) {
+      return T(std::numeric_limits<decltype(std::declval<T>().lane(0))>::epsilon());
+    } else {
+      return std::numeric_limits<T>::epsilon();
+    }
+  }
+
+
+  // Newton iterations of polar_decompose. Each one roughly doubles the number of correct digits
+  // once close to the rotation, the scaling makes the first ones fast even for large scale ratios.
+  constexpr const size_t POLAR_MAX_ITERATIONS = 12;
+
+
+  // m = rotation * stretch, where rotation is a rotation matrix and stretch is symmetric (scale
+  // and shear, negative if m is a reflection). Uses the Newton iteration
+  // X <- (gamma * X + inverse(transpose(X)) / gamma) / 2, with Frobenius norm scaling.
+  // Works on packs. Singular matrices give the identity rotation, a matrix is considered singular
+  // when |det(m)| <= epsilon * |m|^3 (Frobenius norm), as rounding rarely gives an exact 0.
+  template<Number T>
+  inline void polar_decompose(const _Mat3<T> &m, _Mat3<T> &r_rotation, _Mat3<T> &r_stretch) {
+    const T m_det = determinant(m);
+    const T m_norm_squared = length_squared(m.x) + length_squared(m.y) + length_squared(m.z);
+    const auto singular = lesser_eq(abs(m_det), _machine_epsilon<T>() * m_norm_squared * sqrt(m_norm_squared));
+    // The polar factor of a reflection is not a rotation, -m is decomposed instead
+    const T sign = select(lesser(m_det, T(0)), T(-1), T(1));
+
+    _Mat3<T> x = sign * m;
+    for (size_t i = 0; i < POLAR_MAX_ITERATIONS; i++) {
+      // Cofactors, x^(-T) = cofactors / det
+      const _Mat3<T> cofactors(cross(x.y, x.z), cross(x.z, x.x), cross(x.x, x.y));
+      const T det = select(singular, T(1), dot(x.x, cofactors.x));
+      const T x_norm_squared = length_squared(x.x) + length_squared(x.y) + length_squared(x.z);
+      const T cofactors_norm_squared = length_squared(cofactors.x) + length_squared(cofactors.y) + length_squared(cofactors.z);
+      const T gamma = sqrt(sqrt(cofactors_norm_squared / (det * det * x_norm_squared)));
+
+      const _Mat3<T> next = T(0.5) * (gamma * x + cofactors / (gamma * det));
+      const _Mat3<T> change = next - x;
+      const T change_squared = length_squared(change.x) + length_squared(change.y) + length_squared(change.z);
+      x = next;
+      if (all(lesser_eq(change_squared, T(KMATH_EPSILON2)))) {
+        break;
+      }
+    }
+
+    r_rotation = _select(singular, _Mat3<T>::IDENTITY, x);
+    r_stretch = transpose(r_rotation) * m;
+  }
+
+
+  // ==================
+  // = Decomposition3 =
+  // ==================
+
+
+  // A transform split as translation * rotation * stretch. Meant for converting matrices to
+  // rotors and motors, e.g. for blending, stretch holds the scale and shear.
+  template<Number T>
+  struct _Decomposition3 {
+    _Vec3<T> translation;
+    _Rotor3<T> rotation;
+    _Mat3<T> stretch;
+  };
+
+
+  // The last row of m (projection) is ignored
+  template<Number T>
+  inline _Decomposition3<T> decompose(const _Mat4<T> &m) {
+    _Mat3<T> rotation, stretch;
+    polar_decompose(_Mat3<T>::from_mat4(m), rotation, stretch);
+    return _Decomposition3<T>(m.w.xyz(), _Rotor3<T>::from_basis(rotation), stretch);
+  }
+
+
+  template<Number T>
+  inline _Mat4<T> as_transform(const _Decomposition3<T> &d) {
+    return _Mat4<T>::from_basis(as_basis(d.rotation) * d.stretch, d.translation);
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Decomposition3<float> Decomposition3;
+  typedef _Decomposition3<double> Decomposition3d;
+}
@@ -0,0 +1,58 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include <cstdint>
+
+
+// Runtime selection of the instruction set used by the batch kernels of batch.hpp. The kernels
+// are compiled once per tier (see kmath/batch/), the best tier supported by the CPU is detected
+// on first use and a table of function pointers is installed once.
+//
+// The environment variable KMATH_CPU_TIER (baseline, sse4.2, avx2 or avx512) forces a lower tier,
+// e.g. to compare two tiers with the same benchmark binary. A tier that the CPU does not support
+// is clamped to the detected one, unknown values are ignored.
+namespace kmath {
+  enum class CpuTier: std::uint8_t {
+    BASELINE, // Whatever the library itself is compiled for
+    SSE4_2,
+    AVX2,     // AVX2 + FMA
+    AVX512,   // AVX-512 F + VL + DQ
+  };
+
+
+  // Best tier supported by the CPU, ignores KMATH_CPU_TIER
+  CpuTier detect_cpu_tier();
+
+
+  // Tier used by the batch kernels
+  CpuTier cpu_tier();
+
+
+  // Forces the tier used by the batch kernels, clamped to the detected tier. Returns the tier
+  // actually used. Not meant to be called while batch functions run on other threads.
+  CpuTier set_cpu_tier(const CpuTier tier);
+
+
+  const char *cpu_tier_name(const CpuTier tier);
+}
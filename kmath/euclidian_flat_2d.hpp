@@ -0,0 +1,575 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "vector.hpp"
+#include "private/generated/pga2d.hpp"
+
+
+// Flats of the 2D projective geometric algebra R(2, 0, 1): lines are vectors (e1, e2, e0) and
+// points are bivectors (e20, e01, e12). The products come from generator/specs/pga2d.spec.
+namespace kmath {
+
+
+  // =======================
+  // = Struct declarations =
+  // =======================
+
+
+  template<Number T>
+  struct _Line2 {
+    T e1, e2, e0;
+
+  public:
+    _Line2(): _Line2(T(0), T(0), T(0)) {}
+    _Line2(const T e1, const T e2, const T e0): e1(e1), e2(e2), e0(e0) {}
+
+
+    // The line a * x + b * y = c
+    static inline _Line2<T> line(const T a, const T b, const T c) {
+      return _Line2<T>(a, b, -c);
+    }
+
+
+    static inline _Line2<T> line(const _Vec2<T> &normal, const T distance) {
+      return _Line2<T>(normal.x, normal.y, -distance);
+    }
+
+
+    static inline _Line2<T> line(const _Vec2<T> &point, const _Vec2<T> &normal) {
+      return line(normal, dot(point, normal));
+    }
+
+
+    static inline _Line2<T> vanishing_line(const T delta) {
+      return _Line2<T>(T(0), T(0), -delta);
+    }
+
+
+  public:
+    static const _Line2<T> VANISHING_LINE;
+    // The lines x = 0 and y = 0
+    static const _Line2<T> Y_AXIS;
+    static const _Line2<T> X_AXIS;
+  };
+
+
+  template<Number T> const _Line2<T> _Line2<T>::VANISHING_LINE = _Line2<T>(T(0), T(0), T(1));
+  template<Number T> const _Line2<T> _Line2<T>::Y_AXIS = _Line2<T>(T(1), T(0), T(0));
+  template<Number T> const _Line2<T> _Line2<T>::X_AXIS = _Line2<T>(T(0), T(1), T(0));
+
+
+  template<Number T>
+  struct _Point2 {
+    T e20, e01, e12;
+
+  public:
+    _Point2(): _Point2(T(0), T(0), T(0)) {}
+    _Point2(const T e20, const T e01, const T e12): e20(e20), e01(e01), e12(e12) {}
+
+
+    static inline _Point2<T> point(const _Vec2<T> &p) {
+      return _Point2<T>(p.x, p.y, T(1));
+    }
+
+
+    static inline _Point2<T> point(const T x, const T y) {
+      return _Point2<T>(x, y, T(1));
+    }
+
+
+    static inline _Point2<T> direction(const _Vec2<T> &d) {
+      return _Point2<T>(d.x, d.y, T(0));
+    }
+
+
+    static inline _Point2<T> direction(const T x, const T y) {
+      return _Point2<T>(x, y, T(0));
+    }
+
+  public:
+    static const _Point2<T> ZERO;
+    static const _Point2<T> ORIGIN;
+    static const _Point2<T> X_DIR;
+    static const _Point2<T> Y_DIR;
+  };
+
+
+  template<Number T>
+  const _Point2<T> _Point2<T>::ZERO   = _Point2<T>(T(0), T(0), T(0));
+  template<Number T>
+  const _Point2<T> _Point2<T>::ORIGIN = _Point2<T>(T(0), T(0), T(1));
+  template<Number T>
+  const _Point2<T> _Point2<T>::X_DIR  = _Point2<T>(T(1), T(0), T(0));
+  template<Number T>
+  const _Point2<T> _Point2<T>::Y_DIR  = _Point2<T>(T(0), T(1), T(0));
+
+
+  // ==================
+  // = Line functions =
+  // ==================
+
+
+  template<Number T>
+  inline T magnitude_squared(const _Line2<T> &a) {
+    return a.e1 * a.e1 + a.e2 * a.e2;
+  }
+
+
+  template<Number T>
+  inline T vanishing_magnitude_squared(const _Line2<T> &a) {
+    return a.e0 * a.e0;
+  }
+
+
+  template<Number T>
+  inline T magnitude(const _Line2<T> &a) {
+    return sqrt(magnitude_squared(a));
+  }
+
+
+  template<Number T>
+  inline T vanishing_magnitude(const _Line2<T> &a) {
+    return abs(a.e0);
+  }
+
+
+  template<Number T>
+  inline bool is_vanishing(const _Line2<T> &a) {
+    return is_approx_zero(magnitude_squared(a));
+  }
+
+
+  template<Number T>
+  inline _Line2<T> normalized(const _Line2<T> &a) {
+    if (!is_vanishing(a)) {
+      return a / magnitude(a);
+    } else {
+      return _Line2<T>(T(0), T(0), T(-1));
+    }
+  }
+
+
+  // Intersection of two lines, a direction when they are parallel
+  template<Number T>
+  inline _Point2<T> meet(const _Line2<T> &a, const _Line2<T> &b) {
+    return _pga2_meet<_Point2<T>>(a, b);
+  }
+
+
+  // Cosine of the angle between two normalized lines
+  template<Number T>
+  inline T inner(const _Line2<T> &a, const _Line2<T> &b) {
+    return a.e1 * b.e1 + a.e2 * b.e2;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> reverse(const _Line2<T> &l) {
+    return l;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> inverse(const _Line2<T> &l) {
+    return reverse(l) / magnitude_squared(l);
+  }
+
+
+  template<Number T>
+  inline _Vec2<T> get_normal(const _Line2<T> &l) {
+    return _Vec2<T>(l.e1, l.e2);
+  }
+
+
+  // ==================
+  // = Line operators =
+  // ==================
+
+
+  template<Number T>
+  inline _Line2<T> operator+(const _Line2<T> &a, const _Line2<T> &b) {
+    _Line2<T> res(a);
+    res += b;
+    return res;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> &operator+=(_Line2<T> &a, const _Line2<T> &b) {
+    a.e1 += b.e1;
+    a.e2 += b.e2;
+    a.e0 += b.e0;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> operator-(const _Line2<T> &a, const _Line2<T> &b) {
+    _Line2<T> res(a);
+    res -= b;
+    return res;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> &operator-=(_Line2<T> &a, const _Line2<T> &b) {
+    a.e1 -= b.e1;
+    a.e2 -= b.e2;
+    a.e0 -= b.e0;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> operator-(const _Line2<T> &a) {
+    return _Line2<T>(-a.e1, -a.e2, -a.e0);
+  }
+
+
+  template<Number T>
+  inline _Line2<T> operator*(const T a, const _Line2<T> &b) {
+    return _Line2<T>(a * b.e1, a * b.e2, a * b.e0);
+  }
+
+
+  template<Number T>
+  inline _Line2<T> operator*(const _Line2<T> &a, const T b) {
+    return _Line2<T>(a.e1 * b, a.e2 * b, a.e0 * b);
+  }
+
+
+  template<Number T>
+  inline _Line2<T> &operator*=(_Line2<T> &a, const T b) {
+    a = a * b;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> operator/(const _Line2<T> &a, const T b) {
+    _Line2<T> res(a);
+    res /= b;
+    return res;
+  }
+
+
+  template<Number T>
+  inline _Line2<T> &operator/=(_Line2<T> &a, const T b) {
+    a.e1 /= b;
+    a.e2 /= b;
+    a.e0 /= b;
+    return a;
+  }
+
+
+  // ===================
+  // = Point functions =
+  // ===================
+
+
+  template<Number T>
+  inline _Vec2<T> as_vector(const _Point2<T> &a) {
+    if (!is_vanishing(a)) {
+      return _Vec2<T>(a.e20, a.e01) / a.e12;
+    } else {
+      return _Vec2<T>(a.e20, a.e01);
+    }
+  }
+
+
+  template<Number T>
+  inline T magnitude_squared(const _Point2<T> &a) {
+    return a.e12 * a.e12;
+  }
+
+
+  template<Number T>
+  inline T vanishing_magnitude_squared(const _Point2<T> &a) {
+    return a.e20 * a.e20 + a.e01 * a.e01;
+  }
+
+
+  template<Number T>
+  inline T magnitude(const _Point2<T> &a) {
+    return abs(a.e12);
+  }
+
+
+  template<Number T>
+  inline T vanishing_magnitude(const _Point2<T> &a) {
+    return sqrt(vanishing_magnitude_squared(a));
+  }
+
+
+  template<Number T>
+  inline bool is_vanishing(const _Point2<T> &a) {
+    return is_approx_zero(a.e12);
+  }
+
+
+  template<Number T>
+  inline _Point2<T> normalized(const _Point2<T> &a) {
+    if (!is_vanishing(a)) {
+      return a / a.e12;
+    } else {
+      return a / vanishing_magnitude(a);
+    }
+  }
+
+
+  // Line through two points
+  template<Number T>
+  inline _Line2<T> join(const _Point2<T> &a, const _Point2<T> &b) {
+    return _pga2_join<_Line2<T>>(a, b);
+  }
+
+
+  template<Number T>
+  inline T inner(const _Point2<T> &a, const _Point2<T> &b) {
+    return - a.e12 * b.e12;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> reverse(const _Point2<T> &p) {
+    return -p;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> inverse(const _Point2<T> &p) {
+    return reverse(p) / magnitude_squared(p);
+  }
+
+
+  // ===================
+  // = Point operators =
+  // ===================
+
+
+  template<Number T>
+  inline _Point2<T> operator+(const _Point2<T> &a, const _Point2<T> &b) {
+    _Point2<T> res(a);
+    res += b;
+    return res;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> &operator+=(_Point2<T> &a, const _Point2<T> &b) {
+    a.e20 += b.e20;
+    a.e01 += b.e01;
+    a.e12 += b.e12;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> operator-(const _Point2<T> &a, const _Point2<T> &b) {
+    _Point2<T> res(a);
+    res -= b;
+    return res;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> &operator-=(_Point2<T> &a, const _Point2<T> &b) {
+    a.e20 -= b.e20;
+    a.e01 -= b.e01;
+    a.e12 -= b.e12;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> operator-(const _Point2<T> &a) {
+    return _Point2<T>(-a.e20, -a.e01, -a.e12);
+  }
+
+
+  template<Number T>
+  inline _Point2<T> operator*(const T a, const _Point2<T> &b) {
+    return _Point2<T>(a * b.e20, a * b.e01, a * b.e12);
+  }
+
+
+  template<Number T>
+  inline _Point2<T> operator*(const _Point2<T> &a, const T b) {
+    return _Point2<T>(a.e20 * b, a.e01 * b, a.e12 * b);
+  }
+
+
+  template<Number T>
+  inline _Point2<T> &operator*=(_Point2<T> &a, const T b) {
+    a = a * b;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> operator/(const _Point2<T> &a, const T b) {
+    _Point2<T> res(a);
+    res /= b;
+    return res;
+  }
+
+
+  template<Number T>
+  inline _Point2<T> &operator/=(_Point2<T> &a, const T b) {
+    a.e20 /= b;
+    a.e01 /= b;
+    a.e12 /= b;
+    return a;
+  }
+
+
+  // ========================
+  // = Line-point functions =
+  // ========================
+
+
+  // Signed distance from the line to the point, for a normalized line and point
+  template<Number T>
+  inline T meet(const _Line2<T> &line, const _Point2<T> &point) {
+    return line.e1 * point.e20 + line.e2 * point.e01 + line.e0 * point.e12;
+  }
+
+
+  template<Number T>
+  inline T meet(const _Point2<T> &point, const _Line2<T> &line) {
+    return meet(line, point);
+  }
+
+
+  // Line through the point, orthogonal to the line
+  template<Number T>
+  inline _Line2<T> inner(const _Line2<T> &line, const _Point2<T> &point) {
+    return _pga2_inner<_Line2<T>>(line, point);
+  }
+
+
+  template<Number T>
+  inline _Line2<T> inner(const _Point2<T> &point, const _Line2<T> &line) {
+    return -inner(line, point);
+  }
+
+
+  template<Number T>
+  inline bool is_on(const _Point2<T> &point, const _Line2<T> &line) {
+    return is_approx_zero(meet(line, point));
+  }
+
+
+  // ============================
+  // = Projections & rejections =
+  // ============================
+
+
+  // Fast projection gives a projection modulo a positive factor
+  template<Number T>
+  inline _Line2<T> fast_project(const _Line2<T> &a, const _Point2<T> &b) {
+    return inner(inner(a, b), b);
+  }
+
+
+  // Fast projection gives a projection modulo a positive factor
+  template<Number T>
+  inline _Point2<T> fast_project(const _Point2<T> &a, const _Line2<T> &b) {
+    return meet(inner(b, a), b);
+  }
+
+
+  // Line through b parallel to a
+  template<Number T>
+  inline _Line2<T> project(const _Line2<T> &a, const _Point2<T> &b) {
+    return inner(inner(a, b), inverse(b));
+  }
+
+
+  // Closest point of b to a
+  template<Number T>
+  inline _Point2<T> project(const _Point2<T> &a, const _Line2<T> &b) {
+    return meet(inner(inverse(b), a), b);
+  }
+
+
+  // ===============
+  // = Reflections =
+  // ===============
+
+
+  // Fast reflection gives a reflection modulo a factor, b * a * b
+  template<Number T>
+  inline _Point2<T> fast_reflect(const _Point2<T> &a, const _Line2<T> &b) {
+    return _pga2_reflect_point<_Point2<T>>(b, a);
+  }
+
+
+  template<Number T>
+  inline _Line2<T> fast_reflect(const _Line2<T> &a, const _Line2<T> &b) {
+    return _pga2_reflect_line<_Line2<T>>(b, a);
+  }
+
+
+  template<Number T>
+  inline _Point2<T> reflect(const _Point2<T> &a, const _Line2<T> &b) {
+    return fast_reflect(a, b) / magnitude_squared(b);
+  }
+
+
+  template<Number T>
+  inline _Line2<T> reflect(const _Line2<T> &a, const _Line2<T> &b) {
+    return fast_reflect(a, b) / magnitude_squared(b);
+  }
+
+
+  // ========================
+  // = Comparison functions =
+  // ========================
+
+
+  template<Number T>
+  inline bool is_approx_zero(const _Line2<T> &a) {
+    return is_approx_zero(*reinterpret_cast<const _Vec3<T>*>(&a));
+  }
+
+
+  template<Number T>
+  inline bool is_approx_zero(const _Point2<T> &a) {
+    return is_approx_zero(*reinterpret_cast<const _Vec3<T>*>(&a));
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Line2<float> Line2;
+  typedef _Point2<float> Point2;
+
+  typedef _Line2<double> Line2d;
+  typedef _Point2<double> Point2d;
+}
@@ -24,6 +24,7 @@
 
 #include "base.hpp"
 #include "vector.hpp"
+#include "private/generated/pga3d.hpp"
 
 
 namespace kmath {
@@ -294,14 +295,7 @@ namespace kmath {
 
   template<Number T>
   inline _Line3<T> meet(const _Plane3<T> &a, const _Plane3<T> &b) {
-    return _Line3<T>(
-      a.e2 * b.e3 - a.e3 * b.e2,
-      a.e3 * b.e1 - a.e1 * b.e3,
-      a.e1 * b.e2 - a.e2 * b.e1,
-      a.e0 * b.e1 - a.e1 * b.e0,
-      a.e0 * b.e2 - a.e2 * b.e0,
-      a.e0 * b.e3 - a.e3 * b.e0
-    );
+    return _pga3_meet<_Line3<T>>(a, b);
   }
 
 
@@ -721,14 +715,7 @@ namespace kmath {
 
   template<Number T>
   inline _Line3<T> join(const _Point3<T> &a, const _Point3<T> &b) {
-    return _Line3<T>(
-      a.e032 * b.e123 - a.e123 * b.e032,
-      a.e013 * b.e123 - a.e123 * b.e013,
-      a.e021 * b.e123 - a.e123 * b.e021,
-      a.e021 * b.e013 - a.e013 * b.e021,
-      a.e032 * b.e021 - a.e021 * b.e032,
-      a.e013 * b.e032 - a.e032 * b.e013
-    );
+    return _pga3_join<_Line3<T>>(a, b);
   }
 
 
@@ -862,12 +849,7 @@ namespace kmath {
 
   template<Number T>
   inline _Point3<T> meet(const _Plane3<T> &plane, const _Line3<T> &line) {
-    return _Point3<T>(
-      plane.e2 * line.e03 - plane.e3 * line.e02 - plane.e0 * line.e23,
-      plane.e3 * line.e01 - plane.e1 * line.e03 - plane.e0 * line.e31,
-      plane.e1 * line.e02 - plane.e2 * line.e01 - plane.e0 * line.e12,
-      plane.e1 * line.e23 + plane.e2 * line.e31 + plane.e3 * line.e12
-    );
+    return _pga3_meet_line<_Point3<T>>(plane, line);
   }
 
 
@@ -907,12 +889,7 @@ namespace kmath {
 
   template<Number T>
   inline _Plane3<T> join(const _Line3<T> &line, const _Point3<T> &point) {
-    return _Plane3<T>(
-      line.e01 * point.e123 + line.e31 * point.e021 - line.e12 * point.e013,
-      line.e02 * point.e123 + line.e12 * point.e032 - line.e23 * point.e021,
-      line.e03 * point.e123 + line.e23 * point.e013 - line.e31 * point.e032,
-      -line.e01 * point.e032 - line.e02 * point.e013 - line.e03 * point.e021
-    );
+    return _pga3_join_point<_Plane3<T>>(line, point);
   }
 
 
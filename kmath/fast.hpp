@@ -0,0 +1,266 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "base.hpp"
+#include "concepts.hpp"
+#include "constants.hpp"
+#include "simd.hpp"
+#include "vector.hpp"
+#include "rotor_3d.hpp"
+#include "motor_3d.hpp"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+
+// Approximations trading accuracy for throughput. Nothing else in kmath calls them: they are
+// opted into by writing fast::normalized(v) instead of normalized(v). The error bounds are given
+// for single precision, double precision uses the same approximations and gets the same error.
+//
+// Every function accepts scalars, SIMD packs and vectors of either (applied per component).
+// The rounding tricks rely on IEEE arithmetic and break with -ffast-math.
+namespace kmath::fast {
+  // ===========
+  // = Helpers =
+  // ===========
+
+  template<typename T>
+  struct _lane {
+    using type = T;
+  };
+
+  template<typename T, size_t N>
+  struct _lane<simd::_Pack<T, N>> {
+    using type = T;
+  };
+
+  template<typename T>
+  using _Lane = typename _lane<T>::type;
+
+
+  // Rounds to the nearest integer, ties to even. |x| must be below 2^22 (float) or 2^51 (double)
+  template<Number T>
+  inline T _round(const T x) {
+    constexpr const _Lane<T> MAGIC = (sizeof(_Lane<T>) == 4)? 12582912.0 : 6755399441055744.0;
+    return (x + T(MAGIC)) - T(MAGIC);
+  }
+
+
+  // Estimate of 1 / sqrt(x) with a relative error below 4e-4. Without hardware support, the bit
+  // level initial guess is refined twice to reach the same accuracy.
+  inline float _rsqrt_estimate(const float x) {
+#if KMATH_SIMD_128 && defined(__SSE2__)
+    return _mm_cvtss_f32(_mm_rsqrt_ss(_mm_set_ss(x)));
+#else
+    float y = std::bit_cast<float>(0x5f375a86 - (std::bit_cast<std::int32_t>(x) >> 1));
+    y *= 1.5f - 0.5f * x * y * y;
+    return y * (1.5f - 0.5f * x * y * y);
+#endif
+  }
+
+
+  inline double _rsqrt_estimate(const double x) {
+    return double(_rsqrt_estimate(float(x)));
+  }
+
+
+  template<size_t N>
+  inline simd::_Pack<float, N> _rsqrt_estimate(const simd::_Pack<float, N> &x) {
+    using F = typename simd::_Pack<float, N>::Register;
+    using I = typename simd::_Mask<float, N>::Register;
+#if KMATH_SIMD_512
+    if constexpr(N == 16) {
+      return simd::_Pack<float, N>(std::bit_cast<F>(_mm512_rsqrt14_ps(std::bit_cast<__m512>(x.v))));
+    }
+#endif
+#if KMATH_SIMD_256
+    if constexpr(N == 8) {
+      return simd::_Pack<float, N>(std::bit_cast<F>(_mm256_rsqrt_ps(std::bit_cast<__m256>(x.v))));
+    }
+#endif
+#if KMATH_SIMD_128 && defined(__SSE2__)
+    if constexpr(N == 4) {
+      return simd::_Pack<float, N>(std::bit_cast<F>(_mm_rsqrt_ps(std::bit_cast<__m128>(x.v))));
+    }
+#endif
+    F y = std::bit_cast<F>(0x5f375a86 - (std::bit_cast<I>(x.v) >> 1));
+    y *= 1.5f - 0.5f * x.v * y * y;
+    return simd::_Pack<float, N>(y * (1.5f - 0.5f * x.v * y * y));
+  }
+
+
+  template<size_t N>
+  inline simd::_Pack<double, N> _rsqrt_estimate(const simd::_Pack<double, N> &x) {
+    using F = typename simd::_Pack<float, N>::Register;
+    using D = typename simd::_Pack<double, N>::Register;
+    const simd::_Pack<float, N> estimate = _rsqrt_estimate(simd::_Pack<float, N>(__builtin_convertvector(x.v, F)));
+    return simd::_Pack<double, N>(__builtin_convertvector(estimate.v, D));
+  }
+
+
+  // ===============
+  // = Square root =
+  // ===============
+
+  // 1 / sqrt(a): hardware estimate refined by one Newton step, relative error below 3e-7.
+  // a must be positive and, for doubles, within the float range.
+  template<Number V>
+  inline V rsqrt(const V a) {
+    return apply(a, [](const auto x) {
+      using T = decltype(x);
+      const T y = _rsqrt_estimate(x);
+      return y * (T(1.5) - T(0.5) * x * y * y);
+    });
+  }
+
+
+  // a * rsqrt(a), relative error below 3e-7
+  template<Number V>
+  inline V sqrt(const V a) {
+    return apply(a, [](const auto x) {
+      using T = decltype(x);
+      return select(x == T(0), T(0), x * rsqrt(x));
+    });
+  }
+
+
+  // ===========
+  // = Vectors =
+  // ===========
+
+  template<template<typename> typename VT, Number T>
+  requires SizedVectorTemplate<VT>
+  inline T length(const VT<T> &v) {
+    return fast::sqrt(length_squared(v));
+  }
+
+
+  template<template<typename> typename VT, Number T>
+  requires SizedVectorTemplate<VT>
+  inline VT<T> normalized(const VT<T> &v) {
+    return rsqrt(length_squared(v)) * v;
+  }
+
+
+  template<Number T>
+  inline T length(const _Rotor3<T> &r) {
+    return fast::sqrt(length_squared(r));
+  }
+
+
+  template<Number T>
+  inline _Rotor3<T> normalized(const _Rotor3<T> &r) {
+    return rsqrt(length_squared(r)) * r;
+  }
+
+
+  template<Number T>
+  inline T magnitude(const _Motor3<T> &m) {
+    return fast::sqrt(magnitude_squared(m));
+  }
+
+
+  template<Number T>
+  inline _Motor3<T> normalized(const _Motor3<T> &m) {
+    return rsqrt(magnitude_squared(m)) * m;
+  }
+
+
+  // ===========================
+  // = Trigonometric functions =
+  // ===========================
+
+  // pi = PI_HIGH + PI_LOW, k * PI_HIGH is exact for |k| < 2^16
+  constexpr const double _PI_HIGH = 3.140625;
+  constexpr const double _PI_LOW = 9.676535897932795e-4;
+  constexpr const double _HALF_PI_HIGH = 1.5703125;
+  constexpr const double _HALF_PI_LOW = 4.8382679489661923e-4;
+
+
+  // Minimax polynomial for sin on [-pi / 2, pi / 2], absolute error below 6e-7
+  template<Number T>
+  inline T _sin_reduced(const T r) {
+    const T z = r * r;
+    return r * (((T(-1.83636543e-4) * z + T(8.30632524e-3)) * z + T(-1.66648284e-1)) * z + T(9.99996616e-1));
+  }
+
+
+  // Absolute error below 1e-6 for |a| <= 1e4
+  template<Number V>
+  inline V sin(const V a) {
+    return apply(a, [](const auto x) {
+      using T = decltype(x);
+      // sin(x) = (-1)^k sin(x - k pi)
+      const T k = _round(x * T(1.0 / PI));
+      const T odd = abs(k - T(2) * _round(T(0.5) * k));
+      const T r = (x - k * T(_PI_HIGH)) - k * T(_PI_LOW);
+      return (T(1) - T(2) * odd) * _sin_reduced(r);
+    });
+  }
+
+
+  // Absolute error below 1e-6 for |a| <= 1e4
+  template<Number V>
+  inline V cos(const V a) {
+    return apply(a, [](const auto x) {
+      using T = decltype(x);
+      // cos(x) = -(-1)^k sin(x - k pi - pi / 2)
+      const T k = _round(x * T(1.0 / PI) - T(0.5));
+      const T odd = abs(k - T(2) * _round(T(0.5) * k));
+      const T r = ((x - k * T(_PI_HIGH)) - T(_HALF_PI_HIGH)) - (k * T(_PI_LOW) + T(_HALF_PI_LOW));
+      return (T(2) * odd - T(1)) * _sin_reduced(r);
+    });
+  }
+
+
+  // Absolute error below 6e-6 on [-1, 1]
+  template<Number V>
+  inline V acos(const V a) {
+    return apply(a, [](const auto x) {
+      using T = decltype(x);
+      // acos(x) = sqrt(1 - x) p(x) on [0, 1] and acos(-x) = pi - acos(x)
+      const T ax = abs(x);
+      const T p = (((T(9.73296607e-3) * ax + T(-3.76182117e-2)) * ax + T(8.5638375e-2)) * ax + T(-2.14280611e-1)) * ax + T(1.57079153);
+      const T angle = fast::sqrt(T(1) - ax) * p;
+      return select(x < T(0), T(PI) - angle, angle);
+    });
+  }
+
+
+  // Absolute error below 2e-6, atan2(0, 0) = 0
+  template<Number V>
+  inline V atan2(const V y, const V x) {
+    return apply(y, x, [](const auto y, const auto x) {
+      using T = decltype(y);
+      // Minimax polynomial for atan on [0, 1], then reflections to the right octant
+      const T ax = abs(x);
+      const T ay = abs(y);
+      const T high = max(ax, ay);
+      const T q = select(high == T(0), T(0), min(ax, ay) / high);
+      const T z = q * q;
+      const T octant = q * (((((T(-1.17191346e-2) * z + T(5.2647349e-2)) * z + T(-1.1642648e-1)) * z + T(1.93540376e-1)) * z + T(-3.32622828e-1)) * z + T(9.99977219e-1));
+      const T quadrant = select(ay > ax, T(HALF_PI) - octant, octant);
+      const T angle = select(x < T(0), T(PI) - quadrant, quadrant);
+      return select(sign_bit(y), -angle, angle);
+    });
+  }
+}
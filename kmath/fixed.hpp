@@ -0,0 +1,565 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "base.hpp"
+#include "concepts.hpp"
+
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+
+// Fixed point numbers for deterministic computations: every operation is done with integer
+// arithmetic, so the results are bit identical on every compiler and platform. _Fixed<I, F>
+// stores a value v as the integer round(v * 2^F), q16_16 and q32_32 are the usual formats.
+//
+// The type satisfies the Number concept, and sqrt, sin, cos and atan2 (and the functions built
+// on them) have deterministic overloads, so _Vec3<q16_16>, _Rotor3<q16_16> or _Motor3<q32_32>
+// can be instantiated. Additions and subtractions wrap around on overflow, products and
+// quotients are computed on twice the width and also wrap around when the result does not fit.
+//
+// Functions that have no fixed point implementation (exp, ln, pow...) are deleted, so that using
+// them fails at compile time.
+namespace kmath {
+  // ============
+  // = Wide int =
+  // ============
+
+  template<typename I>
+  struct _fixed_wide {};
+
+  template<>
+  struct _fixed_wide<std::int32_t> {
+    using type = std::int64_t;
+    using unsigned_type = std::uint64_t;
+  };
+
+  template<>
+  struct _fixed_wide<std::int64_t> {
+    using type = __int128;
+    using unsigned_type = unsigned __int128;
+  };
+
+  template<typename I>
+  using _FixedWide = typename _fixed_wide<I>::type;
+
+  template<typename I>
+  using _FixedUnsignedWide = typename _fixed_wide<I>::unsigned_type;
+
+
+  // ===============
+  // = Fixed point =
+  // ===============
+
+  template<Integer I, size_t F>
+  requires std::is_signed_v<I> && (F > 0) && (F < sizeof(I) * 8 - 1)
+  struct _Fixed {
+    using Wide = _FixedWide<I>;
+    using Unsigned = std::make_unsigned_t<I>;
+
+    I raw = 0;
+
+  public:
+    constexpr _Fixed() = default;
+
+    template<Integer S>
+    constexpr explicit _Fixed(const S s): raw(I(Unsigned(s) << F)) {}
+
+    // Rounds to the nearest representable value, the conversion is exact for dyadic constants
+    // such as 0.5 or 0.25
+    template<FloatingPoint S>
+    constexpr explicit _Fixed(const S s): raw(I(Wide((double(s) * double(Wide(1) << F)) + ((s < S(0))? -0.5 : 0.5)))) {}
+
+
+    static constexpr _Fixed from_raw(const I raw) {
+      _Fixed f;
+      f.raw = raw;
+      return f;
+    }
+
+
+    template<FloatingPoint S>
+    constexpr explicit operator S() const {
+      return S(double(raw) / double(Wide(1) << F));
+    }
+
+
+    // Truncates toward negative infinity
+    template<Integer S>
+    constexpr explicit operator S() const {
+      return S(raw >> F);
+    }
+
+  public:
+    constexpr _Fixed &operator+=(const _Fixed other) {
+      raw = I(Unsigned(raw) + Unsigned(other.raw));
+      return *this;
+    }
+
+
+    constexpr _Fixed &operator-=(const _Fixed other) {
+      raw = I(Unsigned(raw) - Unsigned(other.raw));
+      return *this;
+    }
+
+
+    // Rounds to nearest, ties toward positive infinity
+    constexpr _Fixed &operator*=(const _Fixed other) {
+      raw = I((Wide(raw) * Wide(other.raw) + (Wide(1) << (F - 1))) >> F);
+      return *this;
+    }
+
+
+    // Truncates toward zero, a division by zero saturates to the largest value of the sign of
+    // the numerator (0 / 0 = 0)
+    constexpr _Fixed &operator/=(const _Fixed other) {
+      if (other.raw == 0) {
+        raw = (raw > 0)? std::numeric_limits<I>::max() : ((raw < 0)? std::numeric_limits<I>::min() : I(0));
+      } else {
+        raw = I((Wide(raw) << F) / Wide(other.raw));
+      }
+      return *this;
+    }
+
+
+    constexpr auto operator<=>(const _Fixed &other) const = default;
+
+  public:
+    static constexpr const size_t FRACTION = F;
+  };
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> operator+(_Fixed<I, F> a, const _Fixed<I, F> b) {
+    return a += b;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> operator-(_Fixed<I, F> a, const _Fixed<I, F> b) {
+    return a -= b;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> operator*(_Fixed<I, F> a, const _Fixed<I, F> b) {
+    return a *= b;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> operator/(_Fixed<I, F> a, const _Fixed<I, F> b) {
+    return a /= b;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> operator+(const _Fixed<I, F> a) {
+    return a;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> operator-(const _Fixed<I, F> a) {
+    return _Fixed<I, F>::from_raw(I(-std::make_unsigned_t<I>(a.raw)));
+  }
+
+
+  // ==========================
+  // = Mathematical Functions =
+  // ==========================
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> min(const _Fixed<I, F> a, const _Fixed<I, F> b) {
+    return (b < a)? b : a;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> max(const _Fixed<I, F> a, const _Fixed<I, F> b) {
+    return (a < b)? b : a;
+  }
+
+
+  // Same sign as a, like std::fmod
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> mod(const _Fixed<I, F> a, const _Fixed<I, F> b) {
+    return _Fixed<I, F>::from_raw((b.raw == 0)? I(0) : I(a.raw % b.raw));
+  }
+
+
+  // Quotient rounded to nearest, ties to even, like std::remainder
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> remainder(const _Fixed<I, F> a, const _Fixed<I, F> b) {
+    using W = _FixedWide<I>;
+    if (b.raw == 0) {
+      return _Fixed<I, F>();
+    }
+
+    const W divisor = (b.raw < 0)? -W(b.raw) : W(b.raw);
+    W r = W(a.raw) % divisor;
+    const bool odd_quotient = ((W(a.raw) / divisor) & 1) != 0;
+    const W twice = 2 * ((r < 0)? -r : r);
+    if (twice > divisor || (twice == divisor && odd_quotient)) {
+      r += (r < 0)? divisor : -divisor;
+    }
+    return _Fixed<I, F>::from_raw(I(r));
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> fma(const _Fixed<I, F> a, const _Fixed<I, F> b, const _Fixed<I, F> c) {
+    return a * b + c;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> floor(const _Fixed<I, F> a) {
+    return _Fixed<I, F>::from_raw(I(a.raw & ~((I(1) << F) - 1)));
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> ceil(const _Fixed<I, F> a) {
+    return -floor(-a);
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> trunc(const _Fixed<I, F> a) {
+    return (a.raw < 0)? ceil(a) : floor(a);
+  }
+
+
+  // Ties away from zero, like std::round
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> round(const _Fixed<I, F> a) {
+    const _Fixed<I, F> half = _Fixed<I, F>::from_raw(I(1) << (F - 1));
+    return (a.raw < 0)? -floor(half - a) : floor(a + half);
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> sqrt(const _Fixed<I, F> a) {
+    using U = _FixedUnsignedWide<I>;
+    if (a.raw <= 0) {
+      return _Fixed<I, F>();
+    }
+
+    // Integer square root of raw * 2^F, rounded to nearest
+    U remainder = U(a.raw) << F;
+    U root = 0;
+    U bit = U(1) << (sizeof(U) * 8 - 2);
+    while (bit > remainder) {
+      bit >>= 2;
+    }
+    while (bit != 0) {
+      if (remainder >= root + bit) {
+        remainder -= root + bit;
+        root = (root >> 1) + bit;
+      } else {
+        root >>= 1;
+      }
+      bit >>= 2;
+    }
+    if (remainder > root) {
+      root++;
+    }
+    return _Fixed<I, F>::from_raw(I(root));
+  }
+
+
+  // Exponentiation by squaring, negative exponents give the inverse of the result
+  template<Integer I, size_t F, Integer E>
+  constexpr _Fixed<I, F> pow(const _Fixed<I, F> a, const E b) {
+    _Fixed<I, F> result = _Fixed<I, F>(1);
+    _Fixed<I, F> base = a;
+    std::make_unsigned_t<E> n = (b < 0)? -std::make_unsigned_t<E>(b) : std::make_unsigned_t<E>(b);
+    while (n != 0) {
+      if (n & 1) {
+        result *= base;
+      }
+      base *= base;
+      n >>= 1;
+    }
+    return (b < 0)? _Fixed<I, F>(1) / result : result;
+  }
+
+
+  // ===========================
+  // = Trigonometric functions =
+  // ===========================
+
+  // The trigonometric functions use CORDIC on 64 bit integers with 60 fractional bits, the
+  // results are within one unit in the last place of the fixed point format. They run F + 4
+  // iterations, so the format may have at most _CORDIC_MAX_FRACTION fractional bits.
+
+  constexpr const size_t _CORDIC_MAX_FRACTION = 56;
+
+  constexpr const std::int64_t _CORDIC_PI = 3622009729038561421;
+  constexpr const std::int64_t _CORDIC_HALF_PI = 1811004864519280711;
+  constexpr const std::int64_t _CORDIC_TAU = 7244019458077122842;
+  // Inverse of the CORDIC gain, prod(1 / sqrt(1 + 2^-2i))
+  constexpr const std::int64_t _CORDIC_INV_GAIN = 700114967507363238;
+
+  // atan(2^-i), equal to 2^-i from i = 20 on at this precision
+  constexpr const std::int64_t _CORDIC_ATAN[20] = {
+    905502432259640355, 534549298976576474, 282441168888798124, 143371547418228444,
+    71963988336308046, 36017075762092179, 18012932708689205, 9007016009513623,
+    4503576721087964, 2251796950380271, 1125899548928887, 562949908682076,
+    281474971118251, 140737487656277, 70368744090283, 35184372077909,
+    17592186043051, 8796093022037, 4398046511083, 2199023255549,
+  };
+
+
+  constexpr std::int64_t _cordic_atan(const size_t i) {
+    return (i < 20)? _CORDIC_ATAN[i] : (std::int64_t(1) << (60 - i));
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> _from_cordic(const std::int64_t v) {
+    static_assert(F <= _CORDIC_MAX_FRACTION, "too many fractional bits for the CORDIC functions");
+    return _Fixed<I, F>::from_raw(I((v + (std::int64_t(1) << (59 - F))) >> (60 - F)));
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr void sincos(const _Fixed<I, F> a, _Fixed<I, F> &sin_a, _Fixed<I, F> &cos_a) {
+    static_assert(F <= _CORDIC_MAX_FRACTION, "too many fractional bits for the CORDIC functions");
+    // Reduction to [-pi, pi[, then to [-pi / 2, pi / 2]
+    __int128 wide = (__int128(a.raw) << (60 - F)) % _CORDIC_TAU;
+    if (wide < 0) {
+      wide += _CORDIC_TAU;
+    }
+    std::int64_t angle = std::int64_t(wide);
+    if (angle >= _CORDIC_PI) {
+      angle -= _CORDIC_TAU;
+    }
+    bool flip = false;
+    if (angle > _CORDIC_HALF_PI) {
+      angle -= _CORDIC_PI;
+      flip = true;
+    } else if (angle < -_CORDIC_HALF_PI) {
+      angle += _CORDIC_PI;
+      flip = true;
+    }
+
+    std::int64_t x = _CORDIC_INV_GAIN;
+    std::int64_t y = 0;
+    for (size_t i = 0; i < F + 4; i++) {
+      const std::int64_t dx = y >> i;
+      const std::int64_t dy = x >> i;
+      if (angle >= 0) {
+        x -= dx;
+        y += dy;
+        angle -= _cordic_atan(i);
+      } else {
+        x += dx;
+        y -= dy;
+        angle += _cordic_atan(i);
+      }
+    }
+
+    sin_a = _from_cordic<I, F>(flip? -y : y);
+    cos_a = _from_cordic<I, F>(flip? -x : x);
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> sin(const _Fixed<I, F> a) {
+    _Fixed<I, F> sin_a, cos_a;
+    sincos(a, sin_a, cos_a);
+    return sin_a;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> cos(const _Fixed<I, F> a) {
+    _Fixed<I, F> sin_a, cos_a;
+    sincos(a, sin_a, cos_a);
+    return cos_a;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> tan(const _Fixed<I, F> a) {
+    _Fixed<I, F> sin_a, cos_a;
+    sincos(a, sin_a, cos_a);
+    return sin_a / cos_a;
+  }
+
+
+  // atan2(0, 0) = 0
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> atan2(const _Fixed<I, F> y, const _Fixed<I, F> x) {
+    static_assert(F <= _CORDIC_MAX_FRACTION, "too many fractional bits for the CORDIC functions");
+    if (x.raw == 0 && y.raw == 0) {
+      return _Fixed<I, F>();
+    }
+
+    // Scales the vector so that its largest coordinate is in [2^58, 2^59[, then rotates it by
+    // pi to the right half plane
+    const std::uint64_t abs_x = (x.raw < 0)? -std::uint64_t(x.raw) : std::uint64_t(x.raw);
+    const std::uint64_t abs_y = (y.raw < 0)? -std::uint64_t(y.raw) : std::uint64_t(y.raw);
+    const int width = std::bit_width((abs_x > abs_y)? abs_x : abs_y);
+    std::int64_t vx = std::int64_t((width > 59)? (abs_x >> (width - 59)) : (abs_x << (59 - width)));
+    std::int64_t vy = std::int64_t((width > 59)? (abs_y >> (width - 59)) : (abs_y << (59 - width)));
+    std::int64_t angle = 0;
+    if (y.raw < 0) {
+      vy = -vy;
+    }
+    if (x.raw < 0) {
+      vy = -vy;
+      angle = (y.raw < 0)? -_CORDIC_PI : _CORDIC_PI;
+    }
+
+    for (size_t i = 0; i < F + 4; i++) {
+      const std::int64_t dx = vy >> i;
+      const std::int64_t dy = vx >> i;
+      if (vy >= 0) {
+        vx += dx;
+        vy -= dy;
+        angle += _cordic_atan(i);
+      } else {
+        vx -= dx;
+        vy += dy;
+        angle -= _cordic_atan(i);
+      }
+    }
+
+    return _from_cordic<I, F>(angle);
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> atan(const _Fixed<I, F> a) {
+    return atan2(a, _Fixed<I, F>(1));
+  }
+
+
+  // The input is clamped to [-1, 1]
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> asin(const _Fixed<I, F> a) {
+    const _Fixed<I, F> one = _Fixed<I, F>(1);
+    const _Fixed<I, F> x = min(max(a, -one), one);
+    return atan2(x, sqrt((one - x) * (one + x)));
+  }
+
+
+  // The input is clamped to [-1, 1]
+  template<Integer I, size_t F>
+  constexpr _Fixed<I, F> acos(const _Fixed<I, F> a) {
+    const _Fixed<I, F> one = _Fixed<I, F>(1);
+    const _Fixed<I, F> x = min(max(a, -one), one);
+    return atan2(sqrt((one - x) * (one + x)), x);
+  }
+
+
+  // ==================
+  // = Classification =
+  // ==================
+
+  template<Integer I, size_t F>
+  constexpr bool is_finite(const _Fixed<I, F>) {
+    return true;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr bool is_infinite(const _Fixed<I, F>) {
+    return false;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr bool is_nan(const _Fixed<I, F>) {
+    return false;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr bool is_normal_number(const _Fixed<I, F> a) {
+    return a.raw != 0;
+  }
+
+
+  template<Integer I, size_t F>
+  constexpr bool sign_bit(const _Fixed<I, F> a) {
+    return a.raw < 0;
+  }
+
+
+  // =====================
+  // = Deleted functions =
+  // =====================
+
+  template<Integer I, size_t F>
+  _Fixed<I, F> exp(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> exp2(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> expm1(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> ln(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> log10(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> log2(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> ln1p(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> cbrt(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> sinh(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> cosh(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> tanh(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> asinh(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> acosh(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> atanh(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> erf(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> erfc(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> tgamma(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> lngamma(const _Fixed<I, F> a) = delete;
+  template<Integer I, size_t F>
+  _Fixed<I, F> pow(const _Fixed<I, F> a, const _Fixed<I, F> b) = delete;
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+  typedef _Fixed<std::int32_t, 16> q16_16;
+  typedef _Fixed<std::int64_t, 32> q32_32;
+}
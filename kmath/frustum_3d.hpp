@@ -0,0 +1,167 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "euclidian_flat_3d.hpp"
+
+
+namespace kmath {
+  // ====================
+  // = Bounding volumes =
+  // ====================
+
+
+  template<Number T>
+  struct _Sphere3 {
+    _Vec3<T> center;
+    T radius;
+  };
+
+
+  // Axis aligned bounding box
+  template<Number T>
+  struct _Aabb3 {
+    _Vec3<T> min;
+    _Vec3<T> max;
+  };
+
+
+  // ============
+  // = Frustum3 =
+  // ============
+
+
+  // The six planes of a view frustum, normalized and oriented so that the inside of the frustum is
+  // on their positive side.
+  template<Number T>
+  struct _Frustum3 {
+    _Plane3<T> planes[6];
+
+  public:
+    // Extracts the planes of a projection (or projection * view) matrix with an ndc depth that
+    // goes from negative one to one, like the *_no_ndc builders.
+    static inline _Frustum3<T> from_projection_no_ndc(const _Mat4<T> &m) {
+      return _from_rows(m, _row(m, 3) + _row(m, 2), T(0));
+    }
+
+
+    // Extracts the planes of a projection (or projection * view) matrix with an ndc depth that
+    // goes from zero to one, like the *_zo_ndc builders. With a reversed depth, NEAR_PLANE and
+    // FAR_PLANE are swapped.
+    static inline _Frustum3<T> from_projection_zo_ndc(const _Mat4<T> &m) {
+      return _from_rows(m, _row(m, 2), T(0.5));
+    }
+
+  private:
+    static constexpr _Vec4<T> _row(const _Mat4<T> &m, const size_t i) {
+      return _Vec4<T>(m.x[i], m.y[i], m.z[i], m.w[i]);
+    }
+
+
+    // Clip space planes (Gribb & Hartmann). They face the inside of the frustum where the clip
+    // space w is positive, when it is negative (like with the *_zo_ndc perspectives) they are
+    // flipped: the center of the ndc volume is unprojected to find that sign.
+    static inline _Frustum3<T> _from_rows(const _Mat4<T> &m, const _Vec4<T> &near_row, const T center_depth) {
+      const _Vec4<T> w_row = _row(m, 3);
+      const _Vec4<T> rows[6] = {
+        w_row + _row(m, 0), w_row - _row(m, 0),
+        w_row + _row(m, 1), w_row - _row(m, 1),
+        near_row, w_row - _row(m, 2),
+      };
+      const T sign = ((inverse(m) * _Vec4<T>(T(0), T(0), center_depth, T(1))).w < T(0))? T(-1) : T(1);
+
+      _Frustum3<T> result;
+      for (size_t i = 0; i < 6; i++) {
+        const _Plane3<T> plane(rows[i].x, rows[i].y, rows[i].z, rows[i].w);
+        // A vanishing plane (at infinity) keeps everything
+        result.planes[i] = is_vanishing(plane)? _Plane3<T>(T(0), T(0), T(0), T(1)) : sign * plane / magnitude(plane);
+      }
+      return result;
+    }
+
+  public:
+    constexpr _Plane3<T> &operator[](const size_t i) { return planes[i]; }
+    constexpr const _Plane3<T> &operator[](const size_t i) const { return planes[i]; }
+
+  public:
+    static constexpr const size_t LEFT_PLANE = 0;
+    static constexpr const size_t RIGHT_PLANE = 1;
+    static constexpr const size_t BOTTOM_PLANE = 2;
+    static constexpr const size_t TOP_PLANE = 3;
+    static constexpr const size_t NEAR_PLANE = 4;
+    static constexpr const size_t FAR_PLANE = 5;
+  };
+
+
+  // Signed distance of a point to a normalized plane, positive on the side of its normal
+  template<Number T>
+  inline T signed_distance(const _Plane3<T> &plane, const _Vec3<T> &point) {
+    return plane.e1 * point.x + plane.e2 * point.y + plane.e3 * point.z + plane.e0;
+  }
+
+
+  // Whether the sphere intersects the frustum. Conservative: spheres outside of the frustum but
+  // close to one of its edges are kept.
+  template<Number T>
+  inline bool is_visible(const _Frustum3<T> &frustum, const _Sphere3<T> &sphere) {
+    bool visible = true;
+    for (size_t i = 0; i < 6; i++) {
+      visible &= signed_distance(frustum[i], sphere.center) >= -sphere.radius;
+    }
+    return visible;
+  }
+
+
+  // Whether the box intersects the frustum. Conservative like for spheres: the box is kept when
+  // its corner furthest along each plane normal is inside.
+  template<Number T>
+  inline bool is_visible(const _Frustum3<T> &frustum, const _Aabb3<T> &box) {
+    const _Vec3<T> center = T(0.5) * (box.min + box.max);
+    const _Vec3<T> extents = T(0.5) * (box.max - box.min);
+    bool visible = true;
+    for (size_t i = 0; i < 6; i++) {
+      const _Plane3<T> &plane = frustum[i];
+      const T radius = abs(plane.e1) * extents.x + abs(plane.e2) * extents.y + abs(plane.e3) * extents.z;
+      visible &= signed_distance(plane, center) >= -radius;
+    }
+    return visible;
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Sphere3<float> Sphere3;
+  typedef _Sphere3<double> Sphere3d;
+
+  typedef _Aabb3<float> Aabb3;
+  typedef _Aabb3<double> Aabb3d;
+
+  typedef _Frustum3<float> Frustum3;
+  typedef _Frustum3<double> Frustum3d;
+}
@@ -0,0 +1,580 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "motor_3d.hpp"
+#include "pga_3d.hpp"
+#include "rotor_3d.hpp"
+#include "vector.hpp"
+#include "private/mvec3_terms.hpp"
+#include "private/unroll.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+
+
+// Multivectors of 3D PGA that only store the blades of some grades. The grades are a mask known
+// at compile time, bit g being set when the blades of grade g are stored:
+//
+//   _GradedMvec3<float, MVEC3_GRADES<1>>       a plane
+//   _GradedMvec3<float, MVEC3_GRADES<0, 2, 4>> a motor
+//
+// Products only compute the terms between stored blades, and the grades of their result are
+// deduced from the Cayley table of the algebra: a plane || a point is a line, computed without the
+// zero terms of the dense _Mvec3 product. The blades, their order and the products are those of
+// _Mvec3, as_mvec converts back to a dense multivector.
+namespace kmath {
+  // =================
+  // = Cayley tables =
+  // =================
+
+
+  // Grade mask of the given grades, MVEC3_GRADES<1, 3> stores vectors and trivectors
+  template<unsigned... G>
+  constexpr const unsigned MVEC3_GRADES = (0u | ... | (1u << G));
+
+  constexpr const unsigned MVEC3_ALL_GRADES = MVEC3_GRADES<0, 1, 2, 3, 4>;
+
+
+  constexpr bool _mvec3_has(const unsigned grades, const size_t blade) {
+    return (grades >> _mvec3_grade(blade)) & 1u;
+  }
+
+
+  // Position of a blade in the storage of a mask, the blades of _Mvec3 being sorted by grade
+  constexpr size_t _mvec3_slot(const unsigned grades, const size_t blade) {
+    size_t slot = 0;
+    for (size_t b = 0; b < blade; b++) {
+      slot += _mvec3_has(grades, b);
+    }
+    return slot;
+  }
+
+
+  constexpr size_t _mvec3_size(const unsigned grades) {
+    return _mvec3_slot(grades, 16);
+  }
+
+
+  // Grades of the Hodge dual, g becoming 4 - g
+  constexpr unsigned _mvec3_dual_grades(const unsigned grades) {
+    unsigned dual = 0;
+    for (unsigned g = 0; g <= 4; g++) {
+      dual |= ((grades >> g) & 1u) << (4 - g);
+    }
+    return dual;
+  }
+
+
+  // Blades of the grades of a mask, bit i being blade i of _Mvec3. The term tables work on blade
+  // masks so that a product can be restricted to single blades.
+  constexpr unsigned _mvec3_blade_mask(const unsigned grades) {
+    unsigned blades = 0;
+    for (size_t blade = 0; blade < 16; blade++) {
+      blades |= unsigned(_mvec3_has(grades, blade)) << blade;
+    }
+    return blades;
+  }
+
+
+  // Whether the product of a blade of a and a blade of b contributes to the output blades
+  constexpr bool _mvec3_is_term(const _Mvec3Term &term, const unsigned a_blades, const unsigned b_blades, const unsigned output_blades) {
+    return term.sign != 0 && ((a_blades >> term.a) & 1u) && ((b_blades >> term.b) & 1u) && ((output_blades >> term.result) & 1u);
+  }
+
+
+  constexpr size_t _mvec3_term_count(const _Mvec3Product product, const unsigned a_blades, const unsigned b_blades, const unsigned output_blades) {
+    size_t count = 0;
+    for (size_t i = 0; i < 16; i++) {
+      for (size_t j = 0; j < 16; j++) {
+        count += _mvec3_is_term(_mvec3_term(product, i, j), a_blades, b_blades, output_blades);
+      }
+    }
+    return count;
+  }
+
+
+  // Blades of the result of a product, r_a and r_b receiving the blades of the operands it uses
+  constexpr unsigned _mvec3_product_blades(const _Mvec3Product product, const unsigned a_blades, const unsigned b_blades, const unsigned output_blades, unsigned &r_a, unsigned &r_b) {
+    unsigned blades = 0;
+    r_a = 0;
+    r_b = 0;
+    for (size_t i = 0; i < 16; i++) {
+      for (size_t j = 0; j < 16; j++) {
+        const _Mvec3Term term = _mvec3_term(product, i, j);
+        if (_mvec3_is_term(term, a_blades, b_blades, output_blades)) {
+          blades |= 1u << term.result;
+          r_a |= 1u << term.a;
+          r_b |= 1u << term.b;
+        }
+      }
+    }
+    return blades;
+  }
+
+
+  // Grades of the result of a product between multivectors of grades a and b
+  constexpr unsigned _mvec3_product_grades(const _Mvec3Product product, const unsigned a, const unsigned b, const unsigned output) {
+    unsigned a_blades = 0;
+    unsigned b_blades = 0;
+    const unsigned blades = _mvec3_product_blades(product, _mvec3_blade_mask(a), _mvec3_blade_mask(b), _mvec3_blade_mask(output), a_blades, b_blades);
+    unsigned grades = 0;
+    for (size_t blade = 0; blade < 16; blade++) {
+      grades |= ((blades >> blade) & 1u) << _mvec3_grade(blade);
+    }
+    return grades;
+  }
+
+
+  // Terms of a product, grouped by result blade, positive terms first so that the first term of a
+  // blade is only negated when all of them are
+  template<_Mvec3Product PRODUCT, unsigned A_BLADES, unsigned B_BLADES, unsigned OUTPUT_BLADES>
+  constexpr std::array<_Mvec3Term, _mvec3_term_count(PRODUCT, A_BLADES, B_BLADES, OUTPUT_BLADES)> _mvec3_terms() {
+    std::array<_Mvec3Term, _mvec3_term_count(PRODUCT, A_BLADES, B_BLADES, OUTPUT_BLADES)> terms{};
+    size_t count = 0;
+    for (size_t result = 0; result < 16; result++) {
+      for (const int sign: { 1, -1 }) {
+        for (size_t i = 0; i < 16; i++) {
+          for (size_t j = 0; j < 16; j++) {
+            const _Mvec3Term term = _mvec3_term(PRODUCT, i, j);
+            if (_mvec3_is_term(term, A_BLADES, B_BLADES, OUTPUT_BLADES) && term.result == result && term.sign == sign) {
+              terms[count++] = term;
+            }
+          }
+        }
+      }
+    }
+    return terms;
+  }
+
+
+  template<_Mvec3Product PRODUCT, unsigned A_BLADES, unsigned B_BLADES, unsigned OUTPUT_BLADES>
+  constexpr const auto _MVEC3_TERMS = _mvec3_terms<PRODUCT, A_BLADES, B_BLADES, OUTPUT_BLADES>();
+
+
+  // Stored blades of a mask
+  template<unsigned GRADES>
+  constexpr std::array<size_t, _mvec3_size(GRADES)> _mvec3_blades() {
+    std::array<size_t, _mvec3_size(GRADES)> blades{};
+    for (size_t blade = 0; blade < 16; blade++) {
+      if (_mvec3_has(GRADES, blade)) {
+        blades[_mvec3_slot(GRADES, blade)] = blade;
+      }
+    }
+    return blades;
+  }
+
+
+  template<unsigned GRADES>
+  constexpr const auto _MVEC3_BLADES = _mvec3_blades<GRADES>();
+
+
+  // ==================
+  // = Graded product =
+  // ==================
+
+
+  template<Number T, unsigned GRADES>
+  struct _GradedMvec3;
+
+
+  // Only the terms between stored blades whose result is in the grades of OUTPUT are computed,
+  // each result blade is initialized with its first term
+  template<_Mvec3Product PRODUCT, unsigned OUTPUT, Number T, unsigned A, unsigned B>
+  constexpr _GradedMvec3<T, _mvec3_product_grades(PRODUCT, A, B, OUTPUT)> _product(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    constexpr const unsigned GRADES = _mvec3_product_grades(PRODUCT, A, B, OUTPUT);
+    constexpr const auto &TERMS = _MVEC3_TERMS<PRODUCT, _mvec3_blade_mask(A), _mvec3_blade_mask(B), _mvec3_blade_mask(OUTPUT)>;
+    _GradedMvec3<T, GRADES> res;
+    _unroll<0, TERMS.size()>([&]<size_t i>() {
+      constexpr const _Mvec3Term TERM = TERMS[i];
+      constexpr const size_t SLOT = _mvec3_slot(GRADES, TERM.result);
+      const T product = a.data[_mvec3_slot(A, TERM.a)] * b.data[_mvec3_slot(B, TERM.b)];
+      if constexpr (i == 0 || TERMS[i - 1].result != TERM.result) {
+        if constexpr (TERM.sign > 0) {
+          res.data[SLOT] = product;
+        } else {
+          res.data[SLOT] = -product;
+        }
+      } else if constexpr (TERM.sign > 0) {
+        res.data[SLOT] += product;
+      } else {
+        res.data[SLOT] -= product;
+      }
+    });
+    return res;
+  }
+
+
+  // =======================
+  // = Graded multivector =
+  // =======================
+
+
+  template<Number T, unsigned GRADES>
+  struct _GradedMvec3 {
+    static_assert(GRADES <= MVEC3_ALL_GRADES, "a multivector of 3D PGA has grades 0 to 4");
+
+    using Basis = typename _Mvec3<T>::Basis;
+
+    static constexpr const size_t SIZE = _mvec3_size(GRADES);
+
+    // Coefficients of the stored blades, in the order of _Mvec3
+    std::array<T, SIZE> data{};
+
+  public:
+    // Whether the blade is stored, the others are zero
+    static constexpr bool has(const Basis blade) {
+      return _mvec3_has(GRADES, size_t(blade));
+    }
+
+
+    constexpr T operator[](const Basis blade) const {
+      return has(blade)? data[_mvec3_slot(GRADES, size_t(blade))] : T(0);
+    }
+
+
+    template<unsigned G>
+    constexpr _GradedMvec3<T, GRADES & MVEC3_GRADES<G>> grade() const {
+      return _GradedMvec3<T, GRADES & MVEC3_GRADES<G>>(*this);
+    }
+
+
+    // Hodge dual
+    constexpr _GradedMvec3<T, _mvec3_dual_grades(GRADES)> hdual() const {
+      _GradedMvec3<T, _mvec3_dual_grades(GRADES)> res;
+      _unroll<0, SIZE>([&]<size_t i>() {
+        res.data[_mvec3_slot(_mvec3_dual_grades(GRADES), 15 - _MVEC3_BLADES<GRADES>[i])] = data[i];
+      });
+      return res;
+    }
+
+
+    // Reverse
+    constexpr _GradedMvec3 rev() const {
+      return _negated<MVEC3_GRADES<2, 3>>();
+    }
+
+
+    // Clifford conjugate
+    constexpr _GradedMvec3 conj() const {
+      return _negated<MVEC3_GRADES<1, 2>>();
+    }
+
+
+    constexpr T norm() const {
+      return sqrt(norm_squared());
+    }
+
+
+    constexpr T inorm() const {
+      return sqrt(inorm_squared());
+    }
+
+
+    // Only the scalar part of the product is computed
+    constexpr T norm_squared() const {
+      return _product<_Mvec3Product::GEOMETRIC, MVEC3_GRADES<0>>(*this, rev())[Basis::s];
+    }
+
+
+    constexpr T inorm_squared() const {
+      return hdual().norm_squared();
+    }
+
+
+    constexpr _GradedMvec3 plane_normalize() const {
+      return *this / length(_Vec3<T>((*this)[Basis::e1], (*this)[Basis::e2], (*this)[Basis::e3]));
+    }
+
+
+    constexpr _GradedMvec3 line_normalize() const {
+      return *this / length(_Vec3<T>((*this)[Basis::e23], (*this)[Basis::e31], (*this)[Basis::e12]));
+    }
+
+
+    constexpr _GradedMvec3 vanishing_line_normalize() const {
+      return *this / length(_Vec3<T>((*this)[Basis::e01], (*this)[Basis::e02], (*this)[Basis::e03]));
+    }
+
+
+    constexpr _GradedMvec3 point_normalize() const {
+      return *this / (*this)[Basis::e123];
+    }
+
+  public:
+    static constexpr _GradedMvec3 plane(const T a, const T b, const T c, const T d) requires (GRADES == MVEC3_GRADES<1>) {
+      _GradedMvec3 res;
+      res.data = { -d, a, b, c };
+      return res;
+    }
+
+
+    static constexpr _GradedMvec3 line(const _Vec3<T> &u) requires (GRADES == MVEC3_GRADES<2>) {
+      _GradedMvec3 res;
+      res.data = { T(0), T(0), T(0), u.z, u.y, u.x };
+      return res;
+    }
+
+
+    static constexpr _GradedMvec3 line_at(const _Vec3<T> &u, const _Vec3<T> &pos) requires (GRADES == MVEC3_GRADES<2>) {
+      return line_plucker(u, cross(pos, u));
+    }
+
+
+    static constexpr _GradedMvec3 line_plucker(const _Vec3<T> &u, const _Vec3<T> &m) requires (GRADES == MVEC3_GRADES<2>) {
+      _GradedMvec3 res;
+      res.data = { m.x, m.y, m.z, u.z, u.y, u.x };
+      return res;
+    }
+
+
+    static constexpr _GradedMvec3 point(const _Vec3<T> &pos) requires (GRADES == MVEC3_GRADES<3>) {
+      _GradedMvec3 res;
+      res.data = { pos.z, pos.y, pos.x, T(1) };
+      return res;
+    }
+
+
+    static constexpr _GradedMvec3 direction(const _Vec3<T> &dir) requires (GRADES == MVEC3_GRADES<3>) {
+      _GradedMvec3 res;
+      res.data = { dir.z, dir.y, dir.x, T(0) };
+      return res;
+    }
+
+
+    static constexpr _GradedMvec3 rotor(const _Rotor3<T> &r) requires (GRADES == MVEC3_GRADES<0, 2, 4>) {
+      _GradedMvec3 res;
+      res.data = { r.s, T(0), T(0), T(0), r.e12, r.e31, r.e23, T(0) };
+      return res;
+    }
+
+
+    static constexpr _GradedMvec3 motor(const _Motor3<T> &m) requires (GRADES == MVEC3_GRADES<0, 2, 4>) {
+      _GradedMvec3 res;
+      res.data = { m.s, m.e01, m.e02, m.e03, m.e12, m.e31, m.e23, m.e0123 };
+      return res;
+    }
+
+
+    constexpr _GradedMvec3() {}
+
+
+    // Keeps the blades of both masks, implicit when no stored blade is dropped
+    template<unsigned OTHER>
+    constexpr explicit((OTHER & ~GRADES) != 0) _GradedMvec3(const _GradedMvec3<T, OTHER> &m) {
+      _unroll<0, SIZE>([&]<size_t i>() {
+        if constexpr (_mvec3_has(OTHER, _MVEC3_BLADES<GRADES>[i])) {
+          data[i] = m.data[_mvec3_slot(OTHER, _MVEC3_BLADES<GRADES>[i])];
+        }
+      });
+    }
+
+
+    // Keeps the blades of the grades of the mask
+    constexpr explicit _GradedMvec3(const _Mvec3<T> &m) {
+      _unroll<0, SIZE>([&]<size_t i>() { data[i] = m[_MVEC3_BLADES<GRADES>[i]]; });
+    }
+
+  private:
+    template<unsigned NEGATED>
+    constexpr _GradedMvec3 _negated() const {
+      _GradedMvec3 res;
+      _unroll<0, SIZE>([&]<size_t i>() {
+        if constexpr (_mvec3_has(NEGATED, _MVEC3_BLADES<GRADES>[i])) {
+          res.data[i] = -data[i];
+        } else {
+          res.data[i] = data[i];
+        }
+      });
+      return res;
+    }
+  };
+
+
+  template<Number T, unsigned GRADES>
+  constexpr _Mvec3<T> as_mvec(const _GradedMvec3<T, GRADES> &m) {
+    _Mvec3<T> res;
+    _unroll<0, _GradedMvec3<T, GRADES>::SIZE>([&]<size_t i>() { res[_MVEC3_BLADES<GRADES>[i]] = m.data[i]; });
+    return res;
+  }
+
+
+  // ============
+  // = Products =
+  // ============
+
+
+  // Geometric product
+  template<Number T, unsigned A, unsigned B>
+  constexpr auto operator*(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::GEOMETRIC, MVEC3_ALL_GRADES>(a, b);
+  }
+
+
+  // Outer product
+  template<Number T, unsigned A, unsigned B>
+  constexpr auto operator&(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::OUTER, MVEC3_ALL_GRADES>(a, b);
+  }
+
+
+  // Regressive product
+  template<Number T, unsigned A, unsigned B>
+  constexpr auto operator|(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::REGRESSIVE, MVEC3_ALL_GRADES>(a, b);
+  }
+
+
+  // Inner product
+  template<Number T, unsigned A, unsigned B>
+  constexpr auto operator||(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::INNER, MVEC3_ALL_GRADES>(a, b);
+  }
+
+
+  // Products restricted to the grades of OUTPUT, only the terms of these grades are computed:
+  // geometric_product<MVEC3_GRADES<3>>(a, b) is (a * b).grade<3>()
+  template<unsigned OUTPUT, Number T, unsigned A, unsigned B>
+  constexpr auto geometric_product(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::GEOMETRIC, OUTPUT>(a, b);
+  }
+
+
+  template<unsigned OUTPUT, Number T, unsigned A, unsigned B>
+  constexpr auto outer_product(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::OUTER, OUTPUT>(a, b);
+  }
+
+
+  template<unsigned OUTPUT, Number T, unsigned A, unsigned B>
+  constexpr auto regressive_product(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::REGRESSIVE, OUTPUT>(a, b);
+  }
+
+
+  template<unsigned OUTPUT, Number T, unsigned A, unsigned B>
+  constexpr auto inner_product(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    return _product<_Mvec3Product::INNER, OUTPUT>(a, b);
+  }
+
+
+  // ==============
+  // = Arithmetic =
+  // ==============
+
+
+  // Multivector addition, the result stores the grades of both
+  template<Number T, unsigned A, unsigned B>
+  constexpr _GradedMvec3<T, A | B> operator+(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    _GradedMvec3<T, A | B> res(a);
+    _unroll<0, _GradedMvec3<T, B>::SIZE>([&]<size_t i>() {
+      constexpr const size_t BLADE = _MVEC3_BLADES<B>[i];
+      if constexpr (_mvec3_has(A, BLADE)) {
+        res.data[_mvec3_slot(A | B, BLADE)] += b.data[i];
+      } else {
+        res.data[_mvec3_slot(A | B, BLADE)] = b.data[i];
+      }
+    });
+    return res;
+  }
+
+
+  // Multivector subtraction
+  template<Number T, unsigned A, unsigned B>
+  constexpr _GradedMvec3<T, A | B> operator-(const _GradedMvec3<T, A> &a, const _GradedMvec3<T, B> &b) {
+    _GradedMvec3<T, A | B> res(a);
+    _unroll<0, _GradedMvec3<T, B>::SIZE>([&]<size_t i>() {
+      constexpr const size_t BLADE = _MVEC3_BLADES<B>[i];
+      if constexpr (_mvec3_has(A, BLADE)) {
+        res.data[_mvec3_slot(A | B, BLADE)] -= b.data[i];
+      } else {
+        res.data[_mvec3_slot(A | B, BLADE)] = -b.data[i];
+      }
+    });
+    return res;
+  }
+
+
+  // Multivector opposite
+  template<Number T, unsigned GRADES>
+  constexpr _GradedMvec3<T, GRADES> operator-(const _GradedMvec3<T, GRADES> &a) {
+    _GradedMvec3<T, GRADES> res;
+    _unroll<0, _GradedMvec3<T, GRADES>::SIZE>([&]<size_t i>() { res.data[i] = -a.data[i]; });
+    return res;
+  }
+
+
+  // Scalar/multivector multiplication
+  template<Number T, unsigned GRADES>
+  constexpr _GradedMvec3<T, GRADES> operator*(const T a, const _GradedMvec3<T, GRADES> &b) {
+    _GradedMvec3<T, GRADES> res;
+    _unroll<0, _GradedMvec3<T, GRADES>::SIZE>([&]<size_t i>() { res.data[i] = a * b.data[i]; });
+    return res;
+  }
+
+
+  // Multivector/scalar multiplication
+  template<Number T, unsigned GRADES>
+  constexpr _GradedMvec3<T, GRADES> operator*(const _GradedMvec3<T, GRADES> &a, const T b) {
+    return b * a;
+  }
+
+
+  // Multivector/scalar division
+  template<Number T, unsigned GRADES>
+  constexpr _GradedMvec3<T, GRADES> operator/(const _GradedMvec3<T, GRADES> &a, const T b) {
+    _GradedMvec3<T, GRADES> res;
+    _unroll<0, _GradedMvec3<T, GRADES>::SIZE>([&]<size_t i>() { res.data[i] = a.data[i] / b; });
+    return res;
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+  template<Number T>
+  using _Mvec3Vector = _GradedMvec3<T, MVEC3_GRADES<1>>;
+  template<Number T>
+  using _Mvec3Bivector = _GradedMvec3<T, MVEC3_GRADES<2>>;
+  template<Number T>
+  using _Mvec3Trivector = _GradedMvec3<T, MVEC3_GRADES<3>>;
+  template<Number T>
+  using _Mvec3Even = _GradedMvec3<T, MVEC3_GRADES<0, 2, 4>>;
+
+  template<unsigned GRADES>
+  using GradedMvec3 = _GradedMvec3<float, GRADES>;
+  template<unsigned GRADES>
+  using GradedMvec3d = _GradedMvec3<double, GRADES>;
+
+  typedef _Mvec3Vector<float> Mvec3Vector;
+  typedef _Mvec3Vector<double> Mvec3dVector;
+  typedef _Mvec3Bivector<float> Mvec3Bivector;
+  typedef _Mvec3Bivector<double> Mvec3dBivector;
+  typedef _Mvec3Trivector<float> Mvec3Trivector;
+  typedef _Mvec3Trivector<double> Mvec3dTrivector;
+  typedef _Mvec3Even<float> Mvec3Even;
+  typedef _Mvec3Even<double> Mvec3dEven;
+}
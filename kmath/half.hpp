@@ -0,0 +1,580 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "base.hpp"
+#include "concepts.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+
+#if defined(__F16C__)
+#include <immintrin.h>
+#endif
+
+
+// 16 bit floating point numbers for storage: half (IEEE 754 binary16) and bfloat16 (the upper
+// half of a float). Both satisfy the Number concept, so _Vec3<half> or _Mat4<bfloat16> can be
+// used as compact storage, e.g. for vertex streams.
+//
+// The arithmetic is done in single precision and rounded back to the nearest 16 bit value. A
+// half converts implicitly to float but must be constructed explicitly, so mixed expressions
+// (half * float) are computed in float. For large amounts of data, prefer the batch convert()
+// functions that use the F16C instructions when available (-mf16c).
+namespace kmath {
+  // ===========
+  // = Formats =
+  // ===========
+
+  struct _Binary16Format {
+    // Round to nearest even, overflows to infinity
+    static constexpr std::uint16_t from_float(const float f) {
+#if defined(__F16C__)
+      if (!std::is_constant_evaluated()) {
+        return std::uint16_t(_cvtss_sh(f, _MM_FROUND_TO_NEAREST_INT));
+      }
+#endif
+      std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+      const std::uint16_t sign = std::uint16_t((x >> 16) & 0x8000);
+      x &= 0x7fffffff;
+
+      if (x >= 0x47800000) { // Too large, infinity or NaN
+        return sign | ((x > 0x7f800000)? 0x7e00 : 0x7c00);
+      } else if (x < 0x38800000) { // Subnormal: lets the float addition round the mantissa
+        const std::uint32_t rounded = std::bit_cast<std::uint32_t>(std::bit_cast<float>(x) + 0.5f);
+        return sign | std::uint16_t(rounded - 0x3f000000);
+      }
+      const std::uint32_t odd = (x >> 13) & 1;
+      x += 0xc8000fff + odd; // Rebias the exponent from 127 to 15 and round
+      return sign | std::uint16_t(x >> 13);
+    }
+
+
+    static constexpr float to_float(const std::uint16_t h) {
+#if defined(__F16C__)
+      if (!std::is_constant_evaluated()) {
+        return _cvtsh_ss(h);
+      }
+#endif
+      std::uint32_t x = std::uint32_t(h & 0x7fff) << 13;
+      const std::uint32_t exponent = x & 0x0f800000;
+      x += 0x38000000; // Rebias the exponent from 15 to 127
+
+      if (exponent == 0x0f800000) { // Infinity or NaN
+        x += 0x38000000;
+      } else if (exponent == 0) { // Subnormal: renormalizes with a float subtraction
+        x = std::bit_cast<std::uint32_t>(std::bit_cast<float>(x + 0x00800000) - 6.103515625e-05f);
+      }
+      return std::bit_cast<float>(x | (std::uint32_t(h & 0x8000) << 16));
+    }
+
+
+    static void from_float(const float *p_source, std::uint16_t *p_destination, const size_t count) {
+      size_t i = 0;
+#if defined(__F16C__)
+      for (; i + 8 <= count; i += 8) {
+        const __m128i h = _mm256_cvtps_ph(_mm256_loadu_ps(p_source + i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(p_destination + i), h);
+      }
+#endif
+      for (; i < count; i++) {
+        p_destination[i] = from_float(p_source[i]);
+      }
+    }
+
+
+    static void to_float(const std::uint16_t *p_source, float *p_destination, const size_t count) {
+      size_t i = 0;
+#if defined(__F16C__)
+      for (; i + 8 <= count; i += 8) {
+        const __m128i h = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p_source + i));
+        _mm256_storeu_ps(p_destination + i, _mm256_cvtph_ps(h));
+      }
+#endif
+      for (; i < count; i++) {
+        p_destination[i] = to_float(p_source[i]);
+      }
+    }
+  };
+
+
+  struct _BFloat16Format {
+    // Round to nearest even, NaNs stay quiet NaNs
+    static constexpr std::uint16_t from_float(const float f) {
+      const std::uint32_t x = std::bit_cast<std::uint32_t>(f);
+      if ((x & 0x7fffffff) > 0x7f800000) {
+        return std::uint16_t((x >> 16) | 0x40);
+      }
+      return std::uint16_t((x + 0x7fff + ((x >> 16) & 1)) >> 16);
+    }
+
+
+    static constexpr float to_float(const std::uint16_t h) {
+      return std::bit_cast<float>(std::uint32_t(h) << 16);
+    }
+
+
+    // Branchless, vectorized by the compiler
+    static void from_float(const float *p_source, std::uint16_t *p_destination, const size_t count) {
+      for (size_t i = 0; i < count; i++) {
+        const std::uint32_t x = std::bit_cast<std::uint32_t>(p_source[i]);
+        const std::uint32_t rounded = (x + 0x7fff + ((x >> 16) & 1)) >> 16;
+        const std::uint32_t quiet = (x >> 16) | 0x40;
+        p_destination[i] = std::uint16_t(((x & 0x7fffffff) > 0x7f800000)? quiet : rounded);
+      }
+    }
+
+
+    static void to_float(const std::uint16_t *p_source, float *p_destination, const size_t count) {
+      for (size_t i = 0; i < count; i++) {
+        p_destination[i] = to_float(p_source[i]);
+      }
+    }
+  };
+
+
+  // ==============
+  // = Half float =
+  // ==============
+
+  template<typename F>
+  struct _Half {
+    std::uint16_t bits = 0;
+
+  public:
+    constexpr _Half() = default;
+
+    template<typename S>
+    requires std::is_arithmetic_v<S>
+    constexpr explicit _Half(const S s): bits(F::from_float(float(s))) {}
+
+
+    static constexpr _Half from_bits(const std::uint16_t bits) {
+      _Half h;
+      h.bits = bits;
+      return h;
+    }
+
+
+    constexpr operator float() const {
+      return F::to_float(bits);
+    }
+
+  public:
+    constexpr _Half &operator+=(const _Half other) {
+      return *this = _Half(float(*this) + float(other));
+    }
+
+
+    constexpr _Half &operator-=(const _Half other) {
+      return *this = _Half(float(*this) - float(other));
+    }
+
+
+    constexpr _Half &operator*=(const _Half other) {
+      return *this = _Half(float(*this) * float(other));
+    }
+
+
+    constexpr _Half &operator/=(const _Half other) {
+      return *this = _Half(float(*this) / float(other));
+    }
+  };
+
+
+  // ===================
+  // = Half operations =
+  // ===================
+
+  template<typename F>
+  constexpr _Half<F> operator+(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(float(a) + float(b));
+  }
+
+
+  template<typename F>
+  constexpr _Half<F> operator-(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(float(a) - float(b));
+  }
+
+
+  template<typename F>
+  constexpr _Half<F> operator*(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(float(a) * float(b));
+  }
+
+
+  template<typename F>
+  constexpr _Half<F> operator/(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(float(a) / float(b));
+  }
+
+
+  template<typename F>
+  constexpr _Half<F> operator+(const _Half<F> a) {
+    return a;
+  }
+
+
+  template<typename F>
+  constexpr _Half<F> operator-(const _Half<F> a) {
+    return _Half<F>::from_bits(a.bits ^ 0x8000);
+  }
+
+
+  template<typename F>
+  struct _bool_parameter<_Half<F>> {
+    using type = bool;
+  };
+
+
+  // ==========================
+  // = Mathematical Functions =
+  // ==========================
+
+  // The 16 bit types are computed in single precision and rounded back
+
+
+  template<typename F>
+  inline _Half<F> mod(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(std::fmod(float(a), float(b)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> remainder(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(std::remainder(float(a), float(b)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> max(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(std::max(float(a), float(b)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> min(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(std::min(float(a), float(b)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> fma(const _Half<F> a, const _Half<F> b, const _Half<F> c) {
+    return _Half<F>(std::fma(float(a), float(b), float(c)));
+  }
+
+
+  // ===================================
+  // = Exponential and power functions =
+  // ===================================
+
+
+  template<typename F>
+  inline _Half<F> exp(const _Half<F> a) {
+    return _Half<F>(std::exp(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> exp2(const _Half<F> a) {
+    return _Half<F>(std::exp2(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> expm1(const _Half<F> a) {
+    return _Half<F>(std::expm1(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> ln(const _Half<F> a) {
+    return _Half<F>(std::log(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> log10(const _Half<F> a) {
+    return _Half<F>(std::log10(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> log2(const _Half<F> a) {
+    return _Half<F>(std::log2(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> ln1p(const _Half<F> a) {
+    return _Half<F>(std::log1p(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> pow(const _Half<F> a, const _Half<F> b) {
+    return _Half<F>(std::pow(float(a), float(b)));
+  }
+
+
+  template<typename F, Integer I>
+  inline _Half<F> pow(const _Half<F> a, const I b) {
+    return _Half<F>(std::pow(float(a), b));
+  }
+
+
+  template<typename F>
+  inline _Half<F> sqrt(const _Half<F> a) {
+    return _Half<F>(std::sqrt(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> cbrt(const _Half<F> a) {
+    return _Half<F>(std::cbrt(float(a)));
+  }
+
+
+  // ===========================
+  // = Trigonometric functions =
+  // ===========================
+
+
+  template<typename F>
+  inline _Half<F> sin(const _Half<F> a) {
+    return _Half<F>(std::sin(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> cos(const _Half<F> a) {
+    return _Half<F>(std::cos(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> tan(const _Half<F> a) {
+    return _Half<F>(std::tan(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> asin(const _Half<F> a) {
+    return _Half<F>(std::asin(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> acos(const _Half<F> a) {
+    return _Half<F>(std::acos(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> atan(const _Half<F> a) {
+    return _Half<F>(std::atan(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> atan2(const _Half<F> y, const _Half<F> x) {
+    return _Half<F>(std::atan2(float(y), float(x)));
+  }
+
+
+  // ========================
+  // = Hyperbolic functions =
+  // ========================
+
+
+  template<typename F>
+  inline _Half<F> sinh(const _Half<F> a) {
+    return _Half<F>(std::sinh(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> cosh(const _Half<F> a) {
+    return _Half<F>(std::cosh(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> tanh(const _Half<F> a) {
+    return _Half<F>(std::tanh(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> asinh(const _Half<F> a) {
+    return _Half<F>(std::asinh(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> acosh(const _Half<F> a) {
+    return _Half<F>(std::acosh(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> atanh(const _Half<F> a) {
+    return _Half<F>(std::atanh(float(a)));
+  }
+
+
+  // =============================
+  // = Gamma and error functions =
+  // =============================
+
+
+  template<typename F>
+  inline _Half<F> erf(const _Half<F> a) {
+    return _Half<F>(std::erf(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> erfc(const _Half<F> a) {
+    return _Half<F>(std::erfc(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> tgamma(const _Half<F> a) {
+    return _Half<F>(std::tgamma(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> lngamma(const _Half<F> a) {
+    return _Half<F>(std::lgamma(float(a)));
+  }
+
+
+  // ======================
+  // = Rounding Functions =
+  // ======================
+
+
+  template<typename F>
+  inline _Half<F> ceil(const _Half<F> a) {
+    return _Half<F>(std::ceil(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> floor(const _Half<F> a) {
+    return _Half<F>(std::floor(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> trunc(const _Half<F> a) {
+    return _Half<F>(std::trunc(float(a)));
+  }
+
+
+  template<typename F>
+  inline _Half<F> round(const _Half<F> a) {
+    return _Half<F>(std::round(float(a)));
+  }
+
+
+  // =================================
+  // = Floating-point classification =
+  // =================================
+
+
+  template<typename F>
+  inline bool is_finite(const _Half<F> a) {
+    return std::isfinite(float(a));
+  }
+
+
+  template<typename F>
+  inline bool is_infinite(const _Half<F> a) {
+    return std::isinf(float(a));
+  }
+
+
+  template<typename F>
+  inline bool is_nan(const _Half<F> a) {
+    return std::isnan(float(a));
+  }
+
+
+  template<typename F>
+  inline bool is_normal_number(const _Half<F> a) {
+    return std::isnormal(float(a));
+  }
+
+
+  template<typename F>
+  inline bool sign_bit(const _Half<F> a) {
+    return std::signbit(float(a));
+  }
+
+
+  // ====================
+  // = Batch conversion =
+  // ====================
+
+  // destination must hold at least source.size() elements
+  template<typename F>
+  void convert(const std::span<const _Half<F>> source, const std::span<float> destination) {
+    F::to_float(reinterpret_cast<const std::uint16_t*>(source.data()), destination.data(), source.size());
+  }
+
+
+  template<typename F>
+  void convert(const std::span<const float> source, const std::span<_Half<F>> destination) {
+    F::from_float(source.data(), reinterpret_cast<std::uint16_t*>(destination.data()), source.size());
+  }
+
+
+  template<template<typename> typename VT, typename F>
+  requires SizedVectorTemplate<VT>
+  void convert(const std::span<const VT<_Half<F>>> source, const std::span<VT<float>> destination) {
+    static_assert(sizeof(VT<_Half<F>>) == VT<float>::SIZE * sizeof(_Half<F>) && sizeof(VT<float>) == VT<float>::SIZE * sizeof(float));
+    F::to_float(reinterpret_cast<const std::uint16_t*>(source.data()), reinterpret_cast<float*>(destination.data()), VT<float>::SIZE * source.size());
+  }
+
+
+  template<template<typename> typename VT, typename F>
+  requires SizedVectorTemplate<VT>
+  void convert(const std::span<const VT<float>> source, const std::span<VT<_Half<F>>> destination) {
+    static_assert(sizeof(VT<_Half<F>>) == VT<float>::SIZE * sizeof(_Half<F>) && sizeof(VT<float>) == VT<float>::SIZE * sizeof(float));
+    F::from_float(reinterpret_cast<const float*>(source.data()), reinterpret_cast<std::uint16_t*>(destination.data()), VT<float>::SIZE * source.size());
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+  typedef _Half<_Binary16Format> half;
+  typedef _Half<_BFloat16Format> bfloat16;
+}
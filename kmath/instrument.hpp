@@ -0,0 +1,472 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+#include "base.hpp"
+#include "concepts.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+
+// Operation counting: Counted<T> behaves like T but counts every arithmetic operation and call to
+// a mathematical function. It satisfies the Number concept, so any kmath function can be
+// instantiated with it (_Motor3<Counted<float>>, _Mvec3<Counted<float>>...) to get its exact cost:
+//
+//     const instrument::OpCounts cost = instrument::count_ops([&]() { return a * b; });
+//
+// The counters are per thread. Negations, comparisons, min, max and the rounding functions are
+// not counted. fma counts as one multiplication and one addition.
+namespace kmath::instrument {
+  // ============
+  // = OpCounts =
+  // ============
+
+  struct OpCounts {
+    std::uint64_t adds = 0; // Additions and subtractions
+    std::uint64_t muls = 0;
+    std::uint64_t divs = 0;
+    std::uint64_t sqrts = 0;
+    std::uint64_t transcendentals = 0; // exp, ln, pow, cbrt, trigonometric functions...
+
+  public:
+    constexpr std::uint64_t total() const {
+      return adds + muls + divs + sqrts + transcendentals;
+    }
+
+
+    constexpr bool operator==(const OpCounts &other) const = default;
+  };
+
+
+  constexpr OpCounts operator+(const OpCounts &a, const OpCounts &b) {
+    return OpCounts{
+      .adds = a.adds + b.adds,
+      .muls = a.muls + b.muls,
+      .divs = a.divs + b.divs,
+      .sqrts = a.sqrts + b.sqrts,
+      .transcendentals = a.transcendentals + b.transcendentals,
+    };
+  }
+
+
+  constexpr OpCounts operator-(const OpCounts &a, const OpCounts &b) {
+    return OpCounts{
+      .adds = a.adds - b.adds,
+      .muls = a.muls - b.muls,
+      .divs = a.divs - b.divs,
+      .sqrts = a.sqrts - b.sqrts,
+      .transcendentals = a.transcendentals - b.transcendentals,
+    };
+  }
+
+
+  // Whether no count of a exceeds the one of the budget
+  constexpr bool fits(const OpCounts &a, const OpCounts &budget) {
+    return a.adds <= budget.adds && a.muls <= budget.muls && a.divs <= budget.divs
+      && a.sqrts <= budget.sqrts && a.transcendentals <= budget.transcendentals;
+  }
+
+
+  // Counters of the calling thread, they are never reset
+  inline OpCounts &counters() {
+    thread_local OpCounts counts;
+    return counts;
+  }
+
+
+  // Operations counted while f runs
+  template<typename F>
+  OpCounts count_ops(F &&f) {
+    const OpCounts start = counters();
+    f();
+    return counters() - start;
+  }
+
+
+  // One line per kernel: name, then every count
+  inline std::ostream &report(std::ostream &stream, const std::string_view name, const OpCounts &counts) {
+    return stream << name << ": " << counts.adds << " add, " << counts.muls << " mul, " << counts.divs << " div, "
+      << counts.sqrts << " sqrt, " << counts.transcendentals << " transcendental (" << counts.total() << " total)\n";
+  }
+
+
+  // ===========
+  // = Counted =
+  // ===========
+
+  template<FloatingPoint T>
+  struct Counted {
+    T value = T(0);
+
+  public:
+    constexpr Counted() = default;
+
+    // Implicit like the conversions of T, so that mixed expressions (angle / 2) compile as they
+    // do for T, and are counted
+    template<typename S>
+    requires Integer<S> || FloatingPoint<S>
+    constexpr Counted(const S s): value(T(s)) {}
+
+
+    template<typename S>
+    requires Integer<S> || FloatingPoint<S>
+    constexpr explicit operator S() const {
+      return S(value);
+    }
+
+  public:
+    constexpr Counted &operator+=(const Counted other) {
+      counters().adds++;
+      value += other.value;
+      return *this;
+    }
+
+
+    constexpr Counted &operator-=(const Counted other) {
+      counters().adds++;
+      value -= other.value;
+      return *this;
+    }
+
+
+    constexpr Counted &operator*=(const Counted other) {
+      counters().muls++;
+      value *= other.value;
+      return *this;
+    }
+
+
+    constexpr Counted &operator/=(const Counted other) {
+      counters().divs++;
+      value /= other.value;
+      return *this;
+    }
+
+
+    constexpr auto operator<=>(const Counted &other) const = default;
+
+  public:
+    // Friends, so that the scalars of mixed expressions are converted
+    friend constexpr Counted operator+(Counted a, const Counted b) { return a += b; }
+    friend constexpr Counted operator-(Counted a, const Counted b) { return a -= b; }
+    friend constexpr Counted operator*(Counted a, const Counted b) { return a *= b; }
+    friend constexpr Counted operator/(Counted a, const Counted b) { return a /= b; }
+  };
+
+
+  template<FloatingPoint T>
+  constexpr Counted<T> operator+(const Counted<T> a) {
+    return a;
+  }
+
+
+  template<FloatingPoint T>
+  constexpr Counted<T> operator-(const Counted<T> a) {
+    return Counted<T>(-a.value);
+  }
+
+
+  // =============
+  // = Functions =
+  // =============
+
+  // Applies the std function f to the value of a, counted in the given counter
+  template<FloatingPoint T, typename F>
+  inline Counted<T> _counted(std::uint64_t OpCounts::*counter, F &&f, const Counted<T> a) {
+    counters().*counter += 1;
+    return Counted<T>(f(a.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> min(const Counted<T> a, const Counted<T> b) {
+    return (b < a)? b : a;
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> max(const Counted<T> a, const Counted<T> b) {
+    return (a < b)? b : a;
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> mod(const Counted<T> a, const Counted<T> b) {
+    counters().divs++;
+    return Counted<T>(std::fmod(a.value, b.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> remainder(const Counted<T> a, const Counted<T> b) {
+    counters().divs++;
+    return Counted<T>(std::remainder(a.value, b.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> fma(const Counted<T> a, const Counted<T> b, const Counted<T> c) {
+    counters().muls++;
+    counters().adds++;
+    return Counted<T>(std::fma(a.value, b.value, c.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> floor(const Counted<T> a) {
+    return Counted<T>(std::floor(a.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> ceil(const Counted<T> a) {
+    return Counted<T>(std::ceil(a.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> trunc(const Counted<T> a) {
+    return Counted<T>(std::trunc(a.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> round(const Counted<T> a) {
+    return Counted<T>(std::round(a.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> sqrt(const Counted<T> a) {
+    return _counted(&OpCounts::sqrts, [](const T x) { return std::sqrt(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> cbrt(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::cbrt(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> exp(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::exp(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> exp2(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::exp2(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> expm1(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::expm1(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> ln(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::log(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> log10(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::log10(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> log2(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::log2(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> ln1p(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::log1p(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> pow(const Counted<T> a, const Counted<T> b) {
+    counters().transcendentals++;
+    return Counted<T>(std::pow(a.value, b.value));
+  }
+
+
+  template<FloatingPoint T, Integer I>
+  inline Counted<T> pow(const Counted<T> a, const I b) {
+    counters().transcendentals++;
+    return Counted<T>(std::pow(a.value, b));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> sin(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::sin(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> cos(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::cos(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> tan(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::tan(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> asin(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::asin(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> acos(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::acos(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> atan(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::atan(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> atan2(const Counted<T> y, const Counted<T> x) {
+    counters().transcendentals++;
+    return Counted<T>(std::atan2(y.value, x.value));
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> sinh(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::sinh(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> cosh(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::cosh(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> tanh(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::tanh(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> asinh(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::asinh(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> acosh(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::acosh(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> atanh(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::atanh(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> erf(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::erf(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> erfc(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::erfc(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> tgamma(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::tgamma(x); }, a);
+  }
+
+
+  template<FloatingPoint T>
+  inline Counted<T> lngamma(const Counted<T> a) {
+    return _counted(&OpCounts::transcendentals, [](const T x) { return std::lgamma(x); }, a);
+  }
+
+
+  // ==================
+  // = Classification =
+  // ==================
+
+  template<FloatingPoint T>
+  inline bool is_finite(const Counted<T> a) {
+    return std::isfinite(a.value);
+  }
+
+
+  template<FloatingPoint T>
+  inline bool is_infinite(const Counted<T> a) {
+    return std::isinf(a.value);
+  }
+
+
+  template<FloatingPoint T>
+  inline bool is_nan(const Counted<T> a) {
+    return std::isnan(a.value);
+  }
+
+
+  template<FloatingPoint T>
+  inline bool is_normal_number(const Counted<T> a) {
+    return std::isnormal(a.value);
+  }
+
+
+  template<FloatingPoint T>
+  inline bool sign_bit(const Counted<T> a) {
+    return std::signbit(a.value);
+  }
+}
+
+
+namespace kmath {
+  template<FloatingPoint T>
+  struct _bool_parameter<instrument::Counted<T>> {
+    using type = bool;
+  };
+}
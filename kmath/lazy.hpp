@@ -0,0 +1,332 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+#pragma once
+
+#include "base.hpp"
+#include "concepts.hpp"
+#include "simd.hpp"
+#include "vector_array.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <utility>
+
+
+// Lazy expressions over _VecArray. Wrapping an array with lazy::expr makes the arithmetic
+// operators build an expression tree instead of computing the result, and evaluate() runs the
+// whole tree in a single pass over the arrays, one SIMD pack of vectors at a time:
+//
+//   lazy::evaluate((lazy::expr(b) - a) * t + a, result);
+//
+// A product followed by a sum or a difference is fused into a multiply-add, which is emitted as
+// an FMA instruction when the target has one. The eager operators are not affected.
+//
+// The nodes keep references to the arrays, an expression must be evaluated before the arrays it
+// refers to are destroyed. Every array of an expression must have the same size. The result may
+// alias one of them.
+namespace kmath::lazy {
+  // =========
+  // = Nodes =
+  // =========
+
+  template<typename E>
+  concept Expression = requires(const E e, const size_t index) {
+    typename E::Scalar;
+    { e.size() } -> std::same_as<size_t>;
+    { e.template load<simd::NativePack<typename E::Scalar>>(index) } -> std::same_as<typename E::template Vector<simd::NativePack<typename E::Scalar>>>;
+  };
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  struct _Array {
+    using Scalar = T;
+    template<typename P>
+    using Vector = VT<P>;
+
+    const _VecArray<VT, T> *array;
+
+    inline size_t size() const { return array->size(); }
+
+    template<typename P>
+    inline VT<P> load(const size_t index) const {
+      return array->template load<P>(index);
+    }
+  };
+
+
+  // Broadcasted scalar, it has no size of its own
+  template<template<typename> typename VT, FloatingPoint T>
+  struct _Scalar {
+    using Scalar = T;
+    template<typename P>
+    using Vector = VT<P>;
+
+    T value;
+
+    inline size_t size() const { return 0; }
+
+    template<typename P>
+    inline VT<P> load(const size_t) const {
+      return VT<P>(P(value));
+    }
+  };
+
+
+  template<Expression A>
+  struct _Negate {
+    using Scalar = typename A::Scalar;
+    template<typename P>
+    using Vector = typename A::template Vector<P>;
+
+    A a;
+
+    inline size_t size() const { return a.size(); }
+
+    template<typename P>
+    inline Vector<P> load(const size_t index) const {
+      return -a.template load<P>(index);
+    }
+  };
+
+
+  // Size of two operands, a broadcasted scalar takes the size of the other one
+  inline size_t _common_size(const size_t a, const size_t b) {
+    KMATH_ASSERT(a == 0 || b == 0 || a == b);
+    return std::max(a, b);
+  }
+
+
+  template<typename Op, Expression A, Expression B>
+  struct _Binary {
+    using Scalar = typename A::Scalar;
+    template<typename P>
+    using Vector = typename A::template Vector<P>;
+
+    A a;
+    B b;
+
+    inline size_t size() const { return _common_size(a.size(), b.size()); }
+
+    template<typename P>
+    inline Vector<P> load(const size_t index) const {
+      return Op::compute(a.template load<P>(index), b.template load<P>(index));
+    }
+  };
+
+
+  // a * b + c
+  template<Expression A, Expression B, Expression C>
+  struct _MulAdd {
+    using Scalar = typename A::Scalar;
+    template<typename P>
+    using Vector = typename A::template Vector<P>;
+
+    A a;
+    B b;
+    C c;
+
+    inline size_t size() const { return _common_size(_common_size(a.size(), b.size()), c.size()); }
+
+    template<typename P>
+    inline Vector<P> load(const size_t index) const {
+      const Vector<P> x = a.template load<P>(index);
+      const Vector<P> y = b.template load<P>(index);
+      const Vector<P> z = c.template load<P>(index);
+#if defined(__FMA__)
+      return fma(x, y, z);
+#else
+      // std::fma is emulated in software without hardware support
+      return x * y + z;
+#endif
+    }
+  };
+
+
+  struct _Add {
+    template<typename V>
+    static inline V compute(const V &a, const V &b) { return a + b; }
+  };
+
+
+  struct _Sub {
+    template<typename V>
+    static inline V compute(const V &a, const V &b) { return a - b; }
+  };
+
+
+  struct _Mul {
+    template<typename V>
+    static inline V compute(const V &a, const V &b) { return a * b; }
+  };
+
+
+  struct _Div {
+    template<typename V>
+    static inline V compute(const V &a, const V &b) { return a / b; }
+  };
+
+
+  template<typename E>
+  constexpr const bool _is_product = false;
+
+  template<Expression A, Expression B>
+  constexpr const bool _is_product<_Binary<_Mul, A, B>> = true;
+
+
+  // ============
+  // = Operands =
+  // ============
+
+  template<template<typename> typename VT, FloatingPoint T>
+  inline _Array<VT, T> expr(const _VecArray<VT, T> &array) {
+    return _Array<VT, T>{ &array };
+  }
+
+
+  template<Expression E>
+  inline E expr(const E &e) {
+    return e;
+  }
+
+
+  template<typename A>
+  concept _Operand = requires(const A a) {
+    { expr(a) } -> Expression;
+  };
+
+
+  template<typename A>
+  using _Node = decltype(expr(std::declval<A>()));
+
+
+  template<Expression E>
+  inline _Scalar<E::template Vector, typename E::Scalar> _broadcast(const typename E::Scalar s) {
+    return _Scalar<E::template Vector, typename E::Scalar>{ s };
+  }
+
+
+  template<Expression A, Expression B>
+  inline auto _add(const A &a, const B &b) {
+    if constexpr(_is_product<A>) {
+      return _MulAdd<decltype(a.a), decltype(a.b), B>{ a.a, a.b, b };
+    } else if constexpr(_is_product<B>) {
+      return _MulAdd<decltype(b.a), decltype(b.b), A>{ b.a, b.b, a };
+    } else {
+      return _Binary<_Add, A, B>{ a, b };
+    }
+  }
+
+
+  template<Expression A, Expression B>
+  inline auto _sub(const A &a, const B &b) {
+    if constexpr(_is_product<A>) {
+      return _MulAdd<decltype(a.a), decltype(a.b), _Negate<B>>{ a.a, a.b, _Negate<B>{ b } };
+    } else if constexpr(_is_product<B>) {
+      return _MulAdd<_Negate<decltype(b.a)>, decltype(b.b), A>{ _Negate<decltype(b.a)>{ b.a }, b.b, a };
+    } else {
+      return _Binary<_Sub, A, B>{ a, b };
+    }
+  }
+
+
+  // =============
+  // = Operators =
+  // =============
+
+  // At least one side must already be an expression, so that the arrays keep their eager semantics
+
+  template<_Operand A, _Operand B>
+  requires (Expression<A> || Expression<B>)
+  inline auto operator+(const A &a, const B &b) {
+    return _add(expr(a), expr(b));
+  }
+
+
+  template<_Operand A, _Operand B>
+  requires (Expression<A> || Expression<B>)
+  inline auto operator-(const A &a, const B &b) {
+    return _sub(expr(a), expr(b));
+  }
+
+
+  template<_Operand A, _Operand B>
+  requires (Expression<A> || Expression<B>)
+  inline auto operator*(const A &a, const B &b) {
+    return _Binary<_Mul, _Node<A>, _Node<B>>{ expr(a), expr(b) };
+  }
+
+
+  template<_Operand A, _Operand B>
+  requires (Expression<A> || Expression<B>)
+  inline auto operator/(const A &a, const B &b) {
+    return _Binary<_Div, _Node<A>, _Node<B>>{ expr(a), expr(b) };
+  }
+
+
+  template<Expression E>
+  inline _Negate<E> operator-(const E &e) {
+    return _Negate<E>{ e };
+  }
+
+
+  template<Expression E>
+  inline auto operator*(const typename E::Scalar s, const E &e) {
+    return _Binary<_Mul, _Scalar<E::template Vector, typename E::Scalar>, E>{ _broadcast<E>(s), e };
+  }
+
+
+  template<Expression E>
+  inline auto operator*(const E &e, const typename E::Scalar s) {
+    return _Binary<_Mul, E, _Scalar<E::template Vector, typename E::Scalar>>{ e, _broadcast<E>(s) };
+  }
+
+
+  template<Expression E>
+  inline auto operator/(const E &e, const typename E::Scalar s) {
+    return _Binary<_Div, E, _Scalar<E::template Vector, typename E::Scalar>>{ e, _broadcast<E>(s) };
+  }
+
+
+  // ==================
+  // = Lazy functions =
+  // ==================
+
+  // t * (b - a) + a, evaluated as a single multiply-add
+  template<_Operand A, _Operand B>
+  inline auto lerp(const A &a, const B &b, const typename _Node<A>::Scalar t) {
+    return (expr(b) - expr(a)) * t + expr(a);
+  }
+
+
+  // ==============
+  // = Evaluation =
+  // ==============
+
+  template<Expression E, template<typename> typename VT, FloatingPoint T>
+  requires std::same_as<typename E::template Vector<T>, VT<T>>
+  void evaluate(const E &expression, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(expression.size());
+    for (size_t i = 0; i < result.capacity(); i += P::LANES) {
+      result.store(i, expression.template load<P>(i));
+    }
+  }
+}
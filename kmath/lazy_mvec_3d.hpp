@@ -0,0 +1,537 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "concepts.hpp"
+#include "graded_mvec_3d.hpp"
+#include "pga_3d.hpp"
+#include "vector.hpp"
+#include "private/unroll.hpp"
+
+#include <concepts>
+#include <cstddef>
+#include <type_traits>
+
+
+// Lazy expressions over _Mvec3. Wrapping a multivector with lazy::expr makes the products and the
+// arithmetic operators build an expression tree, which is only evaluated for the blades that are
+// read:
+//
+//   const Mvec3 projected = ((lazy::expr(plane) || point) * plane).grade(3);
+//
+// computes the 4 trivector blades of the result and the blades of plane || point they use,
+// instead of two full products. operator[], grade, norm_squared and the normalize helpers only
+// evaluate the blades they need, converting to _Mvec3 evaluates all of them. Unlike
+// _GradedMvec3, the zero blades of the operands are not known, only the output is restricted.
+//
+// The nodes keep references to the wrapped multivectors, an expression must be evaluated before
+// they are destroyed. The eager operators of _Mvec3 are not affected.
+namespace kmath::lazy {
+  // =========
+  // = Nodes =
+  // =========
+
+
+  constexpr const unsigned _MVEC3_ALL_BLADES = _mvec3_blade_mask(MVEC3_ALL_GRADES);
+  // Blades without e0, the only ones that do not square to 0
+  constexpr const unsigned _MVEC3_EUCLIDEAN_BLADES = 0b0100011100011101u;
+
+
+  template<typename E, Number T>
+  struct _Mvec3Expr;
+
+
+  template<typename E>
+  concept Mvec3Expression = requires {
+    typename E::Scalar;
+  } && std::derived_from<E, _Mvec3Expr<E, typename E::Scalar>>;
+
+
+  template<Number T>
+  struct _Mvec3Leaf;
+
+  template<_Mvec3Product PRODUCT, Mvec3Expression L, Mvec3Expression R>
+  struct _Mvec3ProductNode;
+
+
+  enum class _Mvec3Unary {
+    OPPOSITE,
+    REVERSE,
+    CONJUGATE,
+    DUAL,
+  };
+
+  template<Mvec3Expression E, _Mvec3Unary OP>
+  struct _Mvec3UnaryNode;
+
+
+  enum class _Mvec3Norm {
+    PLANE,
+    LINE,
+    VANISHING_LINE,
+    POINT,
+  };
+
+  template<Mvec3Expression E, _Mvec3Norm NORM>
+  struct _Mvec3NormalizeNode;
+
+
+  // Operations shared by every node. evaluate<BLADES>() returns a multivector whose blades in the
+  // BLADES mask (bit i being blade i) are those of the expression, the others are unspecified.
+  template<typename E, Number T>
+  struct _Mvec3Expr {
+    using Scalar = T;
+    using Basis = typename _Mvec3<T>::Basis;
+
+    template<unsigned BLADES>
+    decltype(auto) evaluate() const {
+      return static_cast<const E&>(*this).template _evaluate<BLADES>();
+    }
+
+
+    _Mvec3<T> evaluate() const {
+      return evaluate<_MVEC3_ALL_BLADES>();
+    }
+
+
+    operator _Mvec3<T>() const {
+      return evaluate();
+    }
+
+
+    T operator[](const size_t blade) const {
+      T value = T(0);
+      _unroll<0, 16>([&]<size_t B>() {
+        if (blade == B) {
+          value = evaluate<1u << B>()[B];
+        }
+      });
+      return value;
+    }
+
+
+    T operator[](const Basis blade) const {
+      return (*this)[size_t(blade)];
+    }
+
+
+    _Mvec3<T> grade(const int g) const {
+      _Mvec3<T> res;
+      _unroll<0, 5>([&]<size_t G>() {
+        if (g == int(G)) {
+          res = evaluate<_mvec3_blade_mask(1u << G)>().grade(int(G));
+        }
+      });
+      return res;
+    }
+
+
+    T norm_squared() const {
+      return evaluate<_MVEC3_EUCLIDEAN_BLADES>().norm_squared();
+    }
+
+
+    T norm() const {
+      return sqrt(norm_squared());
+    }
+
+
+    T inorm_squared() const {
+      return hdual().norm_squared();
+    }
+
+
+    T inorm() const {
+      return sqrt(inorm_squared());
+    }
+
+
+    auto rev() const {
+      return _Mvec3UnaryNode<E, _Mvec3Unary::REVERSE>(static_cast<const E&>(*this));
+    }
+
+
+    auto conj() const {
+      return _Mvec3UnaryNode<E, _Mvec3Unary::CONJUGATE>(static_cast<const E&>(*this));
+    }
+
+
+    auto hdual() const {
+      return _Mvec3UnaryNode<E, _Mvec3Unary::DUAL>(static_cast<const E&>(*this));
+    }
+
+
+    auto plane_normalize() const {
+      return _Mvec3NormalizeNode<E, _Mvec3Norm::PLANE>(static_cast<const E&>(*this));
+    }
+
+
+    auto line_normalize() const {
+      return _Mvec3NormalizeNode<E, _Mvec3Norm::LINE>(static_cast<const E&>(*this));
+    }
+
+
+    auto vanishing_line_normalize() const {
+      return _Mvec3NormalizeNode<E, _Mvec3Norm::VANISHING_LINE>(static_cast<const E&>(*this));
+    }
+
+
+    auto point_normalize() const {
+      return _Mvec3NormalizeNode<E, _Mvec3Norm::POINT>(static_cast<const E&>(*this));
+    }
+  };
+
+
+  template<Number T>
+  struct _Mvec3Leaf: _Mvec3Expr<_Mvec3Leaf<T>, T> {
+    const _Mvec3<T> &m;
+
+    explicit _Mvec3Leaf(const _Mvec3<T> &p_m): m(p_m) {}
+
+
+    template<unsigned BLADES>
+    const _Mvec3<T> &_evaluate() const {
+      return m;
+    }
+  };
+
+
+  // Blades of the operands used by the terms of the output blades
+  struct _Mvec3Operands {
+    unsigned a;
+    unsigned b;
+  };
+
+
+  constexpr _Mvec3Operands _mvec3_operands(const _Mvec3Product product, const unsigned output_blades) {
+    _Mvec3Operands operands{ 0, 0 };
+    _mvec3_product_blades(product, _MVEC3_ALL_BLADES, _MVEC3_ALL_BLADES, output_blades, operands.a, operands.b);
+    return operands;
+  }
+
+
+  template<_Mvec3Product PRODUCT, Mvec3Expression L, Mvec3Expression R>
+  struct _Mvec3ProductNode: _Mvec3Expr<_Mvec3ProductNode<PRODUCT, L, R>, typename L::Scalar> {
+    using T = typename L::Scalar;
+
+    L left;
+    R right;
+
+    _Mvec3ProductNode(const L &p_left, const R &p_right): left(p_left), right(p_right) {}
+
+
+    // Each operand is evaluated once, for the blades the terms use
+    template<unsigned BLADES>
+    _Mvec3<T> _evaluate() const {
+      constexpr const _Mvec3Operands OPERANDS = _mvec3_operands(PRODUCT, BLADES);
+      constexpr const auto &TERMS = _MVEC3_TERMS<PRODUCT, _MVEC3_ALL_BLADES, _MVEC3_ALL_BLADES, BLADES>;
+      const auto &a = left.template evaluate<OPERANDS.a>();
+      const auto &b = right.template evaluate<OPERANDS.b>();
+
+      _Mvec3<T> res;
+      _unroll<0, TERMS.size()>([&]<size_t i>() {
+        constexpr const _Mvec3Term TERM = TERMS[i];
+        const T product = a[TERM.a] * b[TERM.b];
+        if constexpr (i == 0 || TERMS[i - 1].result != TERM.result) {
+          if constexpr (TERM.sign > 0) {
+            res[TERM.result] = product;
+          } else {
+            res[TERM.result] = -product;
+          }
+        } else if constexpr (TERM.sign > 0) {
+          res[TERM.result] += product;
+        } else {
+          res[TERM.result] -= product;
+        }
+      });
+      return res;
+    }
+  };
+
+
+  template<Mvec3Expression L, Mvec3Expression R, bool SUBTRACT>
+  struct _Mvec3SumNode: _Mvec3Expr<_Mvec3SumNode<L, R, SUBTRACT>, typename L::Scalar> {
+    using T = typename L::Scalar;
+
+    L left;
+    R right;
+
+    _Mvec3SumNode(const L &p_left, const R &p_right): left(p_left), right(p_right) {}
+
+
+    template<unsigned BLADES>
+    _Mvec3<T> _evaluate() const {
+      const auto &a = left.template evaluate<BLADES>();
+      const auto &b = right.template evaluate<BLADES>();
+      _Mvec3<T> res;
+      _unroll<0, 16>([&]<size_t B>() {
+        if constexpr (((BLADES >> B) & 1u) && SUBTRACT) {
+          res[B] = a[B] - b[B];
+        } else if constexpr ((BLADES >> B) & 1u) {
+          res[B] = a[B] + b[B];
+        }
+      });
+      return res;
+    }
+  };
+
+
+  // Blade of the operand of a unary operation giving blade b of the result, and its sign
+  constexpr size_t _mvec3_unary_source(const _Mvec3Unary op, const size_t blade) {
+    return (op == _Mvec3Unary::DUAL)? 15 - blade : blade;
+  }
+
+
+  constexpr bool _mvec3_unary_negates(const _Mvec3Unary op, const size_t blade) {
+    switch (op) {
+    case _Mvec3Unary::OPPOSITE:
+      return true;
+    case _Mvec3Unary::REVERSE:
+      return _mvec3_has(MVEC3_GRADES<2, 3>, blade);
+    case _Mvec3Unary::CONJUGATE:
+      return _mvec3_has(MVEC3_GRADES<1, 2>, blade);
+    case _Mvec3Unary::DUAL:
+      return false;
+    }
+    return false;
+  }
+
+
+  constexpr unsigned _mvec3_unary_sources(const _Mvec3Unary op, const unsigned blades) {
+    unsigned sources = 0;
+    for (size_t blade = 0; blade < 16; blade++) {
+      sources |= ((blades >> blade) & 1u) << _mvec3_unary_source(op, blade);
+    }
+    return sources;
+  }
+
+
+  template<Mvec3Expression E, _Mvec3Unary OP>
+  struct _Mvec3UnaryNode: _Mvec3Expr<_Mvec3UnaryNode<E, OP>, typename E::Scalar> {
+    using T = typename E::Scalar;
+
+    E operand;
+
+    explicit _Mvec3UnaryNode(const E &p_operand): operand(p_operand) {}
+
+
+    template<unsigned BLADES>
+    _Mvec3<T> _evaluate() const {
+      const auto &a = operand.template evaluate<_mvec3_unary_sources(OP, BLADES)>();
+      _Mvec3<T> res;
+      _unroll<0, 16>([&]<size_t B>() {
+        if constexpr (((BLADES >> B) & 1u) && _mvec3_unary_negates(OP, B)) {
+          res[B] = -a[_mvec3_unary_source(OP, B)];
+        } else if constexpr ((BLADES >> B) & 1u) {
+          res[B] = a[_mvec3_unary_source(OP, B)];
+        }
+      });
+      return res;
+    }
+  };
+
+
+  // Multiplication or division by a scalar
+  template<Mvec3Expression E, bool DIVIDE>
+  struct _Mvec3ScaleNode: _Mvec3Expr<_Mvec3ScaleNode<E, DIVIDE>, typename E::Scalar> {
+    using T = typename E::Scalar;
+
+    E operand;
+    T factor;
+
+    _Mvec3ScaleNode(const E &p_operand, const T p_factor): operand(p_operand), factor(p_factor) {}
+
+
+    template<unsigned BLADES>
+    _Mvec3<T> _evaluate() const {
+      const auto &a = operand.template evaluate<BLADES>();
+      _Mvec3<T> res;
+      _unroll<0, 16>([&]<size_t B>() {
+        if constexpr (((BLADES >> B) & 1u) && DIVIDE) {
+          res[B] = a[B] / factor;
+        } else if constexpr ((BLADES >> B) & 1u) {
+          res[B] = factor * a[B];
+        }
+      });
+      return res;
+    }
+  };
+
+
+  // Blades the norm of a normalize helper is computed from
+  constexpr unsigned _mvec3_norm_blades(const _Mvec3Norm norm) {
+    switch (norm) {
+    case _Mvec3Norm::PLANE:
+      return 0b0000000000011100u;
+    case _Mvec3Norm::LINE:
+      return 0b0000011100000000u;
+    case _Mvec3Norm::VANISHING_LINE:
+      return 0b0000000011100000u;
+    case _Mvec3Norm::POINT:
+      return 0b0100000000000000u;
+    }
+    return 0;
+  }
+
+
+  // The operand is evaluated once, for the requested blades and those of the norm
+  template<Mvec3Expression E, _Mvec3Norm NORM>
+  struct _Mvec3NormalizeNode: _Mvec3Expr<_Mvec3NormalizeNode<E, NORM>, typename E::Scalar> {
+    using T = typename E::Scalar;
+    using Basis = typename _Mvec3<T>::Basis;
+
+    E operand;
+
+    explicit _Mvec3NormalizeNode(const E &p_operand): operand(p_operand) {}
+
+
+    template<unsigned BLADES>
+    _Mvec3<T> _evaluate() const {
+      const auto &a = operand.template evaluate<BLADES | _mvec3_norm_blades(NORM)>();
+      T norm;
+      if constexpr (NORM == _Mvec3Norm::PLANE) {
+        norm = length(_Vec3<T>(a[Basis::e1], a[Basis::e2], a[Basis::e3]));
+      } else if constexpr (NORM == _Mvec3Norm::LINE) {
+        norm = length(_Vec3<T>(a[Basis::e23], a[Basis::e31], a[Basis::e12]));
+      } else if constexpr (NORM == _Mvec3Norm::VANISHING_LINE) {
+        norm = length(_Vec3<T>(a[Basis::e01], a[Basis::e02], a[Basis::e03]));
+      } else {
+        norm = a[Basis::e123];
+      }
+      _Mvec3<T> res;
+      _unroll<0, 16>([&]<size_t B>() {
+        if constexpr ((BLADES >> B) & 1u) {
+          res[B] = a[B] / norm;
+        }
+      });
+      return res;
+    }
+  };
+
+
+  // ===============
+  // = Expressions =
+  // ===============
+
+
+  template<Number T>
+  _Mvec3Leaf<T> expr(const _Mvec3<T> &m) {
+    return _Mvec3Leaf<T>(m);
+  }
+
+
+  template<Mvec3Expression E>
+  const E &_node(const E &e) {
+    return e;
+  }
+
+
+  template<Number T>
+  _Mvec3Leaf<T> _node(const _Mvec3<T> &m) {
+    return _Mvec3Leaf<T>(m);
+  }
+
+
+  // An expression or a multivector, at least one operand of a binary operator being an expression
+  template<typename A, typename B>
+  concept _Mvec3BinaryOperands = (Mvec3Expression<A> || Mvec3Expression<B>) && requires(const A a, const B b) {
+    _node(a);
+    _node(b);
+    requires std::same_as<typename std::remove_cvref_t<decltype(_node(a))>::Scalar, typename std::remove_cvref_t<decltype(_node(b))>::Scalar>;
+  };
+
+
+  template<_Mvec3Product PRODUCT, typename A, typename B>
+  using _Mvec3ProductOf = _Mvec3ProductNode<PRODUCT, std::remove_cvref_t<decltype(_node(std::declval<A>()))>, std::remove_cvref_t<decltype(_node(std::declval<B>()))>>;
+
+
+  // Geometric product
+  template<typename A, typename B>
+  requires _Mvec3BinaryOperands<A, B>
+  _Mvec3ProductOf<_Mvec3Product::GEOMETRIC, A, B> operator*(const A &a, const B &b) {
+    return _Mvec3ProductOf<_Mvec3Product::GEOMETRIC, A, B>(_node(a), _node(b));
+  }
+
+
+  // Outer product
+  template<typename A, typename B>
+  requires _Mvec3BinaryOperands<A, B>
+  _Mvec3ProductOf<_Mvec3Product::OUTER, A, B> operator&(const A &a, const B &b) {
+    return _Mvec3ProductOf<_Mvec3Product::OUTER, A, B>(_node(a), _node(b));
+  }
+
+
+  // Regressive product
+  template<typename A, typename B>
+  requires _Mvec3BinaryOperands<A, B>
+  _Mvec3ProductOf<_Mvec3Product::REGRESSIVE, A, B> operator|(const A &a, const B &b) {
+    return _Mvec3ProductOf<_Mvec3Product::REGRESSIVE, A, B>(_node(a), _node(b));
+  }
+
+
+  // Inner product
+  template<typename A, typename B>
+  requires _Mvec3BinaryOperands<A, B>
+  _Mvec3ProductOf<_Mvec3Product::INNER, A, B> operator||(const A &a, const B &b) {
+    return _Mvec3ProductOf<_Mvec3Product::INNER, A, B>(_node(a), _node(b));
+  }
+
+
+  template<typename A, typename B>
+  requires _Mvec3BinaryOperands<A, B>
+  auto operator+(const A &a, const B &b) {
+    return _Mvec3SumNode<std::remove_cvref_t<decltype(_node(a))>, std::remove_cvref_t<decltype(_node(b))>, false>(_node(a), _node(b));
+  }
+
+
+  template<typename A, typename B>
+  requires _Mvec3BinaryOperands<A, B>
+  auto operator-(const A &a, const B &b) {
+    return _Mvec3SumNode<std::remove_cvref_t<decltype(_node(a))>, std::remove_cvref_t<decltype(_node(b))>, true>(_node(a), _node(b));
+  }
+
+
+  template<Mvec3Expression E>
+  _Mvec3UnaryNode<E, _Mvec3Unary::OPPOSITE> operator-(const E &e) {
+    return _Mvec3UnaryNode<E, _Mvec3Unary::OPPOSITE>(e);
+  }
+
+
+  template<Mvec3Expression E>
+  _Mvec3ScaleNode<E, false> operator*(const typename E::Scalar a, const E &e) {
+    return _Mvec3ScaleNode<E, false>(e, a);
+  }
+
+
+  template<Mvec3Expression E>
+  _Mvec3ScaleNode<E, false> operator*(const E &e, const typename E::Scalar a) {
+    return _Mvec3ScaleNode<E, false>(e, a);
+  }
+
+
+  template<Mvec3Expression E>
+  _Mvec3ScaleNode<E, true> operator/(const E &e, const typename E::Scalar a) {
+    return _Mvec3ScaleNode<E, true>(e, a);
+  }
+}
@@ -65,8 +65,8 @@ namespace kmath {
     
 
     static inline _Mat2<T> rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat2<T>(
         _Vec2<T>(cos_angle, sin_angle),
         _Vec2<T>(-sin_angle, cos_angle)
@@ -258,8 +258,8 @@ namespace kmath {
 
 
     static inline _Mat3<T> x_rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat3<T>(
         _Vec3<T>(T(1), T(0)      , T(0)     ),
         _Vec3<T>(T(0), cos_angle , sin_angle),
@@ -269,8 +269,8 @@ namespace kmath {
 
 
     static inline _Mat3<T> y_rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat3<T>(
         _Vec3<T>(cos_angle, T(0), -sin_angle),
         _Vec3<T>(T(0)     , T(1), T(0)      ),
@@ -280,8 +280,8 @@ namespace kmath {
 
 
     static inline _Mat3<T> z_rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat3<T>(
         _Vec3<T>(cos_angle , sin_angle, T(0)),
         _Vec3<T>(-sin_angle, cos_angle, T(0)),
@@ -354,6 +354,23 @@ namespace kmath {
     res.z /= length_squared(res.z);
     return transpose(res);
   }
+
+
+  template<Number T>
+  constexpr T determinant(const _Mat3<T> &m) {
+    return dot(m.x, cross(m.y, m.z));
+  }
+
+
+  // The inverse of any invertible matrix: the rows of the inverse are the cross products of the
+  // columns, divided by the determinant.
+  template<Number T>
+  constexpr _Mat3<T> inverse(const _Mat3<T> &m) {
+    const _Vec3<T> yz = cross(m.y, m.z);
+    const _Vec3<T> zx = cross(m.z, m.x);
+    const _Vec3<T> xy = cross(m.x, m.y);
+    return transpose(_Mat3<T>(yz, zx, xy)) / dot(m.x, yz);
+  }
   
 
   template<Number T>
@@ -507,8 +524,8 @@ namespace kmath {
 
 
     static inline _Mat4<T> x_rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat4<T>(
         _Vec4<T>(T(1), T(0), T(0), T(0)),
         _Vec4<T>(T(0), cos_angle , sin_angle, T(0)),
@@ -519,8 +536,8 @@ namespace kmath {
 
 
     static inline _Mat4<T> y_rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat4<T>(
         _Vec4<T>(cos_angle, T(0), -sin_angle, T(0)),
         _Vec4<T>(T(0), T(1), T(0), T(0)),
@@ -531,8 +548,8 @@ namespace kmath {
 
 
     static inline _Mat4<T> z_rotation(const T angle) {
-      const T cos_angle = cos(angle);
-      const T sin_angle = sin(angle);
+      T sin_angle, cos_angle;
+      sincos(angle, sin_angle, cos_angle);
       return _Mat4<T>(
         _Vec4<T>(cos_angle , sin_angle, T(0), T(0)),
         _Vec4<T>(-sin_angle, cos_angle, T(0), T(0)),
@@ -557,10 +574,10 @@ namespace kmath {
     static constexpr _Mat4<T> orthogonal_rh_no_ndc(const T near, const T far, const T width, const T height) {
       const T inv_nf_dist = T(1) / (far - near);
       return _Mat4<T>(
-        _Vec4<T>(T(2) / width, T(0)         , T(0)                    , T(0)                           ),
-        _Vec4<T>(T(0)        , T(2) / height, T(0)                    , T(0)                           ),
-        _Vec4<T>(T(0)        , T(0)         , (far + near) * inv_nf_dist, T(2) * near * far * inv_nf_dist),
-        _Vec4<T>(T(0)        , T(0)         , T(0)                    , T(1)                           )
+        _Vec4<T>(T(2) / width, T(0)         , T(0)                      , T(0)),
+        _Vec4<T>(T(0)        , T(2) / height, T(0)                      , T(0)),
+        _Vec4<T>(T(0)        , T(0)         , T(2) * inv_nf_dist        , T(0)),
+        _Vec4<T>(T(0)        , T(0)         , -(far + near) * inv_nf_dist, T(1))
       );
     }
 
@@ -570,10 +587,10 @@ namespace kmath {
     static constexpr _Mat4<T> orthogonal_lh_no_ndc(const T near, const T far, const T width, const T height) {
       const T inv_nf_dist = T(1) / (far - near);
       return _Mat4<T>(
-        _Vec4<T>(T(2) / width, T(0)         , T(0)                , T(0)                      ),
-        _Vec4<T>(T(0)        , T(2) / height, T(0)                , T(0)                      ),
-        _Vec4<T>(T(0)        , T(0)         , - T(2) * inv_nf_dist, - (far + near) * inv_nf_dist),
-        _Vec4<T>(T(0)        , T(0)         , T(0)                , T(1)                      )
+        _Vec4<T>(T(2) / width, T(0)         , T(0)                      , T(0)),
+        _Vec4<T>(T(0)        , T(2) / height, T(0)                      , T(0)),
+        _Vec4<T>(T(0)        , T(0)         , -T(2) * inv_nf_dist       , T(0)),
+        _Vec4<T>(T(0)        , T(0)         , -(far + near) * inv_nf_dist, T(1))
       );
     }
 
@@ -877,166 +894,103 @@ namespace kmath {
   }
 
 
-  template<Number T>
-  constexpr _Mat4<T> inverse(const _Mat4<T> &m) {
-    _Mat4<T> inv;
-
-    inv(0, 0) = (
-      + m(1, 1) * m(2, 2) * m(3, 3)
-      - m(1, 1) * m(2, 3) * m(3, 2)
-      - m(2, 1) * m(1, 2) * m(3, 3)
-      + m(2, 1) * m(1, 3) * m(3, 2)
-      + m(3, 1) * m(1, 2) * m(2, 3)
-      - m(3, 1) * m(1, 3) * m(2, 2)
-    );
+  // ===================================
+  // = Matrix4 hardware specialization =
+  // ===================================
 
-    inv(1, 0) = (
-      - m(1, 0) * m(2, 2) * m(3, 3)
-      + m(1, 0) * m(2, 3) * m(3, 2)
-      + m(2, 0) * m(1, 2) * m(3, 3)
-      - m(2, 0) * m(1, 3) * m(3, 2)
-      - m(3, 0) * m(1, 2) * m(2, 3)
-      + m(3, 0) * m(1, 3) * m(2, 2)
-    );
+  // Products of _Mat4<float> (SSE) and _Mat4<double> (AVX): every column is a single register
+  // (see the _Vec4 specialization), a product is a sum of columns scaled by broadcasted scalars.
 
-    inv(2, 0) = (
-      + m(1, 0) * m(2, 1) * m(3, 3)
-      - m(1, 0) * m(2, 3) * m(3, 1)
-      - m(2, 0) * m(1, 1) * m(3, 3)
-      + m(2, 0) * m(1, 3) * m(3, 1)
-      + m(3, 0) * m(1, 1) * m(2, 3)
-      - m(3, 0) * m(1, 3) * m(2, 1)
-    );
 
-    inv(3, 0) = (
-      - m(1, 0) * m(2, 1) * m(3, 2)
-      + m(1, 0) * m(2, 2) * m(3, 1)
-      + m(2, 0) * m(1, 1) * m(3, 2)
-      - m(2, 0) * m(1, 2) * m(3, 1)
-      - m(3, 0) * m(1, 1) * m(2, 2)
-      + m(3, 0) * m(1, 2) * m(2, 1)
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> operator*(const _Mat4<T> &a, const _Vec4<T> &b) {
+    return _from_register<T>(
+      _to_register(a.x) * b.x
+      + _to_register(a.y) * b.y
+      + _to_register(a.z) * b.z
+      + _to_register(a.w) * b.w
     );
+  }
 
-    const T det = (
-      m(0, 0) * inv(0, 0)
-      + m(0, 1) * inv(1, 0)
-      + m(0, 2) * inv(2, 0)
-      + m(0, 3) * inv(3, 0)
-    );
 
-    if (det == T(0)) { // Test for equality since matrices that are almost non-invertible may have a det veeeery close to zero.
-      return _Mat4<T>::ZERO;
-    }
-
-    inv(0, 1) = (
-      - m(0, 1) * m(2, 2) * m(3, 3)
-      + m(0, 1) * m(2, 3) * m(3, 2)
-      + m(2, 1) * m(0, 2) * m(3, 3)
-      - m(2, 1) * m(0, 3) * m(3, 2)
-      - m(3, 1) * m(0, 2) * m(2, 3)
-      + m(3, 1) * m(0, 3) * m(2, 2)
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Mat4<T> operator*(const _Mat4<T> &a, const _Mat4<T> &b) {
+    const _Vec4Register<T> ax = _to_register(a.x);
+    const _Vec4Register<T> ay = _to_register(a.y);
+    const _Vec4Register<T> az = _to_register(a.z);
+    const _Vec4Register<T> aw = _to_register(a.w);
+    return _Mat4<T>(
+      _from_register<T>(ax * b.x.x + ay * b.x.y + az * b.x.z + aw * b.x.w),
+      _from_register<T>(ax * b.y.x + ay * b.y.y + az * b.y.z + aw * b.y.w),
+      _from_register<T>(ax * b.z.x + ay * b.z.y + az * b.z.z + aw * b.z.w),
+      _from_register<T>(ax * b.w.x + ay * b.w.y + az * b.w.z + aw * b.w.w)
     );
+  }
 
-    inv(1, 1) = (
-      + m(0, 0) * m(2, 2) * m(3, 3)
-      - m(0, 0) * m(2, 3) * m(3, 2)
-      - m(2, 0) * m(0, 2) * m(3, 3)
-      + m(2, 0) * m(0, 3) * m(3, 2)
-      + m(3, 0) * m(0, 2) * m(2, 3)
-      - m(3, 0) * m(0, 3) * m(2, 2)
-    );
 
-    inv(2, 1) = (
-      - m(0, 0) * m(2, 1) * m(3, 3)
-      + m(0, 0) * m(2, 3) * m(3, 1)
-      + m(2, 0) * m(0, 1) * m(3, 3)
-      - m(2, 0) * m(0, 3) * m(3, 1)
-      - m(3, 0) * m(0, 1) * m(2, 3)
-      + m(3, 0) * m(0, 3) * m(2, 1)
-    );
+  // Adjugate of m (the transposed matrix of cofactors) and its determinant, from the 2x2 minors of
+  // the first two and of the last two rows (Laplace expansion). Branchless, so that it also runs
+  // on matrices of packs (see matrix_array.hpp).
+  template<Number T>
+  constexpr _Mat4<T> _adjugate(const _Mat4<T> &m, T &r_det) {
+    const T s0 = m(0, 0) * m(1, 1) - m(1, 0) * m(0, 1);
+    const T s1 = m(0, 0) * m(1, 2) - m(1, 0) * m(0, 2);
+    const T s2 = m(0, 0) * m(1, 3) - m(1, 0) * m(0, 3);
+    const T s3 = m(0, 1) * m(1, 2) - m(1, 1) * m(0, 2);
+    const T s4 = m(0, 1) * m(1, 3) - m(1, 1) * m(0, 3);
+    const T s5 = m(0, 2) * m(1, 3) - m(1, 2) * m(0, 3);
 
-    inv(3, 1) = (
-      + m(0, 0) * m(2, 1) * m(3, 2)
-      - m(0, 0) * m(2, 2) * m(3, 1)
-      - m(2, 0) * m(0, 1) * m(3, 2)
-      + m(2, 0) * m(0, 2) * m(3, 1)
-      + m(3, 0) * m(0, 1) * m(2, 2)
-      - m(3, 0) * m(0, 2) * m(2, 1)
-    );
+    const T c0 = m(2, 0) * m(3, 1) - m(3, 0) * m(2, 1);
+    const T c1 = m(2, 0) * m(3, 2) - m(3, 0) * m(2, 2);
+    const T c2 = m(2, 0) * m(3, 3) - m(3, 0) * m(2, 3);
+    const T c3 = m(2, 1) * m(3, 2) - m(3, 1) * m(2, 2);
+    const T c4 = m(2, 1) * m(3, 3) - m(3, 1) * m(2, 3);
+    const T c5 = m(2, 2) * m(3, 3) - m(3, 2) * m(2, 3);
 
-    inv(0, 2) = (
-      + m(0, 1) * m(1, 2) * m(3, 3)
-      - m(0, 1) * m(1, 3) * m(3, 2)
-      - m(1, 1) * m(0, 2) * m(3, 3)
-      + m(1, 1) * m(0, 3) * m(3, 2)
-      + m(3, 1) * m(0, 2) * m(1, 3)
-      - m(3, 1) * m(0, 3) * m(1, 2)
-    );
+    r_det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
 
-    inv(1, 2) = (
-      - m(0, 0) * m(1, 2) * m(3, 3)
-      + m(0, 0) * m(1, 3) * m(3, 2)
-      + m(1, 0) * m(0, 2) * m(3, 3)
-      - m(1, 0) * m(0, 3) * m(3, 2)
-      - m(3, 0) * m(0, 2) * m(1, 3)
-      + m(3, 0) * m(0, 3) * m(1, 2)
-    );
+    _Mat4<T> adj;
+    adj(0, 0) = + m(1, 1) * c5 - m(1, 2) * c4 + m(1, 3) * c3;
+    adj(0, 1) = - m(0, 1) * c5 + m(0, 2) * c4 - m(0, 3) * c3;
+    adj(0, 2) = + m(3, 1) * s5 - m(3, 2) * s4 + m(3, 3) * s3;
+    adj(0, 3) = - m(2, 1) * s5 + m(2, 2) * s4 - m(2, 3) * s3;
 
-    inv(2, 2) = (
-      + m(0, 0) * m(1, 1) * m(3, 3)
-      - m(0, 0) * m(1, 3) * m(3, 1)
-      - m(1, 0) * m(0, 1) * m(3, 3)
-      + m(1, 0) * m(0, 3) * m(3, 1)
-      + m(3, 0) * m(0, 1) * m(1, 3)
-      - m(3, 0) * m(0, 3) * m(1, 1)
-    );
+    adj(1, 0) = - m(1, 0) * c5 + m(1, 2) * c2 - m(1, 3) * c1;
+    adj(1, 1) = + m(0, 0) * c5 - m(0, 2) * c2 + m(0, 3) * c1;
+    adj(1, 2) = - m(3, 0) * s5 + m(3, 2) * s2 - m(3, 3) * s1;
+    adj(1, 3) = + m(2, 0) * s5 - m(2, 2) * s2 + m(2, 3) * s1;
 
-    inv(3, 2) = (
-      - m(0, 0) * m(1, 1) * m(3, 2)
-      + m(0, 0) * m(1, 2) * m(3, 1)
-      + m(1, 0) * m(0, 1) * m(3, 2)
-      - m(1, 0) * m(0, 2) * m(3, 1)
-      - m(3, 0) * m(0, 1) * m(1, 2)
-      + m(3, 0) * m(0, 2) * m(1, 1)
-    );
+    adj(2, 0) = + m(1, 0) * c4 - m(1, 1) * c2 + m(1, 3) * c0;
+    adj(2, 1) = - m(0, 0) * c4 + m(0, 1) * c2 - m(0, 3) * c0;
+    adj(2, 2) = + m(3, 0) * s4 - m(3, 1) * s2 + m(3, 3) * s0;
+    adj(2, 3) = - m(2, 0) * s4 + m(2, 1) * s2 - m(2, 3) * s0;
 
-    inv(0, 3) = (
-      - m(0, 1) * m(1, 2) * m(2, 3)
-      + m(0, 1) * m(1, 3) * m(2, 2)
-      + m(1, 1) * m(0, 2) * m(2, 3)
-      - m(1, 1) * m(0, 3) * m(2, 2)
-      - m(2, 1) * m(0, 2) * m(1, 3)
-      + m(2, 1) * m(0, 3) * m(1, 2)
-    );
+    adj(3, 0) = - m(1, 0) * c3 + m(1, 1) * c1 - m(1, 2) * c0;
+    adj(3, 1) = + m(0, 0) * c3 - m(0, 1) * c1 + m(0, 2) * c0;
+    adj(3, 2) = - m(3, 0) * s3 + m(3, 1) * s1 - m(3, 2) * s0;
+    adj(3, 3) = + m(2, 0) * s3 - m(2, 1) * s1 + m(2, 2) * s0;
+    return adj;
+  }
 
-    inv(1, 3) = (
-      + m(0, 0) * m(1, 2) * m(2, 3)
-      - m(0, 0) * m(1, 3) * m(2, 2)
-      - m(1, 0) * m(0, 2) * m(2, 3)
-      + m(1, 0) * m(0, 3) * m(2, 2)
-      + m(2, 0) * m(0, 2) * m(1, 3)
-      - m(2, 0) * m(0, 3) * m(1, 2)
-    );
 
-    inv(2, 3) = (
-      - m(0, 0) * m(1, 1) * m(2, 3)
-      + m(0, 0) * m(1, 3) * m(2, 1)
-      + m(1, 0) * m(0, 1) * m(2, 3)
-      - m(2, 0) * m(0, 3) * m(2, 1)
-      - m(2, 0) * m(0, 1) * m(1, 3)
-      + m(3, 0) * m(0, 3) * m(1, 1)
-    );
+  template<Number T>
+  constexpr T determinant(const _Mat4<T> &m) {
+    T det;
+    _adjugate(m, det);
+    return det;
+  }
 
-    inv(3, 3) = (
-      + m(0, 0) * m(1, 1) * m(2, 2)
-      - m(0, 0) * m(1, 2) * m(2, 1)
-      - m(1, 0) * m(0, 1) * m(2, 2)
-      + m(1, 0) * m(0, 2) * m(2, 1)
-      + m(2, 0) * m(0, 1) * m(1, 2)
-      - m(2, 0) * m(0, 2) * m(1, 1)
-    );
 
-    return inv / det;
+  template<Number T>
+  constexpr _Mat4<T> inverse(const _Mat4<T> &m) {
+    T det;
+    const _Mat4<T> adj = _adjugate(m, det);
+    if (det == T(0)) { // Test for equality since matrices that are almost non-invertible may have a det veeeery close to zero.
+      return _Mat4<T>::ZERO;
+    }
+    return adj / det;
   }
 
 
@@ -0,0 +1,216 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "simd.hpp"
+#include "matrix.hpp"
+#include "vector_array.hpp"
+
+#include <cstddef>
+#include <span>
+
+
+// Structure of arrays storage for _Mat4: every column is a _Vec4Array, so each of the 16
+// components lives in its own cache line aligned plane.
+//
+// The batch functions load _Mat4<simd::NativePack<T>> values, so every lane of a pack handles a
+// different matrix: with AVX, 8 float matrices are multiplied or inverted at once by the generic
+// functions of matrix.hpp. The array operands of a function must have the same size
+// (KMATH_ASSERT), the result arrays are resized to it and may alias the inputs.
+namespace kmath {
+  template<FloatingPoint T>
+  class _Mat4Array {
+  public:
+    _Mat4Array() = default;
+
+
+    explicit _Mat4Array(const size_t size) {
+      resize(size);
+    }
+
+
+    explicit _Mat4Array(const std::span<const _Mat4<T>> values) {
+      resize(values.size());
+      for (size_t i = 0; i < values.size(); i++) {
+        set(i, values[i]);
+      }
+    }
+
+  public:
+    inline size_t size() const { return columns[0].size(); }
+    inline size_t capacity() const { return columns[0].capacity(); }
+
+
+    // Keeps the first min(size, new_size) matrices
+    void resize(const size_t new_size) {
+      for (_Vec4Array<T> &c: columns) {
+        c.resize(new_size);
+      }
+    }
+
+
+    inline _Mat4<T> get(const size_t index) const {
+      return _Mat4<T>(columns[0].get(index), columns[1].get(index), columns[2].get(index), columns[3].get(index));
+    }
+
+
+    inline void set(const size_t index, const _Mat4<T> &m) {
+      columns[0].set(index, m.x);
+      columns[1].set(index, m.y);
+      columns[2].set(index, m.z);
+      columns[3].set(index, m.w);
+    }
+
+
+    // Array of the c-th column (x, y, z then w)
+    inline _Vec4Array<T> &column(const size_t c) { return columns[c]; }
+    inline const _Vec4Array<T> &column(const size_t c) const { return columns[c]; }
+
+
+    // Loads the P::LANES matrices starting at index as a matrix of packs
+    template<typename P>
+    inline _Mat4<P> load(const size_t index) const {
+      return _Mat4<P>(_load_column<P>(0, index), _load_column<P>(1, index), _load_column<P>(2, index), _load_column<P>(3, index));
+    }
+
+
+    template<typename P>
+    inline void store(const size_t index, const _Mat4<P> &m) {
+      _store_column(0, index, m.x);
+      _store_column(1, index, m.y);
+      _store_column(2, index, m.z);
+      _store_column(3, index, m.w);
+    }
+
+  private:
+    // Direct plane accesses, going through _Vec4<P>::operator[] keeps the packs in memory
+    template<typename P>
+    inline _Vec4<P> _load_column(const size_t c, const size_t index) const {
+      const _Vec4Array<T> &plane = columns[c];
+      return _Vec4<P>(
+        P::load(plane.component(0) + index),
+        P::load(plane.component(1) + index),
+        P::load(plane.component(2) + index),
+        P::load(plane.component(3) + index)
+      );
+    }
+
+
+    template<typename P>
+    inline void _store_column(const size_t c, const size_t index, const _Vec4<P> &v) {
+      _Vec4Array<T> &plane = columns[c];
+      v.x.store(plane.component(0) + index);
+      v.y.store(plane.component(1) + index);
+      v.z.store(plane.component(2) + index);
+      v.w.store(plane.component(3) + index);
+    }
+
+  private:
+    _Vec4Array<T> columns[4];
+  };
+
+
+  template<typename P, FloatingPoint T>
+  inline _Mat4<P> _broadcast_mat4(const _Mat4<T> &m) {
+    _Mat4<P> result;
+    for (size_t i = 0; i < 16; i++) {
+      result(i % 4, i / 4) = P(m(i % 4, i / 4));
+    }
+    return result;
+  }
+
+
+  // ===================
+  // = Batch functions =
+  // ===================
+
+
+  // result[i] = a[i] * b[i]
+  template<FloatingPoint T>
+  void multiply(const _Mat4Array<T> &a, const _Mat4Array<T> &b, _Mat4Array<T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, a.template load<P>(i) * b.template load<P>(i));
+    }
+  }
+
+
+  // result[i] = a[i] * b
+  template<FloatingPoint T>
+  void multiply(const _Mat4Array<T> &a, const _Mat4<T> &b, _Mat4Array<T> &result) {
+    using P = simd::NativePack<T>;
+    const _Mat4<P> bp = _broadcast_mat4<P>(b);
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, a.template load<P>(i) * bp);
+    }
+  }
+
+
+  // result[i] = a * b[i]
+  template<FloatingPoint T>
+  void multiply(const _Mat4<T> &a, const _Mat4Array<T> &b, _Mat4Array<T> &result) {
+    using P = simd::NativePack<T>;
+    const _Mat4<P> ap = _broadcast_mat4<P>(a);
+    result.resize(b.size());
+    for (size_t i = 0; i < b.capacity(); i += P::LANES) {
+      result.store(i, ap * b.template load<P>(i));
+    }
+  }
+
+
+  // result[i] = inverse(m[i]), non-invertible matrices give Mat4::ZERO like the scalar inverse
+  template<FloatingPoint T>
+  void inverse(const _Mat4Array<T> &m, _Mat4Array<T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(m.size());
+    for (size_t i = 0; i < m.capacity(); i += P::LANES) {
+      P det;
+      const _Mat4<P> adj = _adjugate(m.template load<P>(i), det);
+      const simd::_Mask<T, P::LANES> invertible = not_equal(det, P(0));
+      result.store(i, adj * select(invertible, P(1) / select(invertible, det, P(1)), P(0)));
+    }
+  }
+
+
+  template<FloatingPoint T>
+  void transpose(const _Mat4Array<T> &m, _Mat4Array<T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(m.size());
+    for (size_t i = 0; i < m.capacity(); i += P::LANES) {
+      result.store(i, transpose(m.template load<P>(i)));
+    }
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Mat4Array<float> Mat4Array;
+  typedef _Mat4Array<double> Mat4dArray;
+}
@@ -0,0 +1,483 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "matrix.hpp"
+#include "private/unroll.hpp"
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+
+namespace kmath {
+  // ========
+  // = MatN =
+  // ========
+
+
+  // A matrix of R rows and C columns, stored column by column like the other matrices, whose
+  // size is known at compile time.
+  template<Number T, size_t R, size_t C>
+  struct _MatN {
+    T values[C][R];
+
+  public:
+    static constexpr _MatN<T, R, C> from_mat3(const _Mat3<T> &m) requires (R == 3 && C == 3) {
+      _MatN<T, R, C> result;
+      _unroll<0, 3>([&]<size_t j>() {
+        _unroll<0, 3>([&]<size_t i>() { result(i, j) = m(i, j); });
+      });
+      return result;
+    }
+
+
+    static constexpr _MatN<T, R, C> from_mat4(const _Mat4<T> &m) requires (R == 4 && C == 4) {
+      _MatN<T, R, C> result;
+      _unroll<0, 4>([&]<size_t j>() {
+        _unroll<0, 4>([&]<size_t i>() { result(i, j) = m(i, j); });
+      });
+      return result;
+    }
+
+  public:
+    // Column access
+    constexpr _MatN<T, R, 1> &operator[](const size_t j) { return reinterpret_cast<_MatN<T, R, 1>*>(this)[j]; }
+    constexpr const _MatN<T, R, 1> &operator[](const size_t j) const { return reinterpret_cast<const _MatN<T, R, 1>*>(this)[j]; }
+
+    constexpr T &operator()(const size_t i, const size_t j) { return values[j][i]; }
+    constexpr const T &operator()(const size_t i, const size_t j) const { return values[j][i]; }
+
+    // Element access, for column vectors
+    constexpr T &operator()(const size_t i) requires (C == 1) { return values[0][i]; }
+    constexpr const T &operator()(const size_t i) const requires (C == 1) { return values[0][i]; }
+
+  public:
+    static constexpr const size_t ROWS = R;
+    static constexpr const size_t COLUMNS = C;
+
+    static const _MatN<T, R, C> IDENTITY;
+    static const _MatN<T, R, C> ZERO;
+  };
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr const _MatN<T, R, C> _MatN<T, R, C>::IDENTITY = []() {
+    _MatN<T, R, C> result{};
+    _unroll<0, (R < C)? R : C>([&]<size_t i>() { result(i, i) = T(1); });
+    return result;
+  }();
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr const _MatN<T, R, C> _MatN<T, R, C>::ZERO = _MatN<T, R, C>{};
+
+
+  // Column vector of N elements
+  template<Number T, size_t N>
+  using _VecN = _MatN<T, N, 1>;
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr bool is_approx_zero(const _MatN<T, R, C> &a) {
+    bool result = true;
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, R>([&]<size_t i>() { result &= is_approx_zero(a(i, j)); });
+    });
+    return result;
+  }
+
+
+  template<Number T, size_t N>
+  constexpr T trace(const _MatN<T, N, N> &a) {
+    T result = T(0);
+    _unroll<0, N>([&]<size_t i>() { result += a(i, i); });
+    return result;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, C, R> transpose(const _MatN<T, R, C> &m) {
+    _MatN<T, C, R> result;
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, R>([&]<size_t i>() { result(j, i) = m(i, j); });
+    });
+    return result;
+  }
+
+
+  template<Number T, size_t N>
+  constexpr T dot(const _VecN<T, N> &a, const _VecN<T, N> &b) {
+    T result = T(0);
+    _unroll<0, N>([&]<size_t i>() { result += a(i) * b(i); });
+    return result;
+  }
+
+
+  template<Number T, size_t R, size_t K, size_t C>
+  constexpr _MatN<T, R, C> operator*(const _MatN<T, R, K> &a, const _MatN<T, K, C> &b) {
+    _MatN<T, R, C> result{};
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, K>([&]<size_t k>() {
+        _unroll<0, R>([&]<size_t i>() { result(i, j) += a(i, k) * b(k, j); });
+      });
+    });
+    return result;
+  }
+
+
+  template<Number T, size_t N>
+  constexpr _MatN<T, N, N> &operator*=(_MatN<T, N, N> &a, const _MatN<T, N, N> &b) {
+    a = a * b;
+    return a;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> operator+(const _MatN<T, R, C> &a, const _MatN<T, R, C> &b) {
+    _MatN<T, R, C> result;
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, R>([&]<size_t i>() { result(i, j) = a(i, j) + b(i, j); });
+    });
+    return result;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> &operator+=(_MatN<T, R, C> &a, const _MatN<T, R, C> &b) {
+    a = a + b;
+    return a;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> operator-(const _MatN<T, R, C> &a, const _MatN<T, R, C> &b) {
+    _MatN<T, R, C> result;
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, R>([&]<size_t i>() { result(i, j) = a(i, j) - b(i, j); });
+    });
+    return result;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> &operator-=(_MatN<T, R, C> &a, const _MatN<T, R, C> &b) {
+    a = a - b;
+    return a;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> operator*(const _MatN<T, R, C> &a, const T b) {
+    return b * a;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> operator*(const T a, const _MatN<T, R, C> &b) {
+    _MatN<T, R, C> result;
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, R>([&]<size_t i>() { result(i, j) = a * b(i, j); });
+    });
+    return result;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> &operator*=(_MatN<T, R, C> &a, const T b) {
+    a = b * a;
+    return a;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> operator/(const _MatN<T, R, C> &a, const T b) {
+    const T scale = T(1) / b;
+    return scale * a;
+  }
+
+
+  template<Number T, size_t R, size_t C>
+  constexpr _MatN<T, R, C> &operator/=(_MatN<T, R, C> &a, const T b) {
+    a = a / b;
+    return a;
+  }
+
+
+  // ==================
+  // = Factorizations =
+  // ==================
+  //
+  // The factorizations overwrite their input and the solves overwrite their right hand side with
+  // the solution, so that nothing is allocated. The loops are unrolled at compile time, which is
+  // meant for the small systems of solvers (up to a few dozen rows).
+  // A factorization returns false when the matrix is singular, meaning that a pivot is smaller
+  // than max(R, C) machine epsilons of T times the largest coefficient: the rounding error of the
+  // factorization, so that regular but badly scaled systems are still solved. Its content must
+  // then not be used for a solve.
+
+
+  template<FloatingPoint T, size_t R, size_t C>
+  constexpr T _singular_threshold(const _MatN<T, R, C> &a) {
+    T largest = T(0);
+    _unroll<0, C>([&]<size_t j>() {
+      _unroll<0, R>([&]<size_t i>() { largest = max(largest, abs(a(i, j))); });
+    });
+    return T((R > C)? R : C) * std::numeric_limits<T>::epsilon() * largest;
+  }
+
+
+  // Row permutation of a LU factorization: row i was swapped with row pivots[i], in order
+  template<size_t N>
+  using _LUPivots = std::array<size_t, N>;
+
+
+  // P * a = L * U with partial pivoting. L is unit lower triangular and stored below the diagonal
+  // of r_a, U is stored on and above it.
+  template<FloatingPoint T, size_t N>
+  constexpr bool lu_decompose(_MatN<T, N, N> &r_a, _LUPivots<N> &r_pivots) {
+    const T threshold = _singular_threshold(r_a);
+    bool invertible = true;
+    _unroll<0, N>([&]<size_t k>() {
+      size_t pivot = k;
+      T pivot_abs = abs(r_a(k, k));
+      _unroll<k + 1, N>([&]<size_t i>() {
+        const T a = abs(r_a(i, k));
+        if (a > pivot_abs) {
+          pivot = i;
+          pivot_abs = a;
+        }
+      });
+      r_pivots[k] = pivot;
+
+      if (pivot_abs <= threshold) {
+        invertible = false;
+        return;
+      }
+      if (pivot != k) {
+        _unroll<0, N>([&]<size_t j>() { std::swap(r_a(k, j), r_a(pivot, j)); });
+      }
+
+      const T inv_pivot = T(1) / r_a(k, k);
+      _unroll<k + 1, N>([&]<size_t i>() { r_a(i, k) *= inv_pivot; });
+      _unroll<k + 1, N>([&]<size_t j>() {
+        const T a_kj = r_a(k, j);
+        _unroll<k + 1, N>([&]<size_t i>() { r_a(i, j) -= r_a(i, k) * a_kj; });
+      });
+    });
+    return invertible;
+  }
+
+
+  // Solves a * x = b in place from the result of lu_decompose
+  template<FloatingPoint T, size_t N, size_t K>
+  constexpr void lu_solve(const _MatN<T, N, N> &lu, const _LUPivots<N> &pivots, _MatN<T, N, K> &r_b) {
+    _unroll<0, N>([&]<size_t k>() {
+      if (pivots[k] != k) {
+        _unroll<0, K>([&]<size_t j>() { std::swap(r_b(k, j), r_b(pivots[k], j)); });
+      }
+    });
+
+    _unroll<0, K>([&]<size_t j>() {
+      // L * y = P * b
+      _unroll<0, N>([&]<size_t k>() {
+        _unroll<k + 1, N>([&]<size_t i>() { r_b(i, j) -= lu(i, k) * r_b(k, j); });
+      });
+      // U * x = y
+      _unroll<0, N>([&]<size_t rk>() {
+        constexpr size_t k = N - 1 - rk;
+        r_b(k, j) /= lu(k, k);
+        _unroll<0, k>([&]<size_t i>() { r_b(i, j) -= lu(i, k) * r_b(k, j); });
+      });
+    });
+  }
+
+
+  // Determinant from the result of lu_decompose
+  template<FloatingPoint T, size_t N>
+  constexpr T lu_determinant(const _MatN<T, N, N> &lu, const _LUPivots<N> &pivots) {
+    T result = T(1);
+    _unroll<0, N>([&]<size_t k>() {
+      result *= (pivots[k] == k)? lu(k, k) : -lu(k, k);
+    });
+    return result;
+  }
+
+
+  // a = L * transpose(L) for symmetric positive definite matrices. L is stored on and below the
+  // diagonal of r_a, the upper part is left untouched. Returns false if a is not positive definite.
+  template<FloatingPoint T, size_t N>
+  constexpr bool cholesky_decompose(_MatN<T, N, N> &r_a) {
+    const T threshold = _singular_threshold(r_a);
+    bool positive_definite = true;
+    _unroll<0, N>([&]<size_t j>() {
+      T d = r_a(j, j);
+      _unroll<0, j>([&]<size_t k>() { d -= r_a(j, k) * r_a(j, k); });
+      if (!(d > threshold)) {
+        positive_definite = false;
+        return;
+      }
+
+      const T l_jj = sqrt(d);
+      const T inv_l_jj = T(1) / l_jj;
+      r_a(j, j) = l_jj;
+      _unroll<j + 1, N>([&]<size_t i>() {
+        T s = r_a(i, j);
+        _unroll<0, j>([&]<size_t k>() { s -= r_a(i, k) * r_a(j, k); });
+        r_a(i, j) = s * inv_l_jj;
+      });
+    });
+    return positive_definite;
+  }
+
+
+  // Solves a * x = b in place from the result of cholesky_decompose
+  template<FloatingPoint T, size_t N, size_t K>
+  constexpr void cholesky_solve(const _MatN<T, N, N> &l, _MatN<T, N, K> &r_b) {
+    _unroll<0, K>([&]<size_t j>() {
+      // L * y = b
+      _unroll<0, N>([&]<size_t k>() {
+        r_b(k, j) /= l(k, k);
+        _unroll<k + 1, N>([&]<size_t i>() { r_b(i, j) -= l(i, k) * r_b(k, j); });
+      });
+      // transpose(L) * x = y
+      _unroll<0, N>([&]<size_t rk>() {
+        constexpr size_t k = N - 1 - rk;
+        _unroll<k + 1, N>([&]<size_t i>() { r_b(k, j) -= l(i, k) * r_b(i, j); });
+        r_b(k, j) /= l(k, k);
+      });
+    });
+  }
+
+
+  // a = Q * R with Householder reflections, for R >= C. R is stored on and above the diagonal of
+  // r_a. Q is the product of the reflections I - tau[k] * v * transpose(v), where v(k) = 1 and the
+  // rest of v is stored below the diagonal of column k. Returns false if a is rank deficient.
+  template<FloatingPoint T, size_t R, size_t C>
+  requires (R >= C)
+  constexpr bool qr_decompose(_MatN<T, R, C> &r_a, _VecN<T, C> &r_tau) {
+    const T threshold = _singular_threshold(r_a);
+    bool full_rank = true;
+    _unroll<0, C>([&]<size_t k>() {
+      T tail_norm_squared = T(0);
+      _unroll<k + 1, R>([&]<size_t i>() { tail_norm_squared += r_a(i, k) * r_a(i, k); });
+
+      const T alpha = r_a(k, k);
+      if (tail_norm_squared == T(0)) {
+        // Already triangular, the reflection is the identity
+        r_tau(k) = T(0);
+        full_rank &= abs(alpha) > threshold;
+        return;
+      }
+
+      const T norm = sqrt(alpha * alpha + tail_norm_squared);
+      const T beta = (alpha >= T(0))? -norm : norm;
+      full_rank &= norm > threshold;
+      const T inv_v0 = T(1) / (alpha - beta);
+      r_tau(k) = (beta - alpha) / beta;
+      r_a(k, k) = beta;
+      _unroll<k + 1, R>([&]<size_t i>() { r_a(i, k) *= inv_v0; });
+
+      // Applies the reflection to the remaining columns
+      _unroll<k + 1, C>([&]<size_t j>() {
+        T w = r_a(k, j);
+        _unroll<k + 1, R>([&]<size_t i>() { w += r_a(i, k) * r_a(i, j); });
+        w *= r_tau(k);
+        r_a(k, j) -= w;
+        _unroll<k + 1, R>([&]<size_t i>() { r_a(i, j) -= w * r_a(i, k); });
+      });
+    });
+    return full_rank;
+  }
+
+
+  // Solves a * x = b in the least squares sense, in place from the result of qr_decompose. The
+  // solution is stored in the first C rows of r_b, and the norm of the residual of each column is
+  // the norm of its last R - C rows.
+  template<FloatingPoint T, size_t R, size_t C, size_t K>
+  constexpr void qr_solve(const _MatN<T, R, C> &qr, const _VecN<T, C> &tau, _MatN<T, R, K> &r_b) {
+    _unroll<0, K>([&]<size_t j>() {
+      // transpose(Q) * b
+      _unroll<0, C>([&]<size_t k>() {
+        T w = r_b(k, j);
+        _unroll<k + 1, R>([&]<size_t i>() { w += qr(i, k) * r_b(i, j); });
+        w *= tau(k);
+        r_b(k, j) -= w;
+        _unroll<k + 1, R>([&]<size_t i>() { r_b(i, j) -= w * qr(i, k); });
+      });
+      // R * x = transpose(Q) * b
+      _unroll<0, C>([&]<size_t rk>() {
+        constexpr size_t k = C - 1 - rk;
+        r_b(k, j) /= qr(k, k);
+        _unroll<0, k>([&]<size_t i>() { r_b(i, j) -= qr(i, k) * r_b(k, j); });
+      });
+    });
+  }
+
+
+  // The solution of a * x = b, with a LU factorization. ZERO if a is singular.
+  template<FloatingPoint T, size_t N, size_t K>
+  constexpr _MatN<T, N, K> solve(_MatN<T, N, N> a, _MatN<T, N, K> b) {
+    _LUPivots<N> pivots;
+    if (!lu_decompose(a, pivots)) {
+      return _MatN<T, N, K>::ZERO;
+    }
+    lu_solve(a, pivots, b);
+    return b;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr T determinant(_MatN<T, N, N> a) {
+    _LUPivots<N> pivots;
+    if (!lu_decompose(a, pivots)) {
+      return T(0);
+    }
+    return lu_determinant(a, pivots);
+  }
+
+
+  // ZERO if m is singular
+  template<FloatingPoint T, size_t N>
+  constexpr _MatN<T, N, N> inverse(const _MatN<T, N, N> &m) {
+    return solve(m, _MatN<T, N, N>::IDENTITY);
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  template<size_t R, size_t C>
+  using MatN = _MatN<float, R, C>;
+  template<size_t R, size_t C>
+  using MatNd = _MatN<double, R, C>;
+
+  template<size_t N>
+  using VecN = _VecN<float, N>;
+  template<size_t N>
+  using VecNd = _VecN<double, N>;
+}
@@ -0,0 +1,382 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "euclidian_flat_2d.hpp"
+#include "matrix.hpp"
+#include "vector.hpp"
+#include "private/generated/pga2d.hpp"
+
+
+namespace kmath {
+
+  // Rigid motion of the plane, the even subalgebra of R(2, 0, 1): a rotation around a point, or a
+  // translation when e12 is null. It costs 4 components, where a 3D motor restricted to the plane
+  // still stores and multiplies 8.
+  template<Number T>
+  struct _Motor2 {
+    T s, e12, e01, e02;
+
+  public:
+    _Motor2(): _Motor2(IDENTITY) {}
+    _Motor2(const T s, const T e12, const T e01, const T e02): s(s), e12(e12), e01(e01), e02(e02) {}
+
+
+    // Counterclockwise rotation around the origin
+    static inline _Motor2<T> from_angle(const T angle) {
+      T sin_a, cos_a;
+      sincos(T(0.5) * angle, sin_a, cos_a);
+      return _Motor2<T>(cos_a, -sin_a, T(0), T(0));
+    }
+
+
+    static inline _Motor2<T> from_translation(const _Vec2<T> &translation) {
+      return _Motor2<T>(T(1), T(0), T(-0.5) * translation.x, T(-0.5) * translation.y);
+    }
+
+
+    // Rotation followed by the translation
+    static inline _Motor2<T> from_angle_translation(const T angle, const _Vec2<T> &translation) {
+      return from_translation(translation) * from_angle(angle);
+    }
+
+
+    // Counterclockwise rotation around a point
+    static inline _Motor2<T> from_angle_center(const T angle, const _Vec2<T> &center) {
+      return from_translation(center) * from_angle(angle) * from_translation(-center);
+    }
+
+  public:
+    static const _Motor2<T> ZERO;
+    static const _Motor2<T> IDENTITY;
+  };
+
+
+  template<Number T>
+  const _Motor2<T> _Motor2<T>::ZERO = _Motor2<T>(T(0), T(0), T(0), T(0));
+  template<Number T>
+  const _Motor2<T> _Motor2<T>::IDENTITY = _Motor2<T>(T(1), T(0), T(0), T(0));
+
+
+  // ============================
+  // = Motor specific functions =
+  // ============================
+
+
+  template<Number T>
+  constexpr bool is_approx_zero(const _Motor2<T> &m) {
+    return is_approx_zero(*reinterpret_cast<const _Vec4<T>*>(&m));
+  }
+
+
+  // Counterclockwise angle of the rotation
+  template<Number T>
+  inline T get_angle(const _Motor2<T> &m) {
+    return T(2) * atan2(-m.e12, m.s);
+  }
+
+
+  // Translation applied after the rotation, see _Motor2<T>::from_angle_translation
+  template<Number T>
+  inline _Vec2<T> get_translation(const _Motor2<T> &m) {
+    // Image of the origin
+    return _Vec2<T>(
+      m.s * m.e01 + m.e12 * m.e02,
+      m.s * m.e02 - m.e12 * m.e01
+    ) * (T(-2) / magnitude_squared(m));
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> reverse(const _Motor2<T> &m) {
+    return _Motor2<T>(m.s, -m.e12, -m.e01, -m.e02);
+  }
+
+
+  template<Number T>
+  inline T magnitude_squared(const _Motor2<T> &m) {
+    return m.s * m.s + m.e12 * m.e12;
+  }
+
+
+  template<Number T>
+  inline T magnitude(const _Motor2<T> &m) {
+    return sqrt(magnitude_squared(m));
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> inverse(const _Motor2<T> &m) {
+    return reverse(m) / magnitude_squared(m);
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> normalized(const _Motor2<T> &m) {
+    return m / magnitude(m);
+  }
+
+
+  // The bivectors of R(2, 0, 1) are points: exp(p) is the rotation around p by an angle of
+  // -2 * p.e12, or the translation by (-2 * p.e01, 2 * p.e20) for a direction. Since
+  // B = e12 * p.e12 + e01 * p.e01 - e02 * p.e20 squares to -p.e12^2:
+  //
+  // exp(B) = cos(e12) + sin(e12) / e12 * B
+  template<Number T>
+  _Motor2<T> exp(const _Point2<T> &p) {
+    T sin_a, cos_a;
+    sincos(p.e12, sin_a, cos_a);
+    const T k = (is_approx_zero(p.e12))? T(1) : sin_a / p.e12;
+    return _Motor2<T>(cos_a, sin_a, k * p.e01, -k * p.e20);
+  }
+
+
+  // Inverse of exp, up to a factor of m. m = r exp(B) gives e12 = r sin(a) and the other bivectors
+  // r sin(a) / a times those of B, where a = atan2(e12, s).
+  template<Number T>
+  _Point2<T> log(const _Motor2<T> &m) {
+    if (is_approx_zero(m.e12)) {
+      // Translation, r = s (m and -m are the same motion)
+      const T k = T(1) / m.s;
+      return _Point2<T>(-k * m.e02, k * m.e01, k * m.e12);
+    }
+    const T a = atan2(m.e12, m.s);
+    const T k = a / m.e12;
+    return _Point2<T>(-k * m.e02, k * m.e01, a);
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> pow(const _Motor2<T> &m, const T power) {
+    return exp(power * log(m));
+  }
+
+
+  // Homogeneous 2D transform, the last column holds the translation
+  template<Number T>
+  inline _Mat3<T> as_transform(const _Motor2<T> &m) {
+    const T norm = magnitude_squared(m);
+    const _Vec2<T> x = transform_direction(_Vec2<T>::X, m) / norm;
+    const _Vec2<T> y = transform_direction(_Vec2<T>::Y, m) / norm;
+    const _Vec2<T> translation = get_translation(m);
+    return _Mat3<T>(
+      _Vec3<T>(x.x, x.y, T(0)),
+      _Vec3<T>(y.x, y.y, T(0)),
+      _Vec3<T>(translation.x, translation.y, T(1))
+    );
+  }
+
+
+  // ===================
+  // = Motor operators =
+  // ===================
+
+
+  template<Number T>
+  inline _Motor2<T> operator+(const _Motor2<T> &a, const _Motor2<T> &b) {
+    _Motor2<T> r(a);
+    r += b;
+    return r;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> &operator+=(_Motor2<T> &a, const _Motor2<T> &b) {
+    a.s   += b.s;
+    a.e12 += b.e12;
+    a.e01 += b.e01;
+    a.e02 += b.e02;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator-(const _Motor2<T> &a, const _Motor2<T> &b) {
+    _Motor2<T> r(a);
+    r -= b;
+    return r;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> &operator-=(_Motor2<T> &a, const _Motor2<T> &b) {
+    a.s   -= b.s;
+    a.e12 -= b.e12;
+    a.e01 -= b.e01;
+    a.e02 -= b.e02;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator-(const _Motor2<T> &a) {
+    return _Motor2<T>(-a.s, -a.e12, -a.e01, -a.e02);
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator*(const T a, const _Motor2<T> &b) {
+    _Motor2<T> r(b);
+    r *= a;
+    return r;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator*(const _Motor2<T> &b, const T a) {
+    return a * b;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> &operator*=(_Motor2<T> &a, const T b) {
+    a.s   *= b;
+    a.e12 *= b;
+    a.e01 *= b;
+    a.e02 *= b;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator/(const _Motor2<T> &a, const T b) {
+    _Motor2<T> r(a);
+    r /= b;
+    return r;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> &operator/=(_Motor2<T> &a, const T b) {
+    a.s   /= b;
+    a.e12 /= b;
+    a.e01 /= b;
+    a.e02 /= b;
+    return a;
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator*(const _Motor2<T> &a, const _Motor2<T> &b) {
+    return _pga2_motor_product<_Motor2<T>>(a, b);
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> &operator*=(_Motor2<T> &a, const _Motor2<T> &b) {
+    a = a * b;
+    return a;
+  }
+
+
+  // ===========================
+  // = Interpolation functions =
+  // ===========================
+
+
+  // Screw (here a rotation around a fixed point) interpolation, constant speed from a to b
+  template<Number T>
+  _Motor2<T> sclerp(const _Motor2<T> &a, const _Motor2<T> &b, const T t) {
+    return a * exp(t * log(reverse(a) * b));
+  }
+
+
+  // ===================
+  // = Transformations =
+  // ===================
+
+
+  template<Number T>
+  inline _Line2<T> transform(const _Line2<T> &a, const _Motor2<T> &m) {
+    return _pga2_transform_line<_Line2<T>>(m, a);
+  }
+
+
+  template<Number T>
+  inline _Point2<T> transform(const _Point2<T> &a, const _Motor2<T> &m) {
+    return _pga2_transform_point<_Point2<T>>(m, a);
+  }
+
+
+  template<Number T>
+  inline _Vec2<T> transform_point(const _Vec2<T> &a, const _Motor2<T> &m) {
+    const T c = m.s * m.s - m.e12 * m.e12;
+    const T s = T(2) * m.s * m.e12;
+    return _Vec2<T>(
+      a.x * c + a.y * s - T(2) * (m.s * m.e01 + m.e12 * m.e02),
+      a.y * c - a.x * s - T(2) * (m.s * m.e02 - m.e12 * m.e01)
+    ) / magnitude_squared(m);
+  }
+
+
+  template<Number T>
+  inline _Vec2<T> transform_direction(const _Vec2<T> &a, const _Motor2<T> &m) {
+    const T c = m.s * m.s - m.e12 * m.e12;
+    const T s = T(2) * m.s * m.e12;
+    return _Vec2<T>(
+      a.x * c + a.y * s,
+      a.y * c - a.x * s
+    );
+  }
+
+
+  // ========================
+  // = Flat multiplications =
+  // ========================
+
+
+  // Rotation (or translation for parallel lines) by twice the angle from b to a
+  template<Number T>
+  inline _Motor2<T> operator*(const _Line2<T> &a, const _Line2<T> &b) {
+    return _pga2_line_product<_Motor2<T>>(a, b);
+  }
+
+
+  // Translation by twice the vector from b to a, modulo a factor
+  template<Number T>
+  inline _Motor2<T> operator*(const _Point2<T> &a, const _Point2<T> &b) {
+    return _pga2_point_product<_Motor2<T>>(a, b);
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator/(const _Line2<T> &a, const _Line2<T> &b) {
+    return a * reverse(b);
+  }
+
+
+  template<Number T>
+  inline _Motor2<T> operator/(const _Point2<T> &a, const _Point2<T> &b) {
+    return a * reverse(b);
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Motor2<float> Motor2;
+  typedef _Motor2<double> Motor2d;
+}
@@ -28,6 +28,7 @@
 #include "vector.hpp"
 #include "matrix.hpp"
 #include "rotor_3d.hpp"
+#include "private/generated/pga3d.hpp"
 
 
 namespace kmath {
@@ -84,8 +85,8 @@ namespace kmath {
 
     static _Motor3<T> from_screw_coordinates(const _Vec3<T> &direction, const _Vec3<T> &moment, const T angle, const T translation) {
       if (!is_approx_zero(angle)) {
-        T cos_a = cos(angle / 2);
-        T sin_a = sin(angle / 2);
+        T sin_a, cos_a;
+        sincos(angle / 2, sin_a, cos_a);
         return _Motor3<T>(
           _Rotor3<T>(cos_a, sin_a * direction),
           _Rotor3<T>(T(-0.5) * translation * sin_a, sin_a * moment + T(0.5) * translation * cos_a * direction)
@@ -341,8 +342,8 @@ namespace kmath {
     // exp(b) = exp(ul) exp(vlI)
     //        = (cos u + sin u l) (1 + vlI)
     //        = cos u + sin u l + v cos u l I - v sin u I
-    const T cosu = cos(u);
-    const T sinu = sin(u);
+    T sinu, cosu;
+    sincos(u, sinu, cosu);
     const T vcosu = v * cosu;
 
     return _Motor3<T>(
@@ -560,17 +561,7 @@ namespace kmath {
 
   template<Number T>
   inline _Motor3<T> operator*(const _Motor3<T> &a, const _Motor3<T> &b) {
-    return _Motor3<T>(
-      b.s * a.s - b.e23 * a.e23 - a.e31 * b.e31 - b.e12 * a.e12,
-      a.s * b.e23 + b.s * a.e23 - a.e31 * b.e12 + b.e31 * a.e12,
-      a.s * b.e31 + b.s * a.e31 + a.e23 * b.e12 - b.e23 * a.e12,
-      a.s * b.e12 + b.s * a.e12 - a.e23 * b.e31 + b.e23 * a.e31,
-
-      a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12 + b.e01 * a.e23 + b.e02 * a.e31 + b.e03 * a.e12 + a.s * b.e0123 + b.s * a.e0123,
-      a.s * b.e01 + b.s * a.e01 + a.e03 * b.e31 - a.e02 * b.e12 + b.e02 * a.e12 - b.e03 * a.e31 - a.e23 * b.e0123 - b.e23 * a.e0123,
-      a.s * b.e02 + b.s * a.e02 + a.e01 * b.e12 - a.e03 * b.e23 - b.e01 * a.e12 + b.e03 * a.e23 - a.e31 * b.e0123 - b.e31 * a.e0123,
-      a.s * b.e03 + b.s * a.e03 - a.e01 * b.e31 + a.e02 * b.e23 + b.e01 * a.e31 - b.e02 * a.e23 - a.e12 * b.e0123 - b.e12 * a.e0123
-    );
+    return _pga3_motor_product<_Motor3<T>>(a, b);
   }
 
 
@@ -656,36 +647,19 @@ namespace kmath {
 
   template<Number T>
   _Plane3<T> transform(const _Plane3<T> &a, const _Motor3<T> &m) {
-    return _Plane3<T>(
-      - a.e1 * m.e12 * m.e12 - a.e1 * m.e31 * m.e31 + a.e1 * m.s * m.s + a.e1 * m.e23 * m.e23 + T(2) * a.e2 * m.e12 * m.s + T(2) * a.e2 * m.e23 * m.e31 - T(2) * a.e3 * m.s * m.e31 + T(2) * a.e3 * m.e12 * m.e23,
-      - a.e2 * m.e23 * m.e23 - a.e2 * m.e12 * m.e12 + a.e2 * m.s * m.s + a.e2 * m.e31 * m.e31 + T(2) * a.e3 * m.s * m.e23 + T(2) * a.e3 * m.e12 * m.e31 - T(2) * a.e1 * m.s * m.e12 + T(2) * a.e1 * m.e23 * m.e31,
-      - a.e3 * m.e23 * m.e23 - a.e3 * m.e31 * m.e31 + a.e3 * m.s * m.s + a.e3 * m.e12 * m.e12 + T(2) * a.e1 * m.s * m.e31 + T(2) * a.e1 * m.e12 * m.e23 - T(2) * a.e2 * m.s * m.e23 + T(2) * a.e2 * m.e12 * m.e31,
-      - T(2) * a.e1 * m.e02 * m.e12 - T(2) * a.e2 * m.e03 * m.e23 - T(2) * a.e3 * m.e01 * m.e31 + a.e0 * m.s * m.s + a.e0 * m.e23 * m.e23 + a.e0 * m.e31 * m.e31 + a.e0 * m.e12 * m.e12 + T(2) * a.e1 * m.s * m.e01 + T(2) * a.e2 * m.s * m.e02 + T(2) * a.e3 * m.s * m.e03 + T(2) * a.e1 * m.e0123 * m.e23 + T(2) * a.e2 * m.e0123 * m.e31 + T(2) * a.e3 * m.e0123 * m.e12 + T(2) * a.e1 * m.e03 * m.e31 + T(2) * a.e2 * m.e12 * m.e01 + T(2) * a.e3 * m.e02 * m.e23
-    );
+    return _pga3_transform_plane<_Plane3<T>>(m, a);
   }
   
 
   template<Number T>
   _Line3<T> transform(const _Line3<T> &a, const _Motor3<T> &m) {
-    return _Line3<T>(
-      - a.e23 * m.e31 * m.e31 - a.e23 * m.e12 * m.e12 + a.e23 * m.e23 * m.e23 + a.e23 * m.s * m.s + T(2) * a.e31 * m.s * m.e12 - T(2) * a.e12 * m.s * m.e31 + T(2) * a.e31 * m.e23 * m.e31 + T(2) * a.e12 * m.e12 * m.e23,
-      - a.e31 * m.e23 * m.e23 - m.e12 * m.e12 * a.e31 + a.e31 * m.e31 * m.e31 + m.s * m.s * a.e31 - T(2) * a.e23 * m.s * m.e12 + T(2) * a.e12 * m.s * m.e23 + T(2) * a.e12 * m.e12 * m.e31 + T(2) * a.e23 * m.e23 * m.e31,
-      - a.e12 * m.e23 * m.e23 - a.e12 * m.e31 * m.e31 + a.e12 * m.e12 * m.e12 + a.e12 * m.s * m.s + T(2) * a.e23 * m.s * m.e31 - T(2) * a.e31 * m.s * m.e23 + T(2) * a.e23 * m.e12 * m.e23 + T(2) * a.e31 * m.e12 * m.e31,
-      - a.e01 * m.e31 * m.e31 - a.e01 * m.e12 * m.e12 + a.e01 * m.e23 * m.e23 + a.e01 * m.s * m.s - T(2) * a.e12 * m.s * m.e02 - T(2) * a.e03 * m.s * m.e31 - T(2) * a.e23 * m.s * m.e0123 - T(2) * a.e23 * m.e31 * m.e02 - T(2) * a.e23 * m.e12 * m.e03 - T(2) * a.e31 * m.e12 * m.e0123 + T(2) * a.e31 * m.s * m.e03 + T(2) * a.e02 * m.s * m.e12 + T(2) * a.e03 * m.e12 * m.e23 + T(2) * a.e02 * m.e23 * m.e31 + T(2) * a.e31 * m.e01 * m.e31 + T(2) * a.e31 * m.e23 * m.e02 + T(2) * a.e12 * m.e03 * m.e23 + T(2) * a.e12 * m.e12 * m.e01 + T(2) * a.e23 * m.e23 * m.e01 + T(2) * a.e12 * m.e0123 * m.e31,
-      - a.e02 * m.e23 * m.e23 - a.e02 * m.e12 * m.e12 + a.e02 * m.e31 * m.e31 + a.e02 * m.s * m.s + T(2) * a.e12 * m.s * m.e01 - T(2) * a.e01 * m.s * m.e12 - T(2) * a.e23 * m.s * m.e03 - T(2) * a.e31 * m.e23 * m.e01 - T(2) * a.e31 * m.e12 * m.e03 - T(2) * a.e31 * m.s * m.e0123 - T(2) * a.e12 * m.e0123 * m.e23 + T(2) * a.e03 * m.s * m.e23 + T(2) * a.e12 * m.e12 * m.e02 + T(2) * a.e23 * m.e01 * m.e31 + T(2) * a.e31 * m.e31 * m.e02 + T(2) * a.e03 * m.e12 * m.e31 + T(2) * a.e23 * m.e23 * m.e02 + T(2) * a.e01 * m.e23 * m.e31 + T(2) * a.e12 * m.e03 * m.e31 + T(2) * a.e23 * m.e12 * m.e0123,
-      - a.e03 * m.e23 * m.e23 - a.e03 * m.e31 * m.e31 + a.e03 * m.e12 * m.e12 + a.e03 * m.s * m.s - T(2) * a.e02 * m.s * m.e23 - T(2) * a.e31 * m.s * m.e01 + T(2) * a.e23 * m.s * m.e02 - T(2) * a.e12 * m.e23 * m.e01 - T(2) * a.e12 * m.e31 * m.e02 - T(2) * a.e12 * m.s * m.e0123 - T(2) * a.e23 * m.e0123 * m.e31 + T(2) * a.e01 * m.s * m.e31 + T(2) * a.e23 * m.e12 * m.e01 + T(2) * a.e31 * m.e12 * m.e02 + T(2) * a.e12 * m.e12 * m.e03 + T(2) * a.e01 * m.e12 * m.e23 + T(2) * a.e02 * m.e12 * m.e31 + T(2) * a.e23 * m.e03 * m.e23 + T(2) * a.e31 * m.e03 * m.e31 + T(2) * a.e31 * m.e0123 * m.e23
-    );
+    return _pga3_transform_line<_Line3<T>>(m, a);
   }
 
 
   template<Number T>
   _Point3<T> transform(const _Point3<T> &a, const _Motor3<T> &m) {
-    return _Point3<T>(
-      - a.e032 * m.e31 * m.e31 - a.e032 * m.e12 * m.e12 + a.e032 * m.e23 * m.e23 + a.e032 * m.s * m.s - T(2) * a.e021 * m.e31 * m.s - T(2) * a.e123 * m.e01 * m.s - T(2) * a.e123 * m.e02 * m.e12 - T(2) * a.e123 * m.e0123 * m.e23 + T(2) * a.e013 * m.e12 * m.s + T(2) * a.e021 * m.e23 * m.e12 + T(2) * a.e013 * m.e23 * m.e31 + T(2) * a.e123 * m.e31 * m.e03,
-      - a.e013 * m.e12 * m.e12 - a.e013 * m.e23 * m.e23 + a.e013 * m.e31 * m.e31 + a.e013 * m.s * m.s - T(2) * a.e032 * m.e12 * m.s - T(2) * a.e123 * m.e02 * m.s - T(2) * a.e123 * m.e23 * m.e03 - T(2) * a.e123 * m.e0123 * m.e31 + T(2) * a.e021 * m.e23 * m.s + T(2) * a.e032 * m.e23 * m.e31 + T(2) * a.e021 * m.e31 * m.e12 + T(2) * a.e123 * m.e01 * m.e12,
-      - a.e021 * m.e23 * m.e23 - a.e021 * m.e31 * m.e31 + a.e021 * m.e12 * m.e12 + a.e021 * m.s * m.s - T(2) * a.e013 * m.e23 * m.s - T(2) * a.e123 * m.e03 * m.s - T(2) * a.e123 * m.e01 * m.e31 - T(2) * a.e123 * m.e0123 * m.e12 + T(2) * a.e032 * m.e31 * m.s + T(2) * a.e032 * m.e23 * m.e12 + T(2) * a.e013 * m.e31 * m.e12 + T(2) * a.e123 * m.e23 * m.e02,
-      + a.e123 * (m.e23 * m.e23 + m.e31 * m.e31 + m.e12 * m.e12 + m.s * m.s)
-    );
+    return _pga3_transform_point<_Point3<T>>(m, a);
   }
 
 
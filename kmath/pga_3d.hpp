@@ -25,7 +25,12 @@
 #include "base.hpp"
 #include "motor_3d.hpp"
 #include "rotor_3d.hpp"
+#include "simd.hpp"
 #include "vector.hpp"
+#include "private/mvec3_terms.hpp"
+
+#include <bit>
+#include <utility>
 
 
 namespace kmath {
@@ -79,7 +84,7 @@ namespace kmath {
         res[Basis::e123] = (*this)[Basis::e123];
         break;
       case 4:
-        res[Basis::e0123] = res[Basis::e0123];
+        res[Basis::e0123] = (*this)[Basis::e0123];
         break;
       }
       return res;
@@ -165,8 +170,10 @@ namespace kmath {
     }
 
 
+    // Scalar part of *this * rev(), the blades with e0 square to 0
     inline T norm_squared() const {
-      return (*this * this->rev())[0];
+      return data[0] * data[0] + data[2] * data[2] + data[3] * data[3] + data[4] * data[4]
+           + data[8] * data[8] + data[9] * data[9] + data[10] * data[10] + data[14] * data[14];
     }
 
 
@@ -516,7 +523,7 @@ namespace kmath {
   template<Number T>
   _Mvec3<T> operator|(const _Mvec3<T> &a, const _Mvec3<T> &b) {
     _Mvec3<T> res;    
-    res[15] = 1 * (a[15] * b[15]);
+    res[15] = a[15] * b[15];
     res[14] = a[14] * b[15] + a[15] * b[14];
     res[13] = a[13] * b[15] + a[15] * b[13];
     res[12] = a[12] * b[15] + a[15] * b[12];
@@ -800,6 +807,115 @@ namespace kmath {
   }
 
 
+  template<Number T>
+  constexpr bool is_approx_zero(const _Mvec3<T> &a) {
+    bool result = true;
+    for (size_t i = 0; i < 16; i++) {
+      result &= is_approx_zero(a[i]);
+    }
+    return result;
+  }
+
+
+  // ======================================
+  // = Multivector hardware specialization =
+  // ======================================
+
+  // With 512 bit registers, the 16 blades of an _Mvec3<float> fit in a single register. A product
+  // is then a sum of 16 columns, one per blade of a: the blades of b shuffled to the blades of the
+  // result they multiply into, signed and scaled by the broadcasted blade of a,
+  //
+  //   a * b = sum over i of a[i] * column_i(b)
+  //
+  // The shuffles and the signs are generated from the Cayley tables of private/mvec3_terms.hpp.
+  // Narrower registers need several shuffles per column, and are slower than the formulas above
+  // (and so are the two registers of an _Mvec3<double>): arrays of multivectors are faster with
+  // the vertical kernels of batch.hpp.
+
+
+  template<simd::NativeX16 T>
+  using _Mvec3Register = typename simd::_register<T, 16>::type;
+
+
+  // Lane l of column i is the blade of b (or of -b, from lane 16) multiplied by the blade i of a
+  // into the blade l of the result. keep is false for the lanes without such a blade.
+  struct _Mvec3Columns {
+    int lane[16][16];
+    bool keep[16][16];
+  };
+
+
+  constexpr _Mvec3Columns _mvec3_columns(const _Mvec3Product product) {
+    _Mvec3Columns columns{};
+    for (size_t i = 0; i < 16; i++) {
+      for (size_t j = 0; j < 16; j++) {
+        const _Mvec3Term term = _mvec3_term(product, i, j);
+        if (term.sign == 0) continue;
+        columns.lane[i][term.result] = int((term.sign > 0)? j : 16 + j);
+        columns.keep[i][term.result] = true;
+      }
+    }
+    return columns;
+  }
+
+
+  template<_Mvec3Product PRODUCT>
+  constexpr const _Mvec3Columns _MVEC3_COLUMNS = _mvec3_columns(PRODUCT);
+
+
+  template<_Mvec3Product PRODUCT, size_t I, simd::NativeX16 T, size_t... L>
+  inline _Mvec3Register<T> _mvec3_column(const _Mvec3Register<T> b, const _Mvec3Register<T> nb, std::index_sequence<L...>) {
+    using Mask = typename simd::_Mask<T, 16>::Register;
+    constexpr const _Mvec3Columns &columns = _MVEC3_COLUMNS<PRODUCT>;
+    const _Mvec3Register<T> column = __builtin_shufflevector(b, nb, columns.lane[I][L]...);
+    if constexpr ((columns.keep[I][L] && ...)) {
+      return column;
+    } else {
+      constexpr const Mask keep = { (columns.keep[I][L]? -1 : 0)... };
+      return std::bit_cast<_Mvec3Register<T>>(std::bit_cast<Mask>(column) & keep);
+    }
+  }
+
+
+  template<_Mvec3Product PRODUCT, simd::NativeX16 T, size_t... I>
+  inline _Mvec3<T> _mvec3_product(const _Mvec3<T> &a, const _Mvec3<T> &b, std::index_sequence<I...>) {
+    const _Mvec3Register<T> ra = std::bit_cast<_Mvec3Register<T>>(a);
+    const _Mvec3Register<T> rb = std::bit_cast<_Mvec3Register<T>>(b);
+    const _Mvec3Register<T> nb = -rb;
+    _Mvec3Register<T> res = {};
+    ((res += ra[I] * _mvec3_column<PRODUCT, I, T>(rb, nb, std::make_index_sequence<16>())), ...);
+    return std::bit_cast<_Mvec3<T>>(res);
+  }
+
+
+  template<Number T>
+  requires simd::NativeX16<T>
+  _Mvec3<T> operator*(const _Mvec3<T> &a, const _Mvec3<T> &b) {
+    return _mvec3_product<_Mvec3Product::GEOMETRIC>(a, b, std::make_index_sequence<16>());
+  }
+
+
+  template<Number T>
+  requires simd::NativeX16<T>
+  _Mvec3<T> operator&(const _Mvec3<T> &a, const _Mvec3<T> &b) {
+    return _mvec3_product<_Mvec3Product::OUTER>(a, b, std::make_index_sequence<16>());
+  }
+
+
+  template<Number T>
+  requires simd::NativeX16<T>
+  _Mvec3<T> operator|(const _Mvec3<T> &a, const _Mvec3<T> &b) {
+    return _mvec3_product<_Mvec3Product::REGRESSIVE>(a, b, std::make_index_sequence<16>());
+  }
+
+
+  template<Number T>
+  requires simd::NativeX16<T>
+  _Mvec3<T> operator||(const _Mvec3<T> &a, const _Mvec3<T> &b) {
+    return _mvec3_product<_Mvec3Product::INNER>(a, b, std::make_index_sequence<16>());
+  }
+
+
   // ================
   // = Type aliases =
   // ================
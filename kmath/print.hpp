@@ -23,16 +23,40 @@
 
 
 #include "matrix.hpp"
+#include "matrix_n.hpp"
+#include "affine_3d.hpp"
 #include "vector.hpp"
 #include "euclidian_flat_3d.hpp"
 #include "rotor_3d.hpp"
 #include "motor_3d.hpp"
 #include "pga_3d.hpp"
+#include "graded_mvec_3d.hpp"
+#include "simd.hpp"
+#include "fixed.hpp"
+#include "instrument.hpp"
 
 #include <ostream>
 
 
 namespace kmath {
+  // ===========
+  // = Scalars =
+  // ===========
+
+
+  template<Integer I, size_t F>
+  std::ostream &operator<<(std::ostream &stream, const _Fixed<I, F> &o) {
+    return stream << double(o);
+  }
+
+
+  // Not counted
+  template<FloatingPoint T>
+  std::ostream &operator<<(std::ostream &stream, const instrument::Counted<T> &o) {
+    return stream << o.value;
+  }
+
+
   // ===========
   // = Vectors =
   // ===========
@@ -59,6 +83,17 @@ namespace kmath {
   }
 
 
+  template<size_t N>
+  std::ostream &operator<<(std::ostream &stream, const _VecMask<N> &o) {
+    stream << "VecMask(";
+    for (size_t i = 0; i < N; i++) {
+      stream << ((i == 0)? "" : ", ") << ((o[i])? "true" : "false");
+    }
+    stream << ")";
+    return stream;
+  }
+
+
   // ============
   // = Matrices =
   // ============
@@ -91,6 +126,29 @@ namespace kmath {
   }
 
 
+  template<Number T, size_t R, size_t C>
+  std::ostream &operator<<(std::ostream &stream, const _MatN<T, R, C> &o) {
+    stream << "MatN<" << R << ", " << C << ">(";
+    for (size_t j = 0; j < C; j++) {
+      for (size_t i = 0; i < R; i++) {
+        stream << o(i, j) << ((i + 1 < R)? ", " : "");
+      }
+      stream << ((j + 1 < C)? "; " : ")");
+    }
+    return stream;
+  }
+
+
+  template<Number T>
+  std::ostream &operator<<(std::ostream &stream, const _Affine3<T> &o) {
+    stream << "Affine3(" << o.x.x << ", " << o.x.y << ", " << o.x.z << "; ";
+    stream << o.y.x << ", " << o.y.y << ", " << o.y.z << "; ";
+    stream << o.z.x << ", " << o.z.y << ", " << o.z.z << "; ";
+    stream << o.w.x << ", " << o.w.y << ", " << o.w.z << ")";
+    return stream;
+  }
+
+
   // =====================
   // = 3D PGA primitives =
   // =====================
@@ -144,4 +202,39 @@ namespace kmath {
     stream << o[_Mvec3<T>::Basis::e0123] << " e0123";
     return stream;
   }
+
+
+  template<Number T, unsigned GRADES>
+  std::ostream &operator<<(std::ostream &stream, const _GradedMvec3<T, GRADES> &o) {
+    return stream << as_mvec(o);
+  }
+}
+
+
+namespace kmath::simd {
+  // ==============
+  // = SIMD packs =
+  // ==============
+
+
+  template<FloatingPoint T, size_t N>
+  std::ostream &operator<<(std::ostream &stream, const _Pack<T, N> &o) {
+    stream << "[";
+    for (size_t i = 0; i < N; i++) {
+      stream << ((i == 0)? "" : ", ") << o.lane(i);
+    }
+    stream << "]";
+    return stream;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  std::ostream &operator<<(std::ostream &stream, const _Mask<T, N> &o) {
+    stream << "[";
+    for (size_t i = 0; i < N; i++) {
+      stream << ((i == 0)? "" : ", ") << ((o.lane(i))? "true" : "false");
+    }
+    stream << "]";
+    return stream;
+  }
 }
@@ -0,0 +1,620 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+// Included once by every kmath/batch/kernels_<tier>.cpp, each compiled with the instruction set
+// flags of its tier, after defining KMATH_BATCH_TIER to the name of the tier namespace.
+//
+// The kernels are flattened: every kmath function they call is inlined into them, so that no
+// out of line copy of a shared inline function compiled for a higher tier can be picked by the
+// linker and end up called from a lower tier.
+
+
+#ifndef KMATH_BATCH_TIER
+#error "KMATH_BATCH_TIER must be defined before including batch_kernels.hpp"
+#endif
+
+
+#include "batch_table.hpp"
+#include "../simd.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+
+
+namespace kmath::_batch::KMATH_BATCH_TIER {
+  using P = simd::NativePack<float>;
+
+
+  // ====================
+  // = Lane conversions =
+  // ====================
+
+
+  // 3 contiguous registers a, b, c hold N interleaved 3 component vectors (the stream), while 3
+  // planes hold one component each. Both directions go through two shuffles per register: the
+  // first one picks from the two first registers, the second one completes from the third.
+
+
+  // Splits 3 * N contiguous values into 3 planes
+  template<FloatingPoint T, size_t N, size_t... I>
+  inline void _deinterleave3(const T *p_values, simd::_Pack<T, N> (&r_planes)[3], std::index_sequence<I...>) {
+    using PT = simd::_Pack<T, N>;
+    using R = typename PT::Register;
+    // Lane of the stream element s in a:b, then in (a:b shuffled):c
+    constexpr auto first = [](const size_t s) { return (s < 2 * N)? s : 0; };
+    constexpr auto second = [](const size_t s) { return (s < 2 * N)? s / 3 : s - N; };
+
+    const R a = PT::load(p_values).v;
+    const R b = PT::load(p_values + N).v;
+    const R c = PT::load(p_values + 2 * N).v;
+    const R x = __builtin_shufflevector(a, b, first(3 * I)...);
+    const R y = __builtin_shufflevector(a, b, first(3 * I + 1)...);
+    const R z = __builtin_shufflevector(a, b, first(3 * I + 2)...);
+    r_planes[0].v = __builtin_shufflevector(x, c, second(3 * I)...);
+    r_planes[1].v = __builtin_shufflevector(y, c, second(3 * I + 1)...);
+    r_planes[2].v = __builtin_shufflevector(z, c, second(3 * I + 2)...);
+  }
+
+
+  // Merges 3 planes into 3 * N contiguous values
+  template<FloatingPoint T, size_t N, size_t... I>
+  inline void _interleave3(const simd::_Pack<T, N> (&planes)[3], T *p_values, std::index_sequence<I...>) {
+    using PT = simd::_Pack<T, N>;
+    using R = typename PT::Register;
+    // Lane of the stream element s in x:y, then in (x:y shuffled):z
+    constexpr auto first = [](const size_t s) { return (s % 3 == 2)? 0 : (s % 3) * N + s / 3; };
+    constexpr auto second = [](const size_t s) { return (s % 3 == 2)? N + s / 3 : s % N; };
+
+    const R xy_a = __builtin_shufflevector(planes[0].v, planes[1].v, first(I)...);
+    const R xy_b = __builtin_shufflevector(planes[0].v, planes[1].v, first(N + I)...);
+    const R xy_c = __builtin_shufflevector(planes[0].v, planes[1].v, first(2 * N + I)...);
+    PT(__builtin_shufflevector(xy_a, planes[2].v, second(I)...)).store(p_values);
+    PT(__builtin_shufflevector(xy_b, planes[2].v, second(N + I)...)).store(p_values + N);
+    PT(__builtin_shufflevector(xy_c, planes[2].v, second(2 * N + I)...)).store(p_values + 2 * N);
+  }
+
+
+  // Lanes 2i (even) or 2i + 1 (odd) of a:b
+  template<bool ODD, FloatingPoint T, size_t N, size_t... I>
+  inline simd::_Pack<T, N> _unzip(const simd::_Pack<T, N> &a, const simd::_Pack<T, N> &b, std::index_sequence<I...>) {
+    return simd::_Pack<T, N>(__builtin_shufflevector(a.v, b.v, (2 * I + ODD)...));
+  }
+
+
+  // a0, b0, a1, b1... from the low (or high) halves of a and b
+  template<bool HIGH, FloatingPoint T, size_t N, size_t... I>
+  inline simd::_Pack<T, N> _zip(const simd::_Pack<T, N> &a, const simd::_Pack<T, N> &b, std::index_sequence<I...>) {
+    return simd::_Pack<T, N>(__builtin_shufflevector(a.v, b.v, (HIGH * N / 2 + I / 2 + (I % 2) * N)...));
+  }
+
+
+  // Splits K * N contiguous values into K planes, K being a power of 2. Unzipping the registers
+  // pairwise moves the lowest bit of the component index above the bits of the lane index, so
+  // that log2(K) passes leave the component k of every vector in the plane k.
+  template<size_t K, FloatingPoint T, size_t N>
+  inline void _deinterleave(const T *p_values, simd::_Pack<T, N> (&r_planes)[K]) {
+    using PT = simd::_Pack<T, N>;
+    constexpr auto I = std::make_index_sequence<N>();
+    PT values[K];
+    for (size_t k = 0; k < K; k++) {
+      values[k] = PT::load(p_values + k * N);
+    }
+    for (size_t pass = 1; pass < K; pass *= 2) {
+      for (size_t k = 0; k < K / 2; k++) {
+        r_planes[k] = _unzip<false>(values[2 * k], values[2 * k + 1], I);
+        r_planes[K / 2 + k] = _unzip<true>(values[2 * k], values[2 * k + 1], I);
+      }
+      std::copy(r_planes, r_planes + K, values);
+    }
+  }
+
+
+  // Inverse of _deinterleave, by zipping log2(K) times
+  template<size_t K, FloatingPoint T, size_t N>
+  inline void _interleave(const simd::_Pack<T, N> (&planes)[K], T *p_values) {
+    using PT = simd::_Pack<T, N>;
+    constexpr auto I = std::make_index_sequence<N>();
+    PT values[K];
+    PT zipped[K];
+    std::copy(planes, planes + K, values);
+    for (size_t pass = 1; pass < K; pass *= 2) {
+      for (size_t k = 0; k < K / 2; k++) {
+        zipped[2 * k] = _zip<false>(values[k], values[K / 2 + k], I);
+        zipped[2 * k + 1] = _zip<true>(values[k], values[K / 2 + k], I);
+      }
+      std::copy(zipped, zipped + K, values);
+    }
+    for (size_t k = 0; k < K; k++) {
+      values[k].store(p_values + k * N);
+    }
+  }
+
+
+  // Loads min(count, LANES) vectors into the lanes of a vector of packs. Missing lanes are
+  // filled with the first vector, so they never produce more floating point exceptions.
+  template<template<typename> typename VT, FloatingPoint T>
+  inline VT<simd::NativePack<T>> _load(const VT<T> *p_values, const size_t count) {
+    using PT = simd::NativePack<T>;
+    VT<PT> v;
+    if constexpr (VT<T>::SIZE == 2 && sizeof(VT<T>) == 2 * sizeof(T)) {
+      if (count >= PT::LANES) {
+        PT planes[2];
+        _deinterleave(&p_values[0][0], planes);
+        return VT<PT>(planes[0], planes[1]);
+      }
+    }
+    if constexpr (VT<T>::SIZE == 3 && sizeof(VT<T>) == 3 * sizeof(T)) {
+      if (count >= PT::LANES) {
+        PT planes[3];
+        _deinterleave3(&p_values[0][0], planes, std::make_index_sequence<PT::LANES>());
+        return VT<PT>(planes[0], planes[1], planes[2]);
+      }
+    }
+    if constexpr (VT<T>::SIZE == 4 && sizeof(VT<T>) == 4 * sizeof(T)) {
+      if (count >= PT::LANES) {
+        PT planes[4];
+        _deinterleave(&p_values[0][0], planes);
+        return VT<PT>(planes[0], planes[1], planes[2], planes[3]);
+      }
+    }
+
+    for (size_t i = 0; i < PT::LANES; i++) {
+      const VT<T> &value = p_values[(i < count)? i : 0];
+      for (size_t c = 0; c < VT<T>::SIZE; c++) {
+        v[c].set_lane(i, value[c]);
+      }
+    }
+    return v;
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  inline void _store(const VT<simd::NativePack<T>> &v, VT<T> *p_values, const size_t count) {
+    using PT = simd::NativePack<T>;
+    if constexpr (VT<T>::SIZE == 2 && sizeof(VT<T>) == 2 * sizeof(T)) {
+      if (count >= PT::LANES) {
+        const PT planes[2] = { v[0], v[1] };
+        _interleave(planes, &p_values[0][0]);
+        return;
+      }
+    }
+    if constexpr (VT<T>::SIZE == 3 && sizeof(VT<T>) == 3 * sizeof(T)) {
+      if (count >= PT::LANES) {
+        const PT planes[3] = { v[0], v[1], v[2] };
+        _interleave3(planes, &p_values[0][0], std::make_index_sequence<PT::LANES>());
+        return;
+      }
+    }
+    if constexpr (VT<T>::SIZE == 4 && sizeof(VT<T>) == 4 * sizeof(T)) {
+      if (count >= PT::LANES) {
+        const PT planes[4] = { v[0], v[1], v[2], v[3] };
+        _interleave(planes, &p_values[0][0]);
+        return;
+      }
+    }
+
+    const size_t lanes = std::min(count, PT::LANES);
+    for (size_t i = 0; i < lanes; i++) {
+      for (size_t c = 0; c < VT<T>::SIZE; c++) {
+        p_values[i][c] = v[c].lane(i);
+      }
+    }
+  }
+
+
+  inline void _store(const P &v, float *p_values, const size_t count) {
+    const size_t lanes = std::min(count, P::LANES);
+    for (size_t i = 0; i < lanes; i++) {
+      p_values[i] = v.lane(i);
+    }
+  }
+
+
+  // Same as the vector _load and _store, for the 16 blades of multivectors
+  template<FloatingPoint T>
+  inline _Mvec3<simd::NativePack<T>> _load(const _Mvec3<T> *p_values, const size_t count) {
+    using PT = simd::NativePack<T>;
+    static_assert(sizeof(_Mvec3<T>) == 16 * sizeof(T));
+    PT planes[16];
+    if (count >= PT::LANES) {
+      _deinterleave(&p_values[0][0], planes);
+    } else {
+      for (size_t i = 0; i < PT::LANES; i++) {
+        const _Mvec3<T> &value = p_values[(i < count)? i : 0];
+        for (size_t c = 0; c < 16; c++) {
+          planes[c].set_lane(i, value[c]);
+        }
+      }
+    }
+
+    _Mvec3<PT> v;
+    for (size_t c = 0; c < 16; c++) {
+      v[c] = planes[c];
+    }
+    return v;
+  }
+
+
+  template<FloatingPoint T>
+  inline void _store(const _Mvec3<simd::NativePack<T>> &v, _Mvec3<T> *p_values, const size_t count) {
+    using PT = simd::NativePack<T>;
+    PT planes[16];
+    for (size_t c = 0; c < 16; c++) {
+      planes[c] = v[c];
+    }
+    if (count >= PT::LANES) {
+      _interleave(planes, &p_values[0][0]);
+      return;
+    }
+
+    for (size_t i = 0; i < count; i++) {
+      for (size_t c = 0; c < 16; c++) {
+        p_values[i][c] = planes[c].lane(i);
+      }
+    }
+  }
+
+
+  template<FloatingPoint T>
+  inline _Vec4<simd::NativePack<T>> _broadcast(const _Vec4<T> &v) {
+    using PT = simd::NativePack<T>;
+    return _Vec4<PT>(PT(v.x), PT(v.y), PT(v.z), PT(v.w));
+  }
+
+
+  template<FloatingPoint T>
+  inline _Mat4<simd::NativePack<T>> _broadcast(const _Mat4<T> &m) {
+    return _Mat4<simd::NativePack<T>>(_broadcast(m.x), _broadcast(m.y), _broadcast(m.z), _broadcast(m.w));
+  }
+
+
+  inline _Vec3<P> _broadcast(const Vec3 &v) {
+    return _Vec3<P>(P(v.x), P(v.y), P(v.z));
+  }
+
+
+  inline _Mat3<P> _broadcast(const Mat3 &m) {
+    return _Mat3<P>(_broadcast(m.x), _broadcast(m.y), _broadcast(m.z));
+  }
+
+
+  inline _Motor3<P> _broadcast(const Motor3 &m) {
+    return _Motor3<P>(P(m.s), P(m.e23), P(m.e31), P(m.e12), P(m.e0123), P(m.e01), P(m.e02), P(m.e03));
+  }
+
+
+  inline _Motor2<P> _broadcast(const Motor2 &m) {
+    return _Motor2<P>(P(m.s), P(m.e12), P(m.e01), P(m.e02));
+  }
+
+
+  // ===========
+  // = Kernels =
+  // ===========
+
+
+  [[gnu::flatten]]
+  void normalize(const Vec3 *p_v, Vec3 *p_result, const size_t count) {
+    for (size_t i = 0; i < count; i += P::LANES) {
+      _store(normalized(_load(p_v + i, count - i)), p_result + i, count - i);
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void length(const Vec3 *p_v, float *p_result, const size_t count) {
+    for (size_t i = 0; i < count; i += P::LANES) {
+      _store(kmath::length(_load(p_v + i, count - i)), p_result + i, count - i);
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void transform(const Mat4 &m, const Vec4 *p_v, Vec4 *p_result, const size_t count) {
+    const _Mat4<P> mp = _broadcast(m);
+    for (size_t i = 0; i < count; i += P::LANES) {
+      _store(mp * _load(p_v + i, count - i), p_result + i, count - i);
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void transform_points(const Motor3 &m, const Vec3 *p_points, Vec3 *p_result, const size_t count) {
+    const _Motor3<P> mp = _broadcast(m);
+    for (size_t i = 0; i < count; i += P::LANES) {
+      _store(transform_point(_load(p_points + i, count - i), mp), p_result + i, count - i);
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void motor2_transform_points(const Motor2 &m, const Vec2 *p_points, Vec2 *p_result, const size_t count) {
+    const _Motor2<P> mp = _broadcast(m);
+    for (size_t i = 0; i < count; i += P::LANES) {
+      _store(transform_point(_load(p_points + i, count - i), mp), p_result + i, count - i);
+    }
+  }
+
+
+  template<FloatingPoint T>
+  inline void _transform_points(const _Mat4<T> &m, const _Vec3<T> *p_points, _Vec3<T> *p_result, const size_t count) {
+    using PT = simd::NativePack<T>;
+    const _Mat4<PT> mp = _broadcast(m);
+    for (size_t i = 0; i < count; i += PT::LANES) {
+      const _Vec4<PT> p = mp * _Vec4<PT>(_load(p_points + i, count - i), PT(1));
+      _store(p.xyz(), p_result + i, count - i);
+    }
+  }
+
+
+  template<FloatingPoint T>
+  inline void _project_points(const _Mat4<T> &m, const _Vec3<T> *p_points, _Vec3<T> *p_result, const size_t count) {
+    using PT = simd::NativePack<T>;
+    const _Mat4<PT> mp = _broadcast(m);
+    for (size_t i = 0; i < count; i += PT::LANES) {
+      const _Vec4<PT> p = mp * _Vec4<PT>(_load(p_points + i, count - i), PT(1));
+      _store(homogeneous_projection(p), p_result + i, count - i);
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void mat4_transform_points(const Mat4 &m, const Vec3 *p_points, Vec3 *p_result, const size_t count) {
+    _transform_points(m, p_points, p_result, count);
+  }
+
+
+  [[gnu::flatten]]
+  void mat4d_transform_points(const Mat4d &m, const Vec3d *p_points, Vec3d *p_result, const size_t count) {
+    _transform_points(m, p_points, p_result, count);
+  }
+
+
+  [[gnu::flatten]]
+  void mat4_project_points(const Mat4 &m, const Vec3 *p_points, Vec3 *p_result, const size_t count) {
+    _project_points(m, p_points, p_result, count);
+  }
+
+
+  [[gnu::flatten]]
+  void mat4d_project_points(const Mat4d &m, const Vec3d *p_points, Vec3d *p_result, const size_t count) {
+    _project_points(m, p_points, p_result, count);
+  }
+
+
+  [[gnu::flatten]]
+  void decompose(const Mat4 *p_m, Decomposition3 *p_result, const size_t count) {
+    for (size_t i = 0; i < count; i += P::LANES) {
+      const size_t lanes = std::min(count - i, P::LANES);
+      // Gathered per coefficient, then loaded as whole packs
+      float coefficients[9][P::LANES];
+      for (size_t l = 0; l < P::LANES; l++) {
+        const Mat4 &value = p_m[i + ((l < lanes)? l : 0)];
+        for (size_t c = 0; c < 3; c++) {
+          for (size_t r = 0; r < 3; r++) {
+            coefficients[3 * c + r][l] = value(r, c);
+          }
+        }
+      }
+      const _Mat3<P> m(
+        _Vec3<P>(P::load(coefficients[0]), P::load(coefficients[1]), P::load(coefficients[2])),
+        _Vec3<P>(P::load(coefficients[3]), P::load(coefficients[4]), P::load(coefficients[5])),
+        _Vec3<P>(P::load(coefficients[6]), P::load(coefficients[7]), P::load(coefficients[8]))
+      );
+
+      _Mat3<P> rotation, stretch;
+      polar_decompose(m, rotation, stretch);
+
+      // The rotors are extracted per lane, Rotor3::from_basis branches on the trace
+      for (size_t l = 0; l < lanes; l++) {
+        Mat3 r, s;
+        for (size_t c = 0; c < 3; c++) {
+          for (size_t k = 0; k < 3; k++) {
+            r(k, c) = rotation(k, c).lane(l);
+            s(k, c) = stretch(k, c).lane(l);
+          }
+        }
+        p_result[i + l] = Decomposition3(p_m[i + l].w.xyz(), Rotor3::from_basis(r), s);
+      }
+    }
+  }
+
+
+  // Fills one bit per element, 64 elements per word, from the masks of test(i) for the packs of
+  // elements starting at i. The bits past count are cleared.
+  template<typename F>
+  inline void _cull(std::uint64_t *p_visible, const size_t count, F &&test) {
+    static_assert(64 % P::LANES == 0);
+    for (size_t word = 0; 64 * word < count; word++) {
+      std::uint64_t bits = 0;
+      for (size_t j = 0; j < 64 && 64 * word + j < count; j += P::LANES) {
+        const size_t i = 64 * word + j;
+        std::uint64_t lanes = simd::bits(test(i));
+        if (count - i < P::LANES) {
+          lanes &= (std::uint64_t(1) << (count - i)) - 1;
+        }
+        bits |= lanes << j;
+      }
+      p_visible[word] = bits;
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void cull_spheres(const Frustum3 &frustum, const Sphere3 *p_spheres, std::uint64_t *p_visible, const size_t count) {
+    _Vec4<P> planes[6];
+    for (size_t k = 0; k < 6; k++) {
+      planes[k] = _broadcast(Vec4(frustum[k].e1, frustum[k].e2, frustum[k].e3, frustum[k].e0));
+    }
+
+    // A sphere has the layout of a Vec4: center, radius
+    static_assert(sizeof(Sphere3) == sizeof(Vec4));
+    const Vec4 *p_v = reinterpret_cast<const Vec4*>(p_spheres);
+    _cull(p_visible, count, [&](const size_t i) {
+      const _Vec4<P> sphere = _load(p_v + i, count - i);
+      simd::_Mask<float, P::LANES> visible(true);
+      for (size_t k = 0; k < 6; k++) {
+        const _Vec4<P> &n = planes[k];
+        visible = visible && greater_eq(n.x * sphere.x + n.y * sphere.y + n.z * sphere.z + n.w, -sphere.w);
+      }
+      return visible;
+    });
+  }
+
+
+  [[gnu::flatten]]
+  void cull_aabbs(const Frustum3 &frustum, const Aabb3 *p_boxes, std::uint64_t *p_visible, const size_t count) {
+    _Vec4<P> planes[6];
+    _Vec3<P> abs_normals[6];
+    for (size_t k = 0; k < 6; k++) {
+      planes[k] = _broadcast(Vec4(frustum[k].e1, frustum[k].e2, frustum[k].e3, frustum[k].e0));
+      abs_normals[k] = _broadcast(abs(Vec3(frustum[k].e1, frustum[k].e2, frustum[k].e3)));
+    }
+
+    // A box has the layout of two Vec3: min, max. The corners of a pack of boxes are loaded as two
+    // packs of Vec3, then split.
+    constexpr auto I = std::make_index_sequence<P::LANES>();
+    const Vec3 *p_v = reinterpret_cast<const Vec3*>(p_boxes);
+    _cull(p_visible, count, [&](const size_t i) {
+      const size_t corners = 2 * (count - i);
+      const _Vec3<P> low = _load(p_v + 2 * i, corners);
+      const _Vec3<P> high = (corners > P::LANES)? _load(p_v + 2 * i + P::LANES, corners - P::LANES) : low;
+      const _Vec3<P> min(_unzip<false>(low.x, high.x, I), _unzip<false>(low.y, high.y, I), _unzip<false>(low.z, high.z, I));
+      const _Vec3<P> max(_unzip<true>(low.x, high.x, I), _unzip<true>(low.y, high.y, I), _unzip<true>(low.z, high.z, I));
+      const _Vec3<P> center = P(0.5f) * (min + max);
+      const _Vec3<P> extents = P(0.5f) * (max - min);
+
+      simd::_Mask<float, P::LANES> visible(true);
+      for (size_t k = 0; k < 6; k++) {
+        const _Vec4<P> &n = planes[k];
+        const P distance = n.x * center.x + n.y * center.y + n.z * center.z + n.w;
+        visible = visible && greater_eq(distance, -dot(abs_normals[k], extents));
+      }
+      return visible;
+    });
+  }
+
+
+  // Same matrices as ok::lrgb_to_oklab and ok::oklab_to_lrgb
+  [[gnu::flatten]]
+  void rgb_to_oklab(const Rgb *p_rgb, ok::OkLab *p_result, const size_t count) {
+    const _Mat3<P> M1 = _broadcast(Mat3(
+      Vec3(+0.4122214708f, +0.2119034982f, +0.0883024619f),
+      Vec3(+0.5363325363f, +0.6806995451f, +0.2817188376f),
+      Vec3(+0.0514459929f, +0.1073969566f, +0.6299787005f)
+    ));
+    const _Mat3<P> M2 = _broadcast(Mat3(
+      Vec3(+0.2104542553f, +1.9779984951f, +0.0259040371f),
+      Vec3(+0.7936177850f, -2.4285922050f, +0.7827717662f),
+      Vec3(-0.0040720468f, +0.4505937099f, -0.8086757660f)
+    ));
+    for (size_t i = 0; i < count; i += P::LANES) {
+      const _Vec3<P> lrgb = apply(_load(p_rgb + i, count - i), [](const P x) {
+        const P y = pow(abs(x), P(2.2f));
+        return select(greater_eq(x, P(0.0f)), y, -y);
+      });
+      const _Vec3<P> lms = apply(M1 * lrgb, [](const P x) { return cbrt(x); });
+      _store(M2 * lms, p_result + i, count - i);
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void oklab_to_rgb(const ok::OkLab *p_lab, Rgb *p_result, const size_t count) {
+    const _Mat3<P> M2 = _broadcast(Mat3(
+      Vec3(+1.0000000000f, +1.0000000000f, +1.0000000000f),
+      Vec3(+0.3963377774f, -0.1055613458f, -0.0894841775f),
+      Vec3(+0.2158037573f, -0.0638541728f, -1.2914855480f)
+    ));
+    const _Mat3<P> M1 = _broadcast(Mat3(
+      Vec3(+4.0767416621f, -1.2684380046f, -0.0041960863f),
+      Vec3(-3.3077115913f, +2.6097574011f, -0.7034186147f),
+      Vec3(+0.2309699292f, -0.3413193965f, +1.7076147010f)
+    ));
+    for (size_t i = 0; i < count; i += P::LANES) {
+      _Vec3<P> lms = M2 * _load(p_lab + i, count - i);
+      lms = lms * lms * lms;
+      _store(apply(M1 * lms, [](const P x) {
+        const P y = pow(abs(x), P(1.0f / 2.2f));
+        return select(greater_eq(x, P(0.0f)), y, -y);
+      }), p_result + i, count - i);
+    }
+  }
+
+
+  // The product is selected once per call, every branch being a loop over packs of multivectors
+  template<FloatingPoint T>
+  inline void _mvec3_product(const _Mvec3Product product, const _Mvec3<T> *p_a, const _Mvec3<T> *p_b, _Mvec3<T> *p_result, const size_t count) {
+    using PT = simd::NativePack<T>;
+    const auto run = [&](const auto &op) {
+      for (size_t i = 0; i < count; i += PT::LANES) {
+        _store(op(_load(p_a + i, count - i), _load(p_b + i, count - i)), p_result + i, count - i);
+      }
+    };
+    switch (product) {
+    case _Mvec3Product::GEOMETRIC:
+      run([](const _Mvec3<PT> &a, const _Mvec3<PT> &b) { return a * b; });
+      break;
+    case _Mvec3Product::OUTER:
+      run([](const _Mvec3<PT> &a, const _Mvec3<PT> &b) { return a & b; });
+      break;
+    case _Mvec3Product::REGRESSIVE:
+      run([](const _Mvec3<PT> &a, const _Mvec3<PT> &b) { return a | b; });
+      break;
+    case _Mvec3Product::INNER:
+      run([](const _Mvec3<PT> &a, const _Mvec3<PT> &b) { return a || b; });
+      break;
+    }
+  }
+
+
+  [[gnu::flatten]]
+  void mvec3_product(const _Mvec3Product product, const Mvec3 *p_a, const Mvec3 *p_b, Mvec3 *p_result, const size_t count) {
+    _mvec3_product(product, p_a, p_b, p_result, count);
+  }
+
+
+  [[gnu::flatten]]
+  void mvec3d_product(const _Mvec3Product product, const Mvec3d *p_a, const Mvec3d *p_b, Mvec3d *p_result, const size_t count) {
+    _mvec3_product(product, p_a, p_b, p_result, count);
+  }
+
+
+  const _BatchKernels KERNELS{
+    .normalize = &normalize,
+    .length = &length,
+    .transform = &transform,
+    .transform_points = &transform_points,
+    .motor2_transform_points = &motor2_transform_points,
+    .mat4_transform_points = &mat4_transform_points,
+    .mat4d_transform_points = &mat4d_transform_points,
+    .mat4_project_points = &mat4_project_points,
+    .mat4d_project_points = &mat4d_project_points,
+    .decompose = &decompose,
+    .cull_spheres = &cull_spheres,
+    .cull_aabbs = &cull_aabbs,
+    .rgb_to_oklab = &rgb_to_oklab,
+    .oklab_to_rgb = &oklab_to_rgb,
+    .mvec3_product = &mvec3_product,
+    .mvec3d_product = &mvec3d_product,
+  };
+}
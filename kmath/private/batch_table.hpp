@@ -0,0 +1,61 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "../batch.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+
+namespace kmath::_batch {
+  // Kernels of one CPU tier. Every kernel processes count elements.
+  struct _BatchKernels {
+    void (*normalize)(const Vec3 *p_v, Vec3 *p_result, size_t count);
+    void (*length)(const Vec3 *p_v, float *p_result, size_t count);
+    void (*transform)(const Mat4 &m, const Vec4 *p_v, Vec4 *p_result, size_t count);
+    void (*transform_points)(const Motor3 &m, const Vec3 *p_points, Vec3 *p_result, size_t count);
+    void (*motor2_transform_points)(const Motor2 &m, const Vec2 *p_points, Vec2 *p_result, size_t count);
+    void (*mat4_transform_points)(const Mat4 &m, const Vec3 *p_points, Vec3 *p_result, size_t count);
+    void (*mat4d_transform_points)(const Mat4d &m, const Vec3d *p_points, Vec3d *p_result, size_t count);
+    void (*mat4_project_points)(const Mat4 &m, const Vec3 *p_points, Vec3 *p_result, size_t count);
+    void (*mat4d_project_points)(const Mat4d &m, const Vec3d *p_points, Vec3d *p_result, size_t count);
+    void (*decompose)(const Mat4 *p_m, Decomposition3 *p_result, size_t count);
+    void (*cull_spheres)(const Frustum3 &frustum, const Sphere3 *p_spheres, std::uint64_t *p_visible, size_t count);
+    void (*cull_aabbs)(const Frustum3 &frustum, const Aabb3 *p_boxes, std::uint64_t *p_visible, size_t count);
+    void (*rgb_to_oklab)(const Rgb *p_rgb, ok::OkLab *p_result, size_t count);
+    void (*oklab_to_rgb)(const ok::OkLab *p_lab, Rgb *p_result, size_t count);
+    void (*mvec3_product)(_Mvec3Product product, const Mvec3 *p_a, const Mvec3 *p_b, Mvec3 *p_result, size_t count);
+    void (*mvec3d_product)(_Mvec3Product product, const Mvec3d *p_a, const Mvec3d *p_b, Mvec3d *p_result, size_t count);
+  };
+
+
+  namespace baseline { extern const _BatchKernels KERNELS; }
+  namespace sse4_2 { extern const _BatchKernels KERNELS; }
+  namespace avx2 { extern const _BatchKernels KERNELS; }
+  namespace avx512 { extern const _BatchKernels KERNELS; }
+
+
+  // Kernels of the current tier, see dispatch.hpp
+  const _BatchKernels &_kernels();
+}
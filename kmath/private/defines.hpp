@@ -22,6 +22,10 @@
 #pragma once
 
 
+#include <cstdio>
+#include <cstdlib>
+
+
 // =======================
 // = Precision constants =
 // =======================
@@ -34,3 +38,18 @@
 
 #define KMATH_EPSILON2 (KMATH_EPSILON * KMATH_EPSILON)
 
+
+// ==============
+// = Assertions =
+// ==============
+
+
+// Checks the preconditions that would otherwise read or write out of bounds. Enabled unless
+// NDEBUG is defined, define KMATH_ASSERT before including kmath to replace it.
+#ifndef KMATH_ASSERT
+#ifdef NDEBUG
+#define KMATH_ASSERT(condition) ((void)0)
+#else
+#define KMATH_ASSERT(condition) ((condition)? (void)0 : (std::fprintf(stderr, "%s:%d: kmath assertion failed: %s\n", __FILE__, __LINE__, #condition), std::abort()))
+#endif
+#endif
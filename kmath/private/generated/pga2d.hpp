@@ -0,0 +1,164 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+// Kernels of R(2, 0, 1) generated by KMathGenerator from pga2d.spec, regenerate them with the
+// kmath_generate target instead of editing this file.
+//
+// The kernels are templates over the types of the spec: the operands are read through their
+// fields, the result is built from its fields in the order of the spec. T is the scalar type
+// of the result.
+namespace kmath {
+  // geometric product of Motor2 and Motor2 into a Motor2: 12 mul, 8 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga2_motor_product(const A &a, const B &b) {
+    return R(
+      a.s * b.s - a.e12 * b.e12,
+      a.s * b.e12 + a.e12 * b.s,
+      a.s * b.e01 + a.e12 * b.e02 + a.e01 * b.s - a.e02 * b.e12,
+      a.s * b.e02 + a.e01 * b.e12 + a.e02 * b.s - a.e12 * b.e01
+    );
+  }
+
+
+  // geometric product of Line2 and Line2 into a Motor2: 8 mul, 4 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga2_line_product(const A &a, const B &b) {
+    return R(
+      a.e1 * b.e1 + a.e2 * b.e2,
+      a.e1 * b.e2 - a.e2 * b.e1,
+      a.e0 * b.e1 - a.e1 * b.e0,
+      a.e0 * b.e2 - a.e2 * b.e0
+    );
+  }
+
+
+  // geometric product of Point2 and Point2 into a Motor2: 5 mul, 3 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga2_point_product(const A &a, const B &b) {
+    using T = decltype(R::s);
+    return R(
+      - a.e12 * b.e12,
+      T(0),
+      a.e20 * b.e12 - a.e12 * b.e20,
+      a.e01 * b.e12 - a.e12 * b.e01
+    );
+  }
+
+
+  // outer product of Line2 and Line2 into a Point2: 6 mul, 3 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga2_meet(const A &a, const B &b) {
+    return R(
+      a.e2 * b.e0 - a.e0 * b.e2,
+      a.e0 * b.e1 - a.e1 * b.e0,
+      a.e1 * b.e2 - a.e2 * b.e1
+    );
+  }
+
+
+  // regressive product of Point2 and Point2 into a Line2: 6 mul, 3 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga2_join(const A &a, const B &b) {
+    return R(
+      a.e01 * b.e12 - a.e12 * b.e01,
+      a.e12 * b.e20 - a.e20 * b.e12,
+      a.e20 * b.e01 - a.e01 * b.e20
+    );
+  }
+
+
+  // inner product of Line2 and Point2 into a Line2: 4 mul, 2 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga2_inner(const A &a, const B &b) {
+    return R(
+      - a.e2 * b.e12,
+      a.e1 * b.e12,
+      a.e2 * b.e20 - a.e1 * b.e01
+    );
+  }
+
+
+  // Motor2 * Line2 * ~Motor2 into a Line2: 18 mul, 8 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga2_transform_line(const V &v, const X &x) {
+    using T = decltype(R::e1);
+    const T t0 = v.s * v.s;
+    const T t1 = v.s * v.e12;
+    const T t2 = v.e12 * v.e12;
+    const T t3 = t0 - t2;
+    return R(
+      x.e1 * t3 + T(2) * x.e2 * t1,
+      x.e2 * t3 - T(2) * x.e1 * t1,
+      x.e1 * T(2) * (v.s * v.e01 - v.e12 * v.e02) + x.e2 * T(2) * (v.s * v.e02 + v.e12 * v.e01) + x.e0 * (t0 + t2)
+    );
+  }
+
+
+  // Motor2 * Point2 * ~Motor2 into a Point2: 18 mul, 8 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga2_transform_point(const V &v, const X &x) {
+    using T = decltype(R::e20);
+    const T t0 = v.s * v.s;
+    const T t1 = v.s * v.e12;
+    const T t2 = v.e12 * v.e12;
+    const T t3 = t0 - t2;
+    return R(
+      x.e20 * t3 + T(2) * x.e01 * t1 - x.e12 * T(2) * (v.s * v.e01 + v.e12 * v.e02),
+      x.e01 * t3 - x.e12 * T(2) * (v.s * v.e02 - v.e12 * v.e01) - T(2) * x.e20 * t1,
+      x.e12 * (t0 + t2)
+    );
+  }
+
+
+  // Line2 * Line2 * ~Line2 into a Line2: 15 mul, 6 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga2_reflect_line(const V &v, const X &x) {
+    using T = decltype(R::e1);
+    const T t0 = v.e1 * v.e1;
+    const T t1 = v.e1 * v.e2;
+    const T t2 = v.e2 * v.e2;
+    const T t3 = t0 - t2;
+    return R(
+      x.e1 * t3 + T(2) * x.e2 * t1,
+      T(2) * x.e1 * t1 - x.e2 * t3,
+      T(2) * (x.e1 * v.e1 * v.e0 + x.e2 * v.e2 * v.e0) - x.e0 * (t0 + t2)
+    );
+  }
+
+
+  // Line2 * Point2 * ~Line2 into a Point2: 14 mul, 7 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga2_reflect_point(const V &v, const X &x) {
+    using T = decltype(R::e20);
+    const T t0 = v.e1 * v.e1;
+    const T t1 = v.e1 * v.e2;
+    const T t2 = v.e2 * v.e2;
+    const T t3 = t0 - t2;
+    return R(
+      x.e20 * t3 + T(2) * (x.e01 * t1 + x.e12 * v.e1 * v.e0),
+      T(2) * (x.e20 * t1 + x.e12 * v.e2 * v.e0) - x.e01 * t3,
+      - x.e12 * (t0 + t2)
+    );
+  }
+}
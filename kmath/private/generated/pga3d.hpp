@@ -0,0 +1,194 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+// Kernels of R(3, 0, 1) generated by KMathGenerator from pga3d.spec, regenerate them with the
+// kmath_generate target instead of editing this file.
+//
+// The kernels are templates over the types of the spec: the operands are read through their
+// fields, the result is built from its fields in the order of the spec. T is the scalar type
+// of the result.
+namespace kmath {
+  // geometric product of Motor3 and Motor3 into a Motor3: 48 mul, 40 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga3_motor_product(const A &a, const B &b) {
+    return R(
+      a.s * b.s - a.e23 * b.e23 - a.e31 * b.e31 - a.e12 * b.e12,
+      a.s * b.e23 + a.e23 * b.s + a.e12 * b.e31 - a.e31 * b.e12,
+      a.s * b.e31 + a.e23 * b.e12 + a.e31 * b.s - a.e12 * b.e23,
+      a.s * b.e12 + a.e31 * b.e23 + a.e12 * b.s - a.e23 * b.e31,
+      a.s * b.e0123 + a.e23 * b.e01 + a.e31 * b.e02 + a.e12 * b.e03 + a.e0123 * b.s + a.e01 * b.e23 + a.e02 * b.e31 + a.e03 * b.e12,
+      a.s * b.e01 + a.e12 * b.e02 + a.e01 * b.s + a.e03 * b.e31 - a.e23 * b.e0123 - a.e31 * b.e03 - a.e0123 * b.e23 - a.e02 * b.e12,
+      a.s * b.e02 + a.e23 * b.e03 + a.e01 * b.e12 + a.e02 * b.s - a.e31 * b.e0123 - a.e12 * b.e01 - a.e0123 * b.e31 - a.e03 * b.e23,
+      a.s * b.e03 + a.e31 * b.e01 + a.e02 * b.e23 + a.e03 * b.s - a.e23 * b.e02 - a.e12 * b.e0123 - a.e0123 * b.e12 - a.e01 * b.e31
+    );
+  }
+
+
+  // outer product of Plane3 and Plane3 into a Line3: 12 mul, 6 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga3_meet(const A &a, const B &b) {
+    return R(
+      a.e2 * b.e3 - a.e3 * b.e2,
+      a.e3 * b.e1 - a.e1 * b.e3,
+      a.e1 * b.e2 - a.e2 * b.e1,
+      a.e0 * b.e1 - a.e1 * b.e0,
+      a.e0 * b.e2 - a.e2 * b.e0,
+      a.e0 * b.e3 - a.e3 * b.e0
+    );
+  }
+
+
+  // outer product of Plane3 and Line3 into a Point3: 12 mul, 8 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga3_meet_line(const A &a, const B &b) {
+    return R(
+      a.e2 * b.e03 - a.e3 * b.e02 - a.e0 * b.e23,
+      a.e3 * b.e01 - a.e1 * b.e03 - a.e0 * b.e31,
+      a.e1 * b.e02 - a.e2 * b.e01 - a.e0 * b.e12,
+      a.e1 * b.e23 + a.e2 * b.e31 + a.e3 * b.e12
+    );
+  }
+
+
+  // regressive product of Point3 and Point3 into a Line3: 12 mul, 6 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga3_join(const A &a, const B &b) {
+    return R(
+      a.e032 * b.e123 - a.e123 * b.e032,
+      a.e013 * b.e123 - a.e123 * b.e013,
+      a.e021 * b.e123 - a.e123 * b.e021,
+      a.e021 * b.e013 - a.e013 * b.e021,
+      a.e032 * b.e021 - a.e021 * b.e032,
+      a.e013 * b.e032 - a.e032 * b.e013
+    );
+  }
+
+
+  // regressive product of Line3 and Point3 into a Plane3: 12 mul, 9 add
+  template<typename R, typename A, typename B>
+  constexpr R _pga3_join_point(const A &a, const B &b) {
+    return R(
+      a.e31 * b.e021 + a.e01 * b.e123 - a.e12 * b.e013,
+      a.e12 * b.e032 + a.e02 * b.e123 - a.e23 * b.e021,
+      a.e23 * b.e013 + a.e03 * b.e123 - a.e31 * b.e032,
+      - a.e01 * b.e032 - a.e02 * b.e013 - a.e03 * b.e021
+    );
+  }
+
+
+  // Motor3 * Plane3 * ~Motor3 into a Plane3: 44 mul, 36 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga3_transform_plane(const V &v, const X &x) {
+    using T = decltype(R::e1);
+    const T t0 = v.s * v.s;
+    const T t1 = v.s * v.e23;
+    const T t2 = v.s * v.e31;
+    const T t3 = v.s * v.e12;
+    const T t4 = v.e23 * v.e23;
+    const T t5 = v.e23 * v.e31;
+    const T t6 = v.e23 * v.e12;
+    const T t7 = v.e31 * v.e31;
+    const T t8 = v.e31 * v.e12;
+    const T t9 = v.e12 * v.e12;
+    return R(
+      x.e1 * (t0 + t4 - t7 - t9) + x.e2 * T(2) * (t3 + t5) - x.e3 * T(2) * (t2 - t6),
+      x.e2 * (t0 + t7 - t4 - t9) + x.e3 * T(2) * (t1 + t8) - x.e1 * T(2) * (t3 - t5),
+      x.e1 * T(2) * (t2 + t6) + x.e3 * (t0 + t9 - t4 - t7) - x.e2 * T(2) * (t1 - t8),
+      x.e1 * T(2) * (v.s * v.e01 + v.e23 * v.e0123 + v.e31 * v.e03 - v.e12 * v.e02) + x.e2 * T(2) * (v.s * v.e02 + v.e31 * v.e0123 + v.e12 * v.e01 - v.e23 * v.e03) + x.e3 * T(2) * (v.s * v.e03 + v.e23 * v.e02 + v.e12 * v.e0123 - v.e31 * v.e01) + x.e0 * (t0 + t4 + t7 + t9)
+    );
+  }
+
+
+  // Motor3 * Line3 * ~Motor3 into a Line3: 68 mul, 63 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga3_transform_line(const V &v, const X &x) {
+    using T = decltype(R::e23);
+    const T t0 = v.s * v.s;
+    const T t1 = v.s * v.e23;
+    const T t2 = v.s * v.e31;
+    const T t3 = v.s * v.e12;
+    const T t4 = v.s * v.e0123;
+    const T t5 = v.s * v.e01;
+    const T t6 = v.s * v.e02;
+    const T t7 = v.s * v.e03;
+    const T t8 = v.e23 * v.e23;
+    const T t9 = v.e23 * v.e31;
+    const T t10 = v.e23 * v.e12;
+    const T t11 = v.e23 * v.e0123;
+    const T t12 = v.e23 * v.e01;
+    const T t13 = v.e23 * v.e02;
+    const T t14 = v.e23 * v.e03;
+    const T t15 = v.e31 * v.e31;
+    const T t16 = v.e31 * v.e12;
+    const T t17 = v.e31 * v.e0123;
+    const T t18 = v.e31 * v.e01;
+    const T t19 = v.e31 * v.e02;
+    const T t20 = v.e31 * v.e03;
+    const T t21 = v.e12 * v.e12;
+    const T t22 = v.e12 * v.e0123;
+    const T t23 = v.e12 * v.e01;
+    const T t24 = v.e12 * v.e02;
+    const T t25 = v.e12 * v.e03;
+    const T t26 = t0 + t8 - t15 - t21;
+    const T t27 = T(2) * (t3 + t9);
+    const T t28 = T(2) * (t2 - t10);
+    const T t29 = T(2) * (t3 - t9);
+    const T t30 = t0 + t15 - t8 - t21;
+    const T t31 = T(2) * (t1 + t16);
+    const T t32 = T(2) * (t2 + t10);
+    const T t33 = T(2) * (t1 - t16);
+    const T t34 = t0 + t21 - t8 - t15;
+    return R(
+      x.e23 * t26 + x.e31 * t27 - x.e12 * t28,
+      x.e31 * t30 + x.e12 * t31 - x.e23 * t29,
+      x.e23 * t32 + x.e12 * t34 - x.e31 * t33,
+      x.e31 * T(2) * (t7 + t13 + t18 - t22) + x.e01 * t26 + x.e02 * t27 - x.e23 * T(2) * (t4 + t19 + t25 - t12) - x.e12 * T(2) * (t6 - t14 - t17 - t23) - x.e03 * t28,
+      x.e12 * T(2) * (t5 + t20 + t24 - t11) + x.e02 * t30 + x.e03 * t31 - x.e23 * T(2) * (t7 - t13 - t18 - t22) - x.e31 * T(2) * (t4 + t12 + t25 - t19) - x.e01 * t29,
+      x.e23 * T(2) * (t6 + t14 + t23 - t17) + x.e01 * t32 + x.e03 * t34 - x.e31 * T(2) * (t5 - t11 - t20 - t24) - x.e12 * T(2) * (t4 + t12 + t19 - t25) - x.e02 * t33
+    );
+  }
+
+
+  // Motor3 * Point3 * ~Motor3 into a Point3: 44 mul, 36 add
+  template<typename R, typename V, typename X>
+  constexpr R _pga3_transform_point(const V &v, const X &x) {
+    using T = decltype(R::e032);
+    const T t0 = v.s * v.s;
+    const T t1 = v.s * v.e23;
+    const T t2 = v.s * v.e31;
+    const T t3 = v.s * v.e12;
+    const T t4 = v.e23 * v.e23;
+    const T t5 = v.e23 * v.e31;
+    const T t6 = v.e23 * v.e12;
+    const T t7 = v.e31 * v.e31;
+    const T t8 = v.e31 * v.e12;
+    const T t9 = v.e12 * v.e12;
+    return R(
+      x.e032 * (t0 + t4 - t7 - t9) + x.e013 * T(2) * (t3 + t5) - x.e021 * T(2) * (t2 - t6) - x.e123 * T(2) * (v.s * v.e01 + v.e23 * v.e0123 + v.e12 * v.e02 - v.e31 * v.e03),
+      x.e013 * (t0 + t7 - t4 - t9) + x.e021 * T(2) * (t1 + t8) - x.e032 * T(2) * (t3 - t5) - x.e123 * T(2) * (v.s * v.e02 + v.e23 * v.e03 + v.e31 * v.e0123 - v.e12 * v.e01),
+      x.e032 * T(2) * (t2 + t6) + x.e021 * (t0 + t9 - t4 - t7) - x.e013 * T(2) * (t1 - t8) - x.e123 * T(2) * (v.s * v.e03 + v.e31 * v.e01 + v.e12 * v.e0123 - v.e23 * v.e02),
+      x.e123 * (t0 + t4 + t7 + t9)
+    );
+  }
+}
@@ -0,0 +1,110 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include <bit>
+#include <cstddef>
+
+
+// Products of two blades of _Mvec3, from which the sparse products of graded_mvec_3d.hpp and the
+// shuffles of the hardware specialization of pga_3d.hpp are generated
+namespace kmath {
+  enum class _Mvec3Product {
+    GEOMETRIC,
+    OUTER,
+    REGRESSIVE,
+    INNER,
+  };
+
+
+  // Basis vectors of the blades of _Mvec3, bit 0 being e0, and the sign of each blade relative to
+  // the product of its vectors in increasing order (e31 = -e13)
+  constexpr const unsigned _MVEC3_BLADE_VECTORS[16] = {
+    0b0000,
+    0b0001, 0b0010, 0b0100, 0b1000,
+    0b0011, 0b0101, 0b1001, 0b0110, 0b1010, 0b1100,
+    0b0111, 0b1011, 0b1101, 0b1110,
+    0b1111
+  };
+  constexpr const int _MVEC3_BLADE_SIGNS[16] = {
+    1,
+    1, 1, 1, 1,
+    1, 1, 1, 1, -1, 1,
+    -1, 1, -1, 1,
+    1
+  };
+
+
+  constexpr unsigned _mvec3_grade(const size_t blade) {
+    return unsigned(std::popcount(_MVEC3_BLADE_VECTORS[blade]));
+  }
+
+
+  // Product of two blades, the sign is 0 when the product is zero
+  struct _Mvec3Term {
+    size_t a;
+    size_t b;
+    size_t result;
+    int sign;
+  };
+
+
+  constexpr _Mvec3Term _mvec3_term(const _Mvec3Product product, const size_t a, const size_t b) {
+    const unsigned va = _MVEC3_BLADE_VECTORS[a];
+    const unsigned vb = _MVEC3_BLADE_VECTORS[b];
+    switch (product) {
+    case _Mvec3Product::GEOMETRIC: {
+      // e0 * e0 = 0
+      if (va & vb & 1u) return { a, b, 0, 0 };
+      // Swaps sorting the vectors of a and b in increasing order, the common ones squaring to 1
+      unsigned swaps = 0;
+      for (unsigned v = va >> 1; v != 0; v >>= 1) {
+        swaps += unsigned(std::popcount(v & vb));
+      }
+      size_t result = 0;
+      while (_MVEC3_BLADE_VECTORS[result] != (va ^ vb)) {
+        result++;
+      }
+      const int sign = _MVEC3_BLADE_SIGNS[a] * _MVEC3_BLADE_SIGNS[b] * _MVEC3_BLADE_SIGNS[result];
+      return { a, b, result, (swaps % 2 == 0)? sign : -sign };
+    }
+    case _Mvec3Product::OUTER:
+      if (va & vb) return { a, b, 0, 0 };
+      return _mvec3_term(_Mvec3Product::GEOMETRIC, a, b);
+    case _Mvec3Product::REGRESSIVE: {
+      // Dual of the outer product of the duals, the dual mapping blade i to blade 15 - i and
+      // negating bivectors
+      const _Mvec3Term term = _mvec3_term(_Mvec3Product::OUTER, 15 - a, 15 - b);
+      const int sign = term.sign * ((_mvec3_grade(a) == 2)? -1 : 1) * ((_mvec3_grade(b) == 2)? -1 : 1);
+      return { a, b, 15 - term.result, (_mvec3_grade(15 - term.result) == 2)? -sign : sign };
+    }
+    case _Mvec3Product::INNER: {
+      const _Mvec3Term term = _mvec3_term(_Mvec3Product::GEOMETRIC, a, b);
+      const unsigned grade = (_mvec3_grade(a) > _mvec3_grade(b))? _mvec3_grade(a) - _mvec3_grade(b) : _mvec3_grade(b) - _mvec3_grade(a);
+      if (term.sign == 0 || _mvec3_grade(term.result) != grade) return { a, b, 0, 0 };
+      return term;
+    }
+    }
+    return { a, b, 0, 0 };
+  }
+}
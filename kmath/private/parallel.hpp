@@ -0,0 +1,68 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include <algorithm>
+#include <cstddef>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+
+namespace kmath {
+  // Splits [0, count) in contiguous ranges, one per thread, the calling thread processes the
+  // first one. Inputs of less than threshold elements are not split. Ranges start on multiples
+  // of 64 elements: a 64 bit word of a bitmask is never split between threads, and an output
+  // buffer that is itself cache line aligned is not shared. Other buffers share at most the line
+  // at each range boundary, which only costs some false sharing.
+  template<typename F>
+  void _parallel_for(const size_t count, const size_t threshold, F &&body) {
+    if (count < threshold) {
+      body(size_t(0), count);
+      return;
+    }
+
+    // hardware_concurrency() may read /sys on every call, so it is only queried for large inputs
+    const size_t hardware = std::max(std::thread::hardware_concurrency(), 1u);
+    const size_t threads = std::min(hardware, count / std::max(threshold / 2, size_t(1)));
+    if (threads <= 1) {
+      body(size_t(0), count);
+      return;
+    }
+
+    const size_t range = ((count + threads - 1) / threads + 63) / 64 * 64;
+    std::vector<std::thread> workers;
+    for (size_t begin = range; begin < count; begin += range) {
+      const size_t end = std::min(begin + range, count);
+      try {
+        workers.emplace_back(body, begin, end);
+      } catch (const std::system_error &) { // Out of threads, the range is processed here
+        body(begin, end);
+      }
+    }
+    body(size_t(0), std::min(range, count));
+    for (std::thread &worker: workers) {
+      worker.join();
+    }
+  }
+}
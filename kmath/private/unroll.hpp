@@ -0,0 +1,44 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include <cstddef>
+#include <utility>
+
+
+namespace kmath {
+  // Calls op.template operator()<I>() for every I in [BEGIN, END), fully unrolled, so that the
+  // index is a constant expression in the body: _unroll<0, N>([&]<size_t i>() { ... });
+  template<size_t BEGIN, size_t END, typename F, size_t... I>
+  [[gnu::flatten]] constexpr void _unroll(F &op, std::index_sequence<I...>) {
+    (op.template operator()<BEGIN + I>(), ...);
+  }
+
+
+  template<size_t BEGIN, size_t END, typename F>
+  [[gnu::always_inline]] constexpr void _unroll(F &&op) {
+    if constexpr (BEGIN < END) {
+      _unroll<BEGIN, END>(op, std::make_index_sequence<END - BEGIN>());
+    }
+  }
+}
@@ -57,10 +57,9 @@ namespace kmath {
 
 
     static _Rotor3<T> from_axis_angle(const _Vec3<T> &axis, const T angle) {
-      return _Rotor3<T>(
-        T(cos(T(0.5) * angle)),
-        - T(sin(T(0.5) * angle)) * axis
-      );
+      T sin_a, cos_a;
+      sincos(T(0.5) * angle, sin_a, cos_a);
+      return _Rotor3<T>(cos_a, - sin_a * axis);
     }
 
 
@@ -238,9 +237,11 @@ namespace kmath {
 
     if (is_approx_zero(len_v)) return _Rotor3<T>(exp_w, exp_w * get_direction(r));
 
+    T sin_v, cos_v;
+    sincos(len_v, sin_v, cos_v);
     return _Rotor3<T>(
-      exp_w * cos(len_v),
-      (exp_w * sin(len_v) / len_v) * get_direction(r)
+      exp_w * cos_v,
+      (exp_w * sin_v / len_v) * get_direction(r)
     );
   }
 
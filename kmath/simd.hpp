@@ -0,0 +1,1107 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "concepts.hpp"
+
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#if defined(__SSE2__) || defined(__AVX__)
+#include <immintrin.h>
+#endif
+
+
+// Width of the hardware vector registers. Define KMATH_NO_SIMD to disable the hardware
+// specializations of the scalar types (_Vec4<float>, _Mat4<float>...).
+#if !defined(KMATH_NO_SIMD) && (defined(__SSE__) || defined(__ARM_NEON))
+#define KMATH_SIMD_128 1
+#else
+#define KMATH_SIMD_128 0
+#endif
+
+#if !defined(KMATH_NO_SIMD) && defined(__AVX__)
+#define KMATH_SIMD_256 1
+#else
+#define KMATH_SIMD_256 0
+#endif
+
+#if !defined(KMATH_NO_SIMD) && defined(__AVX512F__)
+#define KMATH_SIMD_512 1
+#else
+#define KMATH_SIMD_512 0
+#endif
+
+
+// SIMD packs of floating point numbers. A pack satisfies the Number concept, so every kmath
+// template can be instantiated with it, e.g. _Vec3<f32x8> holds 8 vectors in SoA layout and
+// transform_point(const _Vec3<f32x8>&, const _Motor3<f32x8>&) transforms 8 points at once.
+//
+// Comparisons between packs return masks instead of bool. The mask aware overloads of select,
+// lesser, greater, all, any... are found through ADL, so branchless generic code works on both
+// scalars and packs. Code that branches on a comparison (if (a < b)) does not compile with packs.
+//
+// Packs are built on the GCC / Clang vector extension and lower to SSE / AVX when available.
+// f32x8 and f64x4 are 256 bits wide: without AVX (-mavx) every operation is split in two and
+// GCC warns that the ABI of functions passing them by value changed (-Wpsabi).
+namespace kmath::simd {
+  // =============
+  // = Registers =
+  // =============
+
+  template<typename T, size_t N>
+  struct _register {
+    typedef T type __attribute__((vector_size(sizeof(T) * N)));
+  };
+
+
+  template<FloatingPoint T>
+  using _lane_integer = std::conditional_t<sizeof(T) == 4, std::int32_t, std::int64_t>;
+
+
+  // Scalar types of which 4 lanes fit in a single hardware register
+  template<typename T>
+  concept NativeX4 = (std::same_as<T, float> && bool(KMATH_SIMD_128)) || (std::same_as<T, double> && bool(KMATH_SIMD_256));
+
+
+  // Scalar types of which 16 lanes fit in a single hardware register
+  template<typename T>
+  concept NativeX16 = std::same_as<T, float> && bool(KMATH_SIMD_512);
+
+
+  // =========
+  // = Masks =
+  // =========
+
+
+  // Lane mask of a pack. A lane is either all zeros (false) or all ones (true).
+  template<FloatingPoint T, size_t N>
+  struct _Mask {
+    using Register = typename _register<_lane_integer<T>, N>::type;
+    Register v;
+
+  public:
+    constexpr _Mask(): v{} {}
+    constexpr _Mask(const bool b): v(Register{} - _lane_integer<T>(b)) {}
+    explicit constexpr _Mask(const Register r): v(r) {}
+
+    constexpr bool lane(const size_t index) const { return v[index] != 0; }
+    constexpr void set_lane(const size_t index, const bool b) { v[index] = -_lane_integer<T>(b); }
+
+  public:
+    static constexpr const size_t LANES = N;
+  };
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator&&(const _Mask<T, N> &a, const _Mask<T, N> &b) {
+    return _Mask<T, N>(a.v & b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator||(const _Mask<T, N> &a, const _Mask<T, N> &b) {
+    return _Mask<T, N>(a.v | b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator^(const _Mask<T, N> &a, const _Mask<T, N> &b) {
+    return _Mask<T, N>(a.v ^ b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator!(const _Mask<T, N> &a) {
+    return _Mask<T, N>(~a.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr bool all(const _Mask<T, N> &a) {
+    bool result = true;
+    for (size_t i = 0; i < N; i++) {
+      result &= a.lane(i);
+    }
+    return result;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr bool any(const _Mask<T, N> &a) {
+    bool result = false;
+    for (size_t i = 0; i < N; i++) {
+      result |= a.lane(i);
+    }
+    return result;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr bool none(const _Mask<T, N> &a) {
+    return !any(a);
+  }
+
+
+  // One bit per lane, lane i in bit i (the layout of a movemask)
+  template<FloatingPoint T, size_t N>
+  requires (N <= 64)
+  inline std::uint64_t bits(const _Mask<T, N> &a) {
+#if KMATH_SIMD_512
+    if constexpr(std::same_as<T, float> && N == 16) {
+      return _mm512_cmplt_epi32_mask(std::bit_cast<__m512i>(a.v), _mm512_setzero_si512());
+    } else if constexpr(std::same_as<T, double> && N == 8) {
+      return _mm512_cmplt_epi64_mask(std::bit_cast<__m512i>(a.v), _mm512_setzero_si512());
+    }
+#endif
+#if KMATH_SIMD_256
+    if constexpr(std::same_as<T, float> && N == 8) {
+      return std::uint32_t(_mm256_movemask_ps(std::bit_cast<__m256>(a.v)));
+    } else if constexpr(std::same_as<T, double> && N == 4) {
+      return std::uint32_t(_mm256_movemask_pd(std::bit_cast<__m256d>(a.v)));
+    }
+#endif
+#if KMATH_SIMD_128 && defined(__SSE2__)
+    if constexpr(std::same_as<T, float> && N == 4) {
+      return std::uint32_t(_mm_movemask_ps(std::bit_cast<__m128>(a.v)));
+    } else if constexpr(std::same_as<T, double> && N == 2) {
+      return std::uint32_t(_mm_movemask_pd(std::bit_cast<__m128d>(a.v)));
+    }
+#endif
+    std::uint64_t result = 0;
+    for (size_t i = 0; i < N; i++) {
+      result |= std::uint64_t(a.lane(i)) << i;
+    }
+    return result;
+  }
+
+
+  // =========
+  // = Packs =
+  // =========
+
+
+  template<FloatingPoint T, size_t N>
+  struct _Pack {
+    using Register = typename _register<T, N>::type;
+    Register v;
+
+  public:
+    constexpr _Pack(): v{} {}
+    constexpr _Pack(const T s): v(Register{} + s) {}
+    explicit constexpr _Pack(const Register r): v(r) {}
+
+    template<typename S>
+    requires std::is_arithmetic_v<S> && (!std::same_as<S, T>)
+    explicit constexpr _Pack(const S s): _Pack(T(s)) {}
+
+
+    // Loads N contiguous values, p_values does not need to be aligned
+    static inline _Pack<T, N> load(const T *p_values) {
+      _Pack<T, N> result;
+      std::memcpy(&result.v, p_values, sizeof(Register));
+      return result;
+    }
+
+
+    // Stores the N lanes contiguously, p_values does not need to be aligned
+    inline void store(T *p_values) const {
+      std::memcpy(p_values, &v, sizeof(Register));
+    }
+
+  public:
+    constexpr T lane(const size_t index) const { return v[index]; }
+    constexpr void set_lane(const size_t index, const T value) { v[index] = value; }
+
+  public:
+    static constexpr const size_t LANES = N;
+  };
+
+
+  template<FloatingPoint T, size_t N, typename F>
+  inline _Pack<T, N> _lanewise(const _Pack<T, N> &a, F op) {
+    _Pack<T, N> result;
+    for (size_t i = 0; i < N; i++) {
+      result.v[i] = op(a.v[i]);
+    }
+    return result;
+  }
+
+
+  template<FloatingPoint T, size_t N, typename F>
+  inline _Pack<T, N> _lanewise(const _Pack<T, N> &a, const _Pack<T, N> &b, F op) {
+    _Pack<T, N> result;
+    for (size_t i = 0; i < N; i++) {
+      result.v[i] = op(a.v[i], b.v[i]);
+    }
+    return result;
+  }
+
+
+  template<FloatingPoint T, size_t N, typename F>
+  inline _Mask<T, N> _lanewise_test(const _Pack<T, N> &a, F op) {
+    _Mask<T, N> result;
+    for (size_t i = 0; i < N; i++) {
+      result.set_lane(i, op(a.v[i]));
+    }
+    return result;
+  }
+
+
+  // ===================
+  // = Pack operations =
+  // ===================
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> select(const _Mask<T, N> &condition, const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    using I = typename _Mask<T, N>::Register;
+    const I bits = (condition.v & std::bit_cast<I>(a.v)) | (~condition.v & std::bit_cast<I>(b.v));
+    return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(bits));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> equal(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Mask<T, N>(std::bit_cast<typename _Mask<T, N>::Register>(a.v == b.v));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> not_equal(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Mask<T, N>(std::bit_cast<typename _Mask<T, N>::Register>(a.v != b.v));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> lesser(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Mask<T, N>(std::bit_cast<typename _Mask<T, N>::Register>(a.v < b.v));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> lesser_eq(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Mask<T, N>(std::bit_cast<typename _Mask<T, N>::Register>(a.v <= b.v));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> greater(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Mask<T, N>(std::bit_cast<typename _Mask<T, N>::Register>(a.v > b.v));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> greater_eq(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Mask<T, N>(std::bit_cast<typename _Mask<T, N>::Register>(a.v >= b.v));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator==(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return equal(a, b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator!=(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return not_equal(a, b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator<(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return lesser(a, b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator<=(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return lesser_eq(a, b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator>(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return greater(a, b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> operator>=(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return greater_eq(a, b);
+  }
+
+
+  // ==================
+  // = Pack operators =
+  // ==================
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator+(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Pack<T, N>(a.v + b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> &operator+=(_Pack<T, N> &a, const _Pack<T, N> &b) {
+    a.v += b.v;
+    return a;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator-(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Pack<T, N>(a.v - b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> &operator-=(_Pack<T, N> &a, const _Pack<T, N> &b) {
+    a.v -= b.v;
+    return a;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator+(const _Pack<T, N> &a) {
+    return a;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator-(const _Pack<T, N> &a) {
+    return _Pack<T, N>(-a.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator*(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Pack<T, N>(a.v * b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator*(const T a, const _Pack<T, N> &b) {
+    return _Pack<T, N>(a * b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator*(const _Pack<T, N> &a, const T b) {
+    return _Pack<T, N>(a.v * b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> &operator*=(_Pack<T, N> &a, const _Pack<T, N> &b) {
+    a.v *= b.v;
+    return a;
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator/(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _Pack<T, N>(a.v / b.v);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> operator/(const _Pack<T, N> &a, const T b) {
+    return _Pack<T, N>(a.v / b);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> &operator/=(_Pack<T, N> &a, const _Pack<T, N> &b) {
+    a.v /= b.v;
+    return a;
+  }
+
+
+  // ==========================
+  // = Mathematical Functions =
+  // ==========================
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> abs(const _Pack<T, N> &a) {
+    using I = typename _Mask<T, N>::Register;
+    const I magnitude = std::bit_cast<I>(a.v) & std::numeric_limits<_lane_integer<T>>::max();
+    return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(magnitude));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> sign(const _Pack<T, N> &a) {
+    return select(greater(a, _Pack<T, N>(T(0))), _Pack<T, N>(T(1)), _Pack<T, N>(T(0)))
+      - select(lesser(a, _Pack<T, N>(T(0))), _Pack<T, N>(T(1)), _Pack<T, N>(T(0)));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> possign(const _Pack<T, N> &a) {
+    return select(lesser(a, _Pack<T, N>(T(0))), _Pack<T, N>(T(-1)), _Pack<T, N>(T(1)));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> negsign(const _Pack<T, N> &a) {
+    return select(greater(a, _Pack<T, N>(T(0))), _Pack<T, N>(T(1)), _Pack<T, N>(T(-1)));
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> min(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return select(lesser(b, a), b, a);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Pack<T, N> max(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return select(lesser(a, b), b, a);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> mod(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _lanewise(a, b, [](const T a, const T b) { return std::fmod(a, b); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> remainder(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    return _lanewise(a, b, [](const T a, const T b) { return std::remainder(a, b); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> fma(const _Pack<T, N> &a, const _Pack<T, N> &b, const _Pack<T, N> &c) {
+#if !defined(KMATH_NO_SIMD) && defined(__FMA__)
+    if constexpr(std::same_as<T, float> && N == 8) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm256_fmadd_ps(std::bit_cast<__m256>(a.v), std::bit_cast<__m256>(b.v), std::bit_cast<__m256>(c.v))));
+    } else if constexpr(std::same_as<T, float> && N == 4) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm_fmadd_ps(std::bit_cast<__m128>(a.v), std::bit_cast<__m128>(b.v), std::bit_cast<__m128>(c.v))));
+    } else if constexpr(std::same_as<T, double> && N == 4) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm256_fmadd_pd(std::bit_cast<__m256d>(a.v), std::bit_cast<__m256d>(b.v), std::bit_cast<__m256d>(c.v))));
+    }
+#endif
+    _Pack<T, N> result;
+    for (size_t i = 0; i < N; i++) {
+      result.v[i] = std::fma(a.v[i], b.v[i], c.v[i]);
+    }
+    return result;
+  }
+
+
+  // ============================
+  // = Single precision kernels =
+  // ============================
+
+  // Polynomial approximations evaluated on whole packs (Cephes coefficients). Lanes outside of the
+  // fast path domain (non finite, denormal, huge arguments...) make the whole pack fall back to the
+  // std:: functions, so the special values are the ones of the standard library.
+  //
+  // Maximum error measured against a double precision reference on the fast path domain:
+  //   exp       2 ulp    x in [-87.3, 88.7]
+  //   ln        1 ulp    x normal and positive
+  //   sin, cos  2 ulp    |x| <= 4, absolute error below 8e-8 up to |x| = 8192
+  //   atan      3 ulp
+  //   atan2     3 ulp    x != 0
+  //   cbrt      4 ulp    x normal
+  //   pow       grows with |b ln(a)| as it is exp(b ln(a)), 11 ulp for results in [1e-4, 1e5]
+
+
+  template<size_t N>
+  using _Float32Register = typename _Pack<float, N>::Register;
+
+
+  template<size_t N>
+  using _Int32Register = typename _Mask<float, N>::Register;
+
+
+  template<size_t N>
+  inline _Pack<float, N> _exp_f32(const _Pack<float, N> &a) {
+    using F = _Float32Register<N>;
+    using I = _Int32Register<N>;
+    const F x = a.v;
+
+    const I special = ~(x >= -87.33654475f) | ~(x <= 88.72283905f);
+    if (any(_Mask<float, N>(special))) {
+      return _lanewise(a, [](const float a) { return std::exp(a); });
+    }
+
+    // exp(x) = 2^n exp(r), with n = round(x / ln(2)) and |r| <= ln(2) / 2
+    F fn = x * 1.44269504088896341f + 0.5f;
+    const F truncated = __builtin_convertvector(__builtin_convertvector(fn, I), F);
+    fn = truncated + __builtin_convertvector(truncated > fn, F); // floor
+    const F r = x - fn * 0.693359375f - fn * -2.12194440e-4f;
+
+    F y = 1.9875691500e-4f * r + 1.3981999507e-3f;
+    y = y * r + 8.3334519073e-3f;
+    y = y * r + 4.1665795894e-2f;
+    y = y * r + 1.6666665459e-1f;
+    y = y * r + 5.0000001201e-1f;
+    y = y * r * r + r + 1.0f;
+
+    // n is in [-126, 128], split it so that both powers of two are normal numbers
+    const I n = __builtin_convertvector(fn, I);
+    const I n1 = n >> 1;
+    const I n2 = n - n1;
+    y *= std::bit_cast<F>((n1 + 127) << 23);
+    y *= std::bit_cast<F>((n2 + 127) << 23);
+    return _Pack<float, N>(y);
+  }
+
+
+  template<size_t N>
+  inline _Pack<float, N> _ln_f32(const _Pack<float, N> &a) {
+    using F = _Float32Register<N>;
+    using I = _Int32Register<N>;
+    const F x = a.v;
+
+    const I special = ~(x >= std::numeric_limits<float>::min()) | ~(x <= std::numeric_limits<float>::max());
+    if (any(_Mask<float, N>(special))) {
+      return _lanewise(a, [](const float a) { return std::log(a); });
+    }
+
+    // x = 2^e m, with m in [sqrt(2) / 2, sqrt(2)[
+    const I bits = std::bit_cast<I>(x);
+    I e = (bits >> 23) - 126;
+    F m = std::bit_cast<F>((bits & 0x807fffff) | 0x3f000000);
+    const I small = m < 0.707106781186547524f;
+    e += small;
+    m = m - 1.0f + std::bit_cast<F>(small & std::bit_cast<I>(m));
+
+    const F z = m * m;
+    F y = 7.0376836292e-2f * m - 1.1514610310e-1f;
+    y = y * m + 1.1676998740e-1f;
+    y = y * m - 1.2420140846e-1f;
+    y = y * m + 1.4249322787e-1f;
+    y = y * m - 1.6668057665e-1f;
+    y = y * m + 2.0000714765e-1f;
+    y = y * m - 2.4999993993e-1f;
+    y = y * m + 3.3333331174e-1f;
+    y = y * m * z;
+
+    const F fe = __builtin_convertvector(e, F);
+    y += fe * -2.12194440e-4f;
+    y -= 0.5f * z;
+    return _Pack<float, N>(m + y + fe * 0.693359375f);
+  }
+
+
+  template<size_t N>
+  inline void _sincos_f32(const _Pack<float, N> &a, _Pack<float, N> &sin_a, _Pack<float, N> &cos_a) {
+    using F = _Float32Register<N>;
+    using I = _Int32Register<N>;
+    const F x = a.v;
+    const I x_bits = std::bit_cast<I>(x);
+    const F ax = std::bit_cast<F>(x_bits & 0x7fffffff);
+
+    const I special = ~(ax <= 8192.0f);
+    if (any(_Mask<float, N>(special))) {
+      sin_a = _lanewise(a, [](const float a) { return std::sin(a); });
+      cos_a = _lanewise(a, [](const float a) { return std::cos(a); });
+      return;
+    }
+
+    // Reduction to r = x - j pi / 4 in [-pi / 4, pi / 4], j being even
+    I j = __builtin_convertvector(ax * 1.27323954473516f, I);
+    j = (j + 1) & ~1;
+    const F fj = __builtin_convertvector(j, F);
+    const F r = ((ax - fj * 0.78515625f) - fj * 2.4187564849853515625e-4f) - fj * 3.77489497744594108e-8f;
+    const F z = r * r;
+
+    F cos_r = 2.443315711809948e-5f * z - 1.388731625493765e-3f;
+    cos_r = cos_r * z + 4.166664568298827e-2f;
+    cos_r = cos_r * z * z - 0.5f * z + 1.0f;
+
+    F sin_r = -1.9515295891e-4f * z + 8.3321608736e-3f;
+    sin_r = sin_r * z - 1.6666654611e-1f;
+    sin_r = sin_r * z * r + r;
+
+    const I use_sin = (j & 2) == 0;
+    const I sin_sign = (x_bits ^ (j << 29)) & (1 << 31);
+    const I cos_sign = (~(j - 2) << 29) & (1 << 31);
+    const I sin_bits = (use_sin & std::bit_cast<I>(sin_r)) | (~use_sin & std::bit_cast<I>(cos_r));
+    const I cos_bits = (use_sin & std::bit_cast<I>(cos_r)) | (~use_sin & std::bit_cast<I>(sin_r));
+    sin_a = _Pack<float, N>(std::bit_cast<F>(sin_bits ^ sin_sign));
+    cos_a = _Pack<float, N>(std::bit_cast<F>(cos_bits ^ cos_sign));
+  }
+
+
+  template<size_t N>
+  inline _Pack<float, N> _atan_f32(const _Pack<float, N> &a) {
+    using F = _Float32Register<N>;
+    using I = _Int32Register<N>;
+    const I x_bits = std::bit_cast<I>(a.v);
+    const F ax = std::bit_cast<F>(x_bits & 0x7fffffff);
+
+    // atan(x) = pi / 2 + atan(-1 / x) = pi / 4 + atan((x - 1) / (x + 1))
+    const I big = ax > 2.414213562373095f;
+    const I middle = ~big & (ax > 0.4142135623730950f);
+    const F reduced = (ax - 1.0f) / (ax + 1.0f);
+    const F inverse = -1.0f / ax;
+    const F r = std::bit_cast<F>(
+      (big & std::bit_cast<I>(inverse))
+      | (middle & std::bit_cast<I>(reduced))
+      | (~big & ~middle & std::bit_cast<I>(ax))
+    );
+    const F offset = std::bit_cast<F>(
+      (big & std::bit_cast<I>(F{} + 1.57079632679489661923f))
+      | (middle & std::bit_cast<I>(F{} + 0.78539816339744830962f))
+    );
+
+    const F z = r * r;
+    F y = 8.05374449538e-2f * z - 1.38776856032e-1f;
+    y = y * z + 1.99777106478e-1f;
+    y = y * z - 3.33329491539e-1f;
+    y = y * z * r + r + offset;
+    return _Pack<float, N>(std::bit_cast<F>(std::bit_cast<I>(y) ^ (x_bits & (1 << 31))));
+  }
+
+
+  template<size_t N>
+  inline _Pack<float, N> _atan2_f32(const _Pack<float, N> &y, const _Pack<float, N> &x) {
+    using F = _Float32Register<N>;
+    using I = _Int32Register<N>;
+
+    const I special = (x.v == 0.0f) | ~(x.v - x.v == 0.0f) | ~(y.v - y.v == 0.0f);
+    if (any(_Mask<float, N>(special))) {
+      return _lanewise(y, x, [](const float y, const float x) { return std::atan2(y, x); });
+    }
+
+    // Adds +-pi when x < 0, with the sign of y
+    const F angle = _atan_f32(_Pack<float, N>(y.v / x.v)).v;
+    const I pi = std::bit_cast<I>(F{} + 3.14159265358979323846f) | (std::bit_cast<I>(y.v) & (1 << 31));
+    const I offset = (x.v < 0.0f) & pi;
+    return _Pack<float, N>(angle + std::bit_cast<F>(offset));
+  }
+
+
+  template<size_t N>
+  inline _Pack<float, N> _cbrt_f32(const _Pack<float, N> &a) {
+    using F = _Float32Register<N>;
+    using I = _Int32Register<N>;
+    const I x_bits = std::bit_cast<I>(a.v);
+    const F ax = std::bit_cast<F>(x_bits & 0x7fffffff);
+
+    const I special = ~(ax >= std::numeric_limits<float>::min()) | ~(ax <= std::numeric_limits<float>::max());
+    if (any(_Mask<float, N>(special))) {
+      return _lanewise(a, [](const float a) { return std::cbrt(a); });
+    }
+
+    // Divides the exponent by 3 for the initial guess, then two Halley iterations
+    const F third_bits = __builtin_convertvector(std::bit_cast<I>(ax), F) * (1.0f / 3.0f);
+    F t = std::bit_cast<F>(__builtin_convertvector(third_bits, I) + 709958130);
+    for (size_t i = 0; i < 2; i++) {
+      const F t3 = t * t * t;
+      t *= (t3 + ax + ax) / (t3 + t3 + ax);
+    }
+    return _Pack<float, N>(std::bit_cast<F>(std::bit_cast<I>(t) | (x_bits & (1 << 31))));
+  }
+
+
+  template<size_t N>
+  inline _Pack<float, N> _pow_f32(const _Pack<float, N> &a, const _Pack<float, N> &b) {
+    using I = _Int32Register<N>;
+
+    const I special = ~(a.v >= std::numeric_limits<float>::min()) | ~(a.v <= std::numeric_limits<float>::max()) | ~(b.v - b.v == 0.0f);
+    if (any(_Mask<float, N>(special))) {
+      return _lanewise(a, b, [](const float a, const float b) { return std::pow(a, b); });
+    }
+    return _exp_f32(_Pack<float, N>(b.v * _ln_f32(a).v));
+  }
+
+
+  // ===================================
+  // = Exponential and power functions =
+  // ===================================
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> sqrt(const _Pack<T, N> &a) {
+#if KMATH_SIMD_512
+    // The zero masked forms with a full mask avoid a false -Wmaybe-uninitialized of GCC 12 on
+    // _mm512_sqrt_ps / _mm512_sqrt_pd
+    if constexpr(std::same_as<T, float> && N == 16) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm512_maskz_sqrt_ps(__mmask16(-1), std::bit_cast<__m512>(a.v))));
+    } else if constexpr(std::same_as<T, double> && N == 8) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm512_maskz_sqrt_pd(__mmask8(-1), std::bit_cast<__m512d>(a.v))));
+    }
+#endif
+#if KMATH_SIMD_256
+    if constexpr(std::same_as<T, float> && N == 8) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm256_sqrt_ps(std::bit_cast<__m256>(a.v))));
+    } else if constexpr(std::same_as<T, double> && N == 4) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm256_sqrt_pd(std::bit_cast<__m256d>(a.v))));
+    }
+#endif
+#if KMATH_SIMD_128 && defined(__SSE2__)
+    if constexpr(std::same_as<T, float> && N == 4) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm_sqrt_ps(std::bit_cast<__m128>(a.v))));
+    } else if constexpr(std::same_as<T, double> && N == 2) {
+      return _Pack<T, N>(std::bit_cast<typename _Pack<T, N>::Register>(_mm_sqrt_pd(std::bit_cast<__m128d>(a.v))));
+    }
+#endif
+    return _lanewise(a, [](const T a) { return std::sqrt(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> cbrt(const _Pack<T, N> &a) {
+    if constexpr(std::same_as<T, float>) {
+      return _cbrt_f32(a);
+    }
+    return _lanewise(a, [](const T a) { return std::cbrt(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> exp(const _Pack<T, N> &a) {
+    if constexpr(std::same_as<T, float>) {
+      return _exp_f32(a);
+    }
+    return _lanewise(a, [](const T a) { return std::exp(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> exp2(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::exp2(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> expm1(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::expm1(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> ln(const _Pack<T, N> &a) {
+    if constexpr(std::same_as<T, float>) {
+      return _ln_f32(a);
+    }
+    return _lanewise(a, [](const T a) { return std::log(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> log10(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::log10(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> log2(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::log2(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> ln1p(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::log1p(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> pow(const _Pack<T, N> &a, const _Pack<T, N> &b) {
+    if constexpr(std::same_as<T, float>) {
+      return _pow_f32(a, b);
+    }
+    return _lanewise(a, b, [](const T a, const T b) { return std::pow(a, b); });
+  }
+
+
+  template<FloatingPoint T, size_t N, Integer I>
+  inline _Pack<T, N> pow(const _Pack<T, N> &a, const I b) {
+    return _lanewise(a, [b](const T a) { return T(std::pow(a, b)); });
+  }
+
+
+  // ===========================
+  // = Trigonometric functions =
+  // ===========================
+
+
+  template<FloatingPoint T, size_t N>
+  inline void sincos(const _Pack<T, N> &a, _Pack<T, N> &sin_a, _Pack<T, N> &cos_a) {
+    if constexpr(std::same_as<T, float>) {
+      _sincos_f32(a, sin_a, cos_a);
+    } else {
+      sin_a = _lanewise(a, [](const T a) { return std::sin(a); });
+      cos_a = _lanewise(a, [](const T a) { return std::cos(a); });
+    }
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> sin(const _Pack<T, N> &a) {
+    if constexpr(std::same_as<T, float>) {
+      _Pack<T, N> sin_a, cos_a;
+      _sincos_f32(a, sin_a, cos_a);
+      return sin_a;
+    }
+    return _lanewise(a, [](const T a) { return std::sin(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> cos(const _Pack<T, N> &a) {
+    if constexpr(std::same_as<T, float>) {
+      _Pack<T, N> sin_a, cos_a;
+      _sincos_f32(a, sin_a, cos_a);
+      return cos_a;
+    }
+    return _lanewise(a, [](const T a) { return std::cos(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> tan(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::tan(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> asin(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::asin(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> acos(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::acos(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> atan(const _Pack<T, N> &a) {
+    if constexpr(std::same_as<T, float>) {
+      return _atan_f32(a);
+    }
+    return _lanewise(a, [](const T a) { return std::atan(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> atan2(const _Pack<T, N> &y, const _Pack<T, N> &x) {
+    if constexpr(std::same_as<T, float>) {
+      return _atan2_f32(y, x);
+    }
+    return _lanewise(y, x, [](const T y, const T x) { return std::atan2(y, x); });
+  }
+
+
+  // ========================
+  // = Hyperbolic functions =
+  // ========================
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> sinh(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::sinh(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> cosh(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::cosh(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> tanh(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::tanh(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> asinh(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::asinh(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> acosh(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::acosh(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> atanh(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::atanh(a); });
+  }
+
+
+  // =============================
+  // = Gamma and error functions =
+  // =============================
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> erf(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::erf(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> erfc(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::erfc(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> tgamma(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::tgamma(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> lngamma(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::lgamma(a); });
+  }
+
+
+  // ======================
+  // = Rounding Functions =
+  // ======================
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> ceil(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::ceil(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> floor(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::floor(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> trunc(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::trunc(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Pack<T, N> round(const _Pack<T, N> &a) {
+    return _lanewise(a, [](const T a) { return std::round(a); });
+  }
+
+
+  // =================================
+  // = Floating-point classification =
+  // =================================
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Mask<T, N> is_finite(const _Pack<T, N> &a) {
+    return _lanewise_test(a, [](const T a) { return std::isfinite(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Mask<T, N> is_infinite(const _Pack<T, N> &a) {
+    return _lanewise_test(a, [](const T a) { return std::isinf(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> is_nan(const _Pack<T, N> &a) {
+    return not_equal(a, a);
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  inline _Mask<T, N> is_normal_number(const _Pack<T, N> &a) {
+    return _lanewise_test(a, [](const T a) { return std::isnormal(a); });
+  }
+
+
+  template<FloatingPoint T, size_t N>
+  constexpr _Mask<T, N> sign_bit(const _Pack<T, N> &a) {
+    using I = typename _Mask<T, N>::Register;
+    return _Mask<T, N>(std::bit_cast<I>(a.v) >> (8 * sizeof(T) - 1));
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  // Number of lanes of T in the widest hardware register
+  template<FloatingPoint T>
+  constexpr const size_t NATIVE_LANES = ((KMATH_SIMD_512)? 64 : ((KMATH_SIMD_256)? 32 : 16)) / sizeof(T);
+
+
+  template<FloatingPoint T>
+  using NativePack = _Pack<T, NATIVE_LANES<T>>;
+
+
+  typedef _Pack<float, 4> f32x4;
+  typedef _Pack<float, 8> f32x8;
+  typedef _Pack<double, 4> f64x4;
+
+  typedef _Mask<float, 4> mask32x4;
+  typedef _Mask<float, 8> mask32x8;
+  typedef _Mask<double, 4> mask64x4;
+}
+
+
+namespace kmath {
+  template<FloatingPoint T, size_t N>
+  struct _bool_parameter<simd::_Pack<T, N>> {
+    using type = simd::_Mask<T, N>;
+  };
+
+
+  // Makes the mask aware overloads visible to qualified calls (kmath::select, kmath::sign...) as well
+  using simd::select;
+  using simd::equal;
+  using simd::not_equal;
+  using simd::lesser;
+  using simd::lesser_eq;
+  using simd::greater;
+  using simd::greater_eq;
+  using simd::all;
+  using simd::any;
+  using simd::none;
+  using simd::sign;
+  using simd::possign;
+  using simd::negsign;
+  using simd::ln1p;
+  using simd::lngamma;
+}
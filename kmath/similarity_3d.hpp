@@ -0,0 +1,197 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "vector.hpp"
+#include "matrix.hpp"
+#include "rotor_3d.hpp"
+#include "motor_3d.hpp"
+
+
+namespace kmath {
+  // ===============
+  // = Similarity3 =
+  // ===============
+
+
+  // Rigid transformation with a uniform scale: points are scaled, then rotated by the rotor, then
+  // translated. The rotor must be normalized. Unlike _Mat4, compositions and inverses stay in
+  // this form, so they are cheap: a composition is one rotor product, one rotor transformation
+  // and a multiply.
+  template<Number T>
+  struct _Similarity3 {
+    _Rotor3<T> rotor;
+    _Vec3<T> translation;
+    T scale;
+
+  public:
+    _Similarity3(): _Similarity3(IDENTITY) {}
+
+
+    constexpr _Similarity3(const _Rotor3<T> &rotor, const _Vec3<T> &translation, const T scale):
+      rotor(rotor),
+      translation(translation),
+      scale(scale)
+    {}
+
+
+    static inline _Similarity3<T> from_translation(const _Vec3<T> &translation) {
+      return _Similarity3<T>(_Rotor3<T>::IDENTITY, translation, T(1));
+    }
+
+
+    static inline _Similarity3<T> from_scale(const T scale) {
+      return _Similarity3<T>(_Rotor3<T>::IDENTITY, _Vec3<T>::ZERO, scale);
+    }
+
+  public:
+    static const _Similarity3<T> IDENTITY;
+  };
+
+
+  template<Number T>
+  const _Similarity3<T> _Similarity3<T>::IDENTITY = _Similarity3<T>(_Rotor3<T>::IDENTITY, _Vec3<T>::ZERO, T(1));
+
+
+  // ==================================
+  // = Similarity3 specific functions =
+  // ==================================
+
+
+  // Same as transform(a, r) for a normalized rotor, with two cross products instead of the
+  // expanded sandwich product
+  template<Number T>
+  inline _Vec3<T> _rotate(const _Vec3<T> &a, const _Rotor3<T> &r) {
+    const _Vec3<T> b(-r.e23, -r.e31, -r.e12);
+    const _Vec3<T> t = T(2) * cross(b, a);
+    return a + r.s * t + cross(b, t);
+  }
+
+
+  template<Number T>
+  inline _Vec3<T> transform_direction(const _Vec3<T> &a, const _Similarity3<T> &s) {
+    return _rotate(s.scale * a, s.rotor);
+  }
+
+
+  template<Number T>
+  inline _Vec3<T> transform_point(const _Vec3<T> &a, const _Similarity3<T> &s) {
+    return transform_direction(a, s) + s.translation;
+  }
+
+
+  // The scale must not be zero
+  template<Number T>
+  inline _Similarity3<T> inverse(const _Similarity3<T> &s) {
+    const _Rotor3<T> rotor = reverse(s.rotor);
+    const T scale = T(1) / s.scale;
+    return _Similarity3<T>(rotor, -scale * _rotate(s.translation, rotor), scale);
+  }
+
+
+  // The rotors are normalized to avoid the drift of long chains of compositions
+  template<Number T>
+  inline _Similarity3<T> normalized(const _Similarity3<T> &s) {
+    return _Similarity3<T>(normalized(s.rotor), s.translation, s.scale);
+  }
+
+
+  // =========================
+  // = Similarity3 operators =
+  // =========================
+
+
+  // Composition: (a * b) applies b first, then a
+  template<Number T>
+  inline _Similarity3<T> operator*(const _Similarity3<T> &a, const _Similarity3<T> &b) {
+    return _Similarity3<T>(a.rotor * b.rotor, transform_point(b.translation, a), a.scale * b.scale);
+  }
+
+
+  template<Number T>
+  inline _Similarity3<T> &operator*=(_Similarity3<T> &a, const _Similarity3<T> &b) {
+    a = a * b;
+    return a;
+  }
+
+
+  // ===========================
+  // = Interpolation functions =
+  // ===========================
+
+
+  // Interpolates the rotation (slerp), the translation (lerp) and the scale (geometrically, so
+  // that halfway between 1 and 4 is 2) separately. The scales must be positive.
+  template<Number T>
+  inline _Similarity3<T> seplerp(const _Similarity3<T> &a, const _Similarity3<T> &b, const T t) {
+    return _Similarity3<T>(
+      slerp(a.rotor, b.rotor, t),
+      lerp(a.translation, b.translation, t),
+      a.scale * pow(b.scale / a.scale, t)
+    );
+  }
+
+
+  // ===============
+  // = Conversions =
+  // ===============
+
+
+  template<Number T>
+  inline _Mat4<T> as_transform(const _Similarity3<T> &s) {
+    return _Mat4<T>::from_basis(as_basis(s.rotor) * s.scale, s.translation);
+  }
+
+
+  // The matrix must be a similarity: an orthogonal basis with columns of the same length, and a
+  // last row of (0, 0, 0, 1). Reflections are not supported.
+  template<Number T>
+  inline _Similarity3<T> as_similarity(const _Mat4<T> &m) {
+    const _Mat3<T> basis(m.x.xyz(), m.y.xyz(), m.z.xyz());
+    const T scale = length(basis.x);
+    return _Similarity3<T>(_Rotor3<T>::from_basis(basis / scale), m.w.xyz(), scale);
+  }
+
+
+  template<Number T>
+  inline _Similarity3<T> as_similarity(const _Motor3<T> &m) {
+    return _Similarity3<T>(get_rotor(m), get_translation(m), T(1));
+  }
+
+
+  // The scale must be one
+  template<Number T>
+  inline _Motor3<T> as_motor(const _Similarity3<T> &s) {
+    return _Motor3<T>::from_rotor_translation(s.rotor, s.translation);
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Similarity3<float> Similarity3;
+  typedef _Similarity3<double> Similarity3d;
+}
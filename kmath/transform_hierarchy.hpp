@@ -0,0 +1,183 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "matrix.hpp"
+#include "motor_3d.hpp"
+#include "similarity_3d.hpp"
+#include "private/parallel.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <utility>
+#include <vector>
+
+
+// Flat transform hierarchy: nodes are stored in arrays, children after their parent, and their
+// world transforms are cached.
+//
+// Changing a local transform only marks its node dirty, update() then recomputes the world
+// transforms of the dirty subtrees, one depth level after the other (a level only depends on the
+// previous one, so large levels are split across threads).
+namespace kmath {
+  // TR is a transform type composed with operator* so that parent * local applies local first,
+  // like _Motor3, _Similarity3 or _Mat4.
+  template<typename TR>
+  class _TransformHierarchy {
+  public:
+    static constexpr const size_t NO_PARENT = std::numeric_limits<size_t>::max();
+
+    // Levels of at least this many dirty nodes are split across threads
+    static constexpr const size_t PARALLEL_THRESHOLD = 1 << 14;
+
+  public:
+    inline size_t size() const { return locals.size(); }
+
+
+    void reserve(const size_t capacity) {
+      parents.reserve(capacity);
+      first_children.reserve(capacity);
+      next_siblings.reserve(capacity);
+      depths.reserve(capacity);
+      dirty.reserve(capacity);
+      locals.reserve(capacity);
+      worlds.reserve(capacity);
+    }
+
+
+    // Adds a dirty node and returns its index. parent must be NO_PARENT or an existing node.
+    size_t add(const TR &local, const size_t parent = NO_PARENT) {
+      const size_t index = size();
+      const size_t depth = (parent == NO_PARENT)? 0 : depths[parent] + 1;
+
+      parents.push_back(parent);
+      first_children.push_back(NO_PARENT);
+      next_siblings.push_back(NO_PARENT);
+      depths.push_back(depth);
+      dirty.push_back(false);
+      locals.push_back(local);
+      worlds.push_back(local);
+
+      // Prepended: the order of the children does not matter
+      if (parent != NO_PARENT) {
+        next_siblings[index] = first_children[parent];
+        first_children[parent] = index;
+      }
+      _mark_dirty(index);
+      return index;
+    }
+
+  public:
+    inline size_t parent(const size_t index) const { return parents[index]; }
+    inline size_t depth(const size_t index) const { return depths[index]; }
+    inline bool is_dirty(const size_t index) const { return dirty[index]; }
+
+
+    inline const TR &local(const size_t index) const { return locals[index]; }
+
+
+    inline void set_local(const size_t index, const TR &local) {
+      locals[index] = local;
+      _mark_dirty(index);
+    }
+
+
+    // Up to date after update()
+    inline const TR &world(const size_t index) const { return worlds[index]; }
+    inline std::span<const TR> world_transforms() const { return worlds; }
+
+  public:
+    // Recomputes the world transforms of the dirty nodes and of their descendants, returns the
+    // number of recomputed nodes
+    size_t update() {
+      size_t updated = 0;
+      for (size_t depth = 0; depth < pending.size(); depth++) {
+        // Moved out, marking the children dirty may reallocate pending
+        std::vector<size_t> &level = scratch;
+        std::swap(level, pending[depth]);
+        // The ranges split level, not worlds: the nodes of a range are scattered, so threads may
+        // write to the same cache lines. Every node is written once and its parent was written by
+        // a previous level, which keeps it race free.
+        _parallel_for(level.size(), PARALLEL_THRESHOLD, [&](const size_t begin, const size_t end) {
+          for (size_t i = begin; i < end; i++) {
+            const size_t node = level[i];
+            const size_t parent = parents[node];
+            worlds[node] = (parent == NO_PARENT)? locals[node] : worlds[parent] * locals[node];
+          }
+        });
+
+        // Their children are recomputed with the next level, even if they are not dirty
+        for (const size_t node: level) {
+          dirty[node] = false;
+          for (size_t child = first_children[node]; child != NO_PARENT; child = next_siblings[child]) {
+            _mark_dirty(child);
+          }
+        }
+        updated += level.size();
+        level.clear();
+      }
+      return updated;
+    }
+
+  private:
+    void _mark_dirty(const size_t index) {
+      if (dirty[index]) return;
+      dirty[index] = true;
+      const size_t depth = depths[index];
+      if (pending.size() <= depth) {
+        pending.resize(depth + 1);
+      }
+      pending[depth].push_back(index);
+    }
+
+  private:
+    std::vector<size_t> parents;
+    std::vector<size_t> first_children;
+    std::vector<size_t> next_siblings;
+    std::vector<size_t> depths;
+    std::vector<std::uint8_t> dirty;
+    std::vector<TR> locals;
+    std::vector<TR> worlds;
+
+    // Dirty nodes of each depth, the flags of dirty avoid duplicates
+    std::vector<std::vector<size_t>> pending;
+    std::vector<size_t> scratch;
+  };
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _TransformHierarchy<Motor3> MotorHierarchy3;
+  typedef _TransformHierarchy<Motor3d> MotorHierarchy3d;
+
+  typedef _TransformHierarchy<Similarity3> SimilarityHierarchy3;
+  typedef _TransformHierarchy<Similarity3d> SimilarityHierarchy3d;
+
+  typedef _TransformHierarchy<Mat4> Mat4Hierarchy;
+  typedef _TransformHierarchy<Mat4d> Mat4dHierarchy;
+}
@@ -23,8 +23,12 @@
 
 
 #include "concepts.hpp"
+#include "simd.hpp"
 
+#include <bit>
+#include <cstdint>
 #include <limits>
+#include <type_traits>
 
 
 namespace kmath {
@@ -1117,6 +1121,425 @@ namespace kmath {
   }
 
 
+  // ===================================
+  // = Vector4 hardware specialization =
+  // ===================================
+
+  // _Vec4<float> (SSE) and _Vec4<double> (AVX) fit in a single register. The overloads below are
+  // more constrained than the generic ones and keep the same layout: the vector is bit cast to
+  // and from the register. The binary operators are written with the compound ones and use them.
+
+
+  template<simd::NativeX4 T>
+  using _Vec4Register = typename simd::_register<T, 4>::type;
+
+
+  template<simd::NativeX4 T>
+  constexpr _Vec4Register<T> _to_register(const _Vec4<T> &v) {
+    return std::bit_cast<_Vec4Register<T>>(v);
+  }
+
+
+  template<simd::NativeX4 T>
+  constexpr _Vec4<T> _from_register(const _Vec4Register<T> r) {
+    return std::bit_cast<_Vec4<T>>(r);
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr T length_squared(const _Vec4<T> &v) {
+    return dot(v, v);
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr T dot(const _Vec4<T> &a, const _Vec4<T> &b) {
+    const _Vec4Register<T> p = _to_register(a) * _to_register(b);
+    return (p[0] + p[1]) + (p[2] + p[3]);
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> &operator+=(_Vec4<T> &a, const _Vec4<T> &b) {
+    a = _from_register<T>(_to_register(a) + _to_register(b));
+    return a;
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> &operator-=(_Vec4<T> &a, const _Vec4<T> &b) {
+    a = _from_register<T>(_to_register(a) - _to_register(b));
+    return a;
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> operator-(const _Vec4<T> &a) {
+    return _from_register<T>(-_to_register(a));
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> &operator*=(_Vec4<T> &a, const _Vec4<T> &b) {
+    a = _from_register<T>(_to_register(a) * _to_register(b));
+    return a;
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> &operator/=(_Vec4<T> &a, const _Vec4<T> &b) {
+    a = _from_register<T>(_to_register(a) / _to_register(b));
+    return a;
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> operator*(const T s, const _Vec4<T> &v) {
+    return _from_register<T>(s * _to_register(v));
+  }
+
+
+  template<Number T>
+  requires simd::NativeX4<T>
+  constexpr _Vec4<T> operator*(const _Vec4<T> &v, const T s) {
+    return _from_register<T>(_to_register(v) * s);
+  }
+
+
+  // ================
+  // = Vector masks =
+  // ================
+
+  // Comparisons between vectors of standard numbers return a _VecMask: one bit per component, the
+  // layout of a SIMD movemask. The comparisons are branchless (the _Vec4 hardware specialization
+  // compares the registers and extracts the mask with movemask), all / any / none are a single
+  // integer comparison and select blends the components with bitwise operations. Vectors of other
+  // numbers (packs, half, fixed point...) keep _VecN<bool>.
+
+
+  template<size_t N>
+  requires (N <= 8)
+  struct _VecMask {
+    std::uint8_t bits = 0;
+
+  public:
+    constexpr _VecMask() = default;
+    constexpr explicit _VecMask(const bool b): bits(b? FULL : 0) {}
+
+    template<template<typename> typename ST>
+    requires ArrayTemplate<ST> && (ST<bool>::SIZE == N)
+    constexpr _VecMask(const ST<bool> &b) {
+      for (size_t i = 0; i < N; i++) {
+        bits |= std::uint8_t(b[i]) << i;
+      }
+    }
+
+
+    static constexpr _VecMask from_bits(const std::uint8_t bits) {
+      _VecMask m;
+      m.bits = bits & FULL;
+      return m;
+    }
+
+  public:
+    constexpr bool operator[](const size_t index) const { return ((bits >> index) & 1) != 0; }
+
+  public:
+    static constexpr const size_t SIZE = N;
+    static constexpr const std::uint8_t FULL = std::uint8_t((1u << N) - 1u);
+  };
+
+
+  // Scalars with an unsigned integer of the same size to blend them, the others (long double...)
+  // keep the _VecN<bool> comparisons
+  template<typename T>
+  concept _MaskScalar = (FloatingPoint<T> || (Integer<T> && !std::same_as<T, bool>))
+    && (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+
+  template<template<typename> typename VT>
+  concept _MaskVectorTemplate = std::same_as<VT<float>, _Vec2<float>> || std::same_as<VT<float>, _Vec3<float>> || std::same_as<VT<float>, _Vec4<float>>;
+
+
+  template<_MaskScalar T>
+  struct _bool_parameter<_Vec2<T>> {
+    using type = _VecMask<2>;
+  };
+
+
+  template<_MaskScalar T>
+  struct _bool_parameter<_Vec3<T>> {
+    using type = _VecMask<3>;
+  };
+
+
+  template<_MaskScalar T>
+  struct _bool_parameter<_Vec4<T>> {
+    using type = _VecMask<4>;
+  };
+
+
+  template<typename V>
+  concept _MaskedVector = SizedIndexable<V> && std::same_as<BoolParameter<V>, _VecMask<V::SIZE>>;
+
+
+  // Packs the lanes of a register comparison
+  template<simd::NativeX4 T>
+  inline _VecMask<4> _movemask(const typename simd::_register<simd::_lane_integer<T>, 4>::type r) {
+#if defined(__SSE2__)
+    if constexpr(std::same_as<T, float>) {
+      return _VecMask<4>::from_bits(std::uint8_t(_mm_movemask_ps(_mm_castsi128_ps(__m128i(r)))));
+    }
+#endif
+#if defined(__AVX__)
+    if constexpr(std::same_as<T, double>) {
+      return _VecMask<4>::from_bits(std::uint8_t(_mm256_movemask_pd(_mm256_castsi256_pd(__m256i(r)))));
+    }
+#endif
+    std::uint8_t bits = 0;
+    for (size_t i = 0; i < 4; i++) {
+      bits |= std::uint8_t(r[i] != 0) << i;
+    }
+    return _VecMask<4>::from_bits(bits);
+  }
+
+
+  template<typename K, template<typename> typename VT, typename F>
+  constexpr _VecMask<VT<K>::SIZE> _compare(const VT<K> &a, const VT<K> &b, F op) {
+    if constexpr(std::same_as<VT<K>, _Vec4<K>> && simd::NativeX4<K>) {
+      if (!std::is_constant_evaluated()) {
+        return _movemask<K>(op(_to_register(a), _to_register(b)));
+      }
+    }
+
+    std::uint8_t bits = 0;
+    for (size_t i = 0; i < VT<K>::SIZE; i++) {
+      bits |= std::uint8_t(op(a[i], b[i])) << i;
+    }
+    return _VecMask<VT<K>::SIZE>::from_bits(bits);
+  }
+
+
+  template<Orderable K, template<typename> typename VT>
+  requires ArrayTemplate<VT> && _MaskScalar<K> && _MaskVectorTemplate<VT>
+  constexpr _VecMask<VT<K>::SIZE> equal(const VT<K> a, const VT<K> b) {
+    return _compare(a, b, [](const auto x, const auto y) { return x == y; });
+  }
+
+
+  template<Orderable K, template<typename> typename VT>
+  requires ArrayTemplate<VT> && _MaskScalar<K> && _MaskVectorTemplate<VT>
+  constexpr _VecMask<VT<K>::SIZE> not_equal(const VT<K> a, const VT<K> b) {
+    return _compare(a, b, [](const auto x, const auto y) { return x != y; });
+  }
+
+
+  template<Orderable K, template<typename> typename VT>
+  requires ArrayTemplate<VT> && _MaskScalar<K> && _MaskVectorTemplate<VT>
+  constexpr _VecMask<VT<K>::SIZE> lesser(const VT<K> a, const VT<K> b) {
+    return _compare(a, b, [](const auto x, const auto y) { return x < y; });
+  }
+
+
+  template<Orderable K, template<typename> typename VT>
+  requires ArrayTemplate<VT> && _MaskScalar<K> && _MaskVectorTemplate<VT>
+  constexpr _VecMask<VT<K>::SIZE> lesser_eq(const VT<K> a, const VT<K> b) {
+    return _compare(a, b, [](const auto x, const auto y) { return x <= y; });
+  }
+
+
+  template<Orderable K, template<typename> typename VT>
+  requires ArrayTemplate<VT> && _MaskScalar<K> && _MaskVectorTemplate<VT>
+  constexpr _VecMask<VT<K>::SIZE> greater(const VT<K> a, const VT<K> b) {
+    return _compare(a, b, [](const auto x, const auto y) { return x > y; });
+  }
+
+
+  template<Orderable K, template<typename> typename VT>
+  requires ArrayTemplate<VT> && _MaskScalar<K> && _MaskVectorTemplate<VT>
+  constexpr _VecMask<VT<K>::SIZE> greater_eq(const VT<K> a, const VT<K> b) {
+    return _compare(a, b, [](const auto x, const auto y) { return x >= y; });
+  }
+
+
+  // Blends the bit patterns of the components, the compiler lowers it to and / andnot / or (or a
+  // blend instruction) instead of branching on each component
+  template<SizedIndexable V>
+  requires _MaskedVector<V>
+  constexpr V select(const BoolParameter<V> condition, const V a, const V b) {
+    using K = Parameter<V>;
+    using U = std::conditional_t<sizeof(K) == 1, std::uint8_t, std::conditional_t<sizeof(K) == 2, std::uint16_t, std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>>>;
+
+    if constexpr(std::same_as<V, _Vec4<K>> && simd::NativeX4<K>) {
+      if (!std::is_constant_evaluated()) {
+        using Lanes = typename simd::_register<simd::_lane_integer<K>, 4>::type;
+        const Lanes lane_bits = {1, 2, 4, 8};
+        const Lanes mask = (lane_bits & simd::_lane_integer<K>(condition.bits)) != 0;
+        const Lanes blend = (std::bit_cast<Lanes>(a) & mask) | (std::bit_cast<Lanes>(b) & ~mask);
+        return std::bit_cast<V>(blend);
+      }
+    }
+
+    V result;
+    for (size_t i = 0; i < V::SIZE; i++) {
+      const U mask = U(0) - U((condition.bits >> i) & 1);
+      result[i] = std::bit_cast<K>(U((std::bit_cast<U>(a[i]) & mask) | (std::bit_cast<U>(b[i]) & ~mask)));
+    }
+    return result;
+  }
+
+
+  template<size_t N>
+  constexpr bool all(const _VecMask<N> a) {
+    return a.bits == _VecMask<N>::FULL;
+  }
+
+
+  template<size_t N>
+  constexpr bool any(const _VecMask<N> a) {
+    return a.bits != 0;
+  }
+
+
+  template<size_t N>
+  constexpr bool none(const _VecMask<N> a) {
+    return a.bits == 0;
+  }
+
+
+  template<size_t N>
+  constexpr _VecMask<N> operator&&(const _VecMask<N> a, const _VecMask<N> b) {
+    return _VecMask<N>::from_bits(a.bits & b.bits);
+  }
+
+
+  template<size_t N>
+  constexpr _VecMask<N> operator||(const _VecMask<N> a, const _VecMask<N> b) {
+    return _VecMask<N>::from_bits(a.bits | b.bits);
+  }
+
+
+  template<size_t N>
+  constexpr _VecMask<N> operator^(const _VecMask<N> a, const _VecMask<N> b) {
+    return _VecMask<N>::from_bits(a.bits ^ b.bits);
+  }
+
+
+  template<size_t N>
+  constexpr _VecMask<N> operator!(const _VecMask<N> a) {
+    return _VecMask<N>::from_bits(~a.bits);
+  }
+
+
+  template<size_t N>
+  constexpr bool operator==(const _VecMask<N> a, const _VecMask<N> b) {
+    return a.bits == b.bits;
+  }
+
+
+  // =======================================
+  // = Vectorized transcendental functions =
+  // =======================================
+
+  // Single precision vectors of up to four components are evaluated as one f32x4, using the pack
+  // kernels of simd.hpp (see there for the error bounds). The unused lanes are filled with ones.
+
+
+  template<typename V>
+  concept _PackableVector = Number<V> && (std::same_as<V, _Vec2<float>> || std::same_as<V, _Vec3<float>> || std::same_as<V, _Vec4<float>>);
+
+
+  template<_PackableVector V>
+  inline simd::f32x4 _to_pack(const V &v) {
+    simd::f32x4 p(1.0f);
+    for (size_t i = 0; i < V::SIZE; i++) {
+      p.set_lane(i, v[i]);
+    }
+    return p;
+  }
+
+
+  template<_PackableVector V>
+  inline V _from_pack(const simd::f32x4 &p) {
+    V v;
+    for (size_t i = 0; i < V::SIZE; i++) {
+      v[i] = p.lane(i);
+    }
+    return v;
+  }
+
+
+  template<_PackableVector V>
+  inline V exp(const V a) {
+    return _from_pack<V>(simd::exp(_to_pack(a)));
+  }
+
+
+  template<_PackableVector V>
+  inline V ln(const V a) {
+    return _from_pack<V>(simd::ln(_to_pack(a)));
+  }
+
+
+  template<_PackableVector V>
+  inline V pow(const V a, const V b) {
+    return _from_pack<V>(simd::pow(_to_pack(a), _to_pack(b)));
+  }
+
+
+  template<_PackableVector V>
+  inline V pow(const V a, const float b) {
+    return _from_pack<V>(simd::pow(_to_pack(a), simd::f32x4(b)));
+  }
+
+
+  template<_PackableVector V>
+  inline V cbrt(const V a) {
+    return _from_pack<V>(simd::cbrt(_to_pack(a)));
+  }
+
+
+  template<_PackableVector V>
+  inline V sin(const V a) {
+    return _from_pack<V>(simd::sin(_to_pack(a)));
+  }
+
+
+  template<_PackableVector V>
+  inline V cos(const V a) {
+    return _from_pack<V>(simd::cos(_to_pack(a)));
+  }
+
+
+  template<_PackableVector V>
+  inline void sincos(const V a, V &sin_a, V &cos_a) {
+    simd::f32x4 s, c;
+    simd::sincos(_to_pack(a), s, c);
+    sin_a = _from_pack<V>(s);
+    cos_a = _from_pack<V>(c);
+  }
+
+
+  template<_PackableVector V>
+  inline V atan(const V a) {
+    return _from_pack<V>(simd::atan(_to_pack(a)));
+  }
+
+
+  template<_PackableVector V>
+  inline V atan2(const V y, const V x) {
+    return _from_pack<V>(simd::atan2(_to_pack(y), _to_pack(x)));
+  }
+
+
 
   // ================
   // = Type aliases =
@@ -1139,4 +1562,8 @@ namespace kmath {
   typedef _Vec4<int> Vec4i;
   typedef _Vec4<long> Vec4l;
   typedef _Vec4<bool> Vec4b;
+
+  typedef _VecMask<2> Vec2m;
+  typedef _VecMask<3> Vec3m;
+  typedef _VecMask<4> Vec4m;
 }
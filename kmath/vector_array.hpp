@@ -0,0 +1,442 @@
+// Copyright © 2025 Souchet Ferdinand (aka. Khusheete)
+// 
+// Permission is hereby granted, free of charge, to any person obtaining a copy
+// of this software and associated documentation files (the “Software”), to deal
+// in the Software without restriction, including without limitation the rights
+// to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+// copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+// 
+// The above copyright notice and this permission notice shall be included in all
+// copies or substantial portions of the Software.
+//
+// THE SOFTWARE IS PROVIDED “AS IS”, WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+// IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+// FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+// AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+// LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+// OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+// SOFTWARE.
+
+
+#pragma once
+
+
+#include "base.hpp"
+#include "simd.hpp"
+#include "vector.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <new>
+#include <span>
+#include <utility>
+
+
+// Structure of arrays storage for _Vec2, _Vec3 and _Vec4. Every component is stored in its own
+// plane, the planes are aligned on cache lines and padded to a multiple of PADDING elements so
+// that the batch functions below process whole SIMD packs without a scalar tail. The padding is
+// zero initialized, its content after a batch operation is unspecified.
+//
+// The batch functions load _Vec3<simd::NativePack<T>> values from the planes and run the generic
+// functions of vector.hpp / base.hpp on them. The inputs of a function must have the same size
+// (KMATH_ASSERT), the result arrays are resized to it and may alias the inputs.
+namespace kmath {
+  template<template<typename> typename VT, FloatingPoint T>
+  class _VecArray {
+  public:
+    _VecArray() = default;
+
+
+    explicit _VecArray(const size_t size) {
+      resize(size);
+    }
+
+
+    explicit _VecArray(const std::span<const VT<T>> values) {
+      resize(values.size());
+      for (size_t i = 0; i < values.size(); i++) {
+        set(i, values[i]);
+      }
+    }
+
+
+    _VecArray(const _VecArray &other) {
+      *this = other;
+    }
+
+
+    _VecArray(_VecArray &&other) {
+      *this = std::move(other);
+    }
+
+
+    ~_VecArray() {
+      _deallocate();
+    }
+
+
+    _VecArray &operator=(const _VecArray &other) {
+      if (this != &other) {
+        _reallocate(other.count, false);
+        std::copy_n(other.data, COMPONENTS * padded, data);
+      }
+      return *this;
+    }
+
+
+    _VecArray &operator=(_VecArray &&other) {
+      if (this != &other) {
+        _deallocate();
+        data = std::exchange(other.data, nullptr);
+        count = std::exchange(other.count, 0);
+        padded = std::exchange(other.padded, 0);
+      }
+      return *this;
+    }
+
+  public:
+    inline size_t size() const { return count; }
+    inline size_t capacity() const { return padded; }
+
+
+    // Keeps the first min(size, new_size) elements
+    void resize(const size_t new_size) {
+      if (new_size == count) return;
+      _VecArray old = std::move(*this);
+      _reallocate(new_size, true);
+      const size_t kept = std::min(old.count, count);
+      for (size_t c = 0; c < COMPONENTS; c++) {
+        std::copy_n(old.component(c), kept, component(c));
+      }
+    }
+
+
+    inline VT<T> get(const size_t index) const {
+      VT<T> v;
+      for (size_t c = 0; c < COMPONENTS; c++) {
+        v[c] = component(c)[index];
+      }
+      return v;
+    }
+
+
+    inline void set(const size_t index, const VT<T> &v) {
+      for (size_t c = 0; c < COMPONENTS; c++) {
+        component(c)[index] = v[c];
+      }
+    }
+
+
+    // Plane of the c-th component (x, y, z then w)
+    inline T *component(const size_t c) { return data + c * padded; }
+    inline const T *component(const size_t c) const { return data + c * padded; }
+
+
+    // Loads the P::LANES vectors starting at index as a vector of packs
+    template<typename P>
+    inline VT<P> load(const size_t index) const {
+      VT<P> v;
+      for (size_t c = 0; c < COMPONENTS; c++) {
+        v[c] = P::load(component(c) + index);
+      }
+      return v;
+    }
+
+
+    template<typename P>
+    inline void store(const size_t index, const VT<P> &v) {
+      for (size_t c = 0; c < COMPONENTS; c++) {
+        v[c].store(component(c) + index);
+      }
+    }
+
+  private:
+    void _reallocate(const size_t new_size, const bool clear) {
+      const size_t new_padded = (new_size + PADDING - 1) / PADDING * PADDING;
+      if (new_padded != padded) {
+        _deallocate();
+        if (new_padded > 0) {
+          data = static_cast<T*>(::operator new(COMPONENTS * new_padded * sizeof(T), std::align_val_t(ALIGNMENT)));
+        }
+        padded = new_padded;
+      }
+      count = new_size;
+      if (clear) {
+        std::fill_n(data, COMPONENTS * padded, T(0));
+      }
+    }
+
+
+    void _deallocate() {
+      if (data != nullptr) {
+        ::operator delete(data, std::align_val_t(ALIGNMENT));
+        data = nullptr;
+      }
+    }
+
+  private:
+    T *data = nullptr;
+    size_t count = 0;
+    size_t padded = 0;
+
+  public:
+    static constexpr const size_t COMPONENTS = VT<T>::SIZE;
+    static constexpr const size_t ALIGNMENT = 64;
+    static constexpr const size_t PADDING = ALIGNMENT / sizeof(T);
+  };
+
+
+  template<FloatingPoint T>
+  using _Vec2Array = _VecArray<_Vec2, T>;
+
+  template<FloatingPoint T>
+  using _Vec3Array = _VecArray<_Vec3, T>;
+
+  template<FloatingPoint T>
+  using _Vec4Array = _VecArray<_Vec4, T>;
+
+
+  template<FloatingPoint T, size_t N>
+  inline void _store_lanes(const simd::_Pack<T, N> &p, T *p_values, const size_t count) {
+    if (count >= N) {
+      p.store(p_values);
+      return;
+    }
+    for (size_t i = 0; i < count; i++) {
+      p_values[i] = p.lane(i);
+    }
+  }
+
+
+  // ===================
+  // = Batch functions =
+  // ===================
+
+
+  // result[i] = dot(a[i], b[i]), result must hold at least a.size() elements
+  template<template<typename> typename VT, FloatingPoint T>
+  void dot(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, const std::span<T> result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    KMATH_ASSERT(result.size() >= a.size());
+    for (size_t i = 0; i < a.size(); i += P::LANES) {
+      _store_lanes(dot(a.template load<P>(i), b.template load<P>(i)), result.data() + i, a.size() - i);
+    }
+  }
+
+
+  template<FloatingPoint T>
+  void cross(const _Vec3Array<T> &a, const _Vec3Array<T> &b, _Vec3Array<T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, cross(a.template load<P>(i), b.template load<P>(i)));
+    }
+  }
+
+
+  // result[i] = length(v[i]), result must hold at least v.size() elements
+  template<template<typename> typename VT, FloatingPoint T>
+  void length(const _VecArray<VT, T> &v, const std::span<T> result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(result.size() >= v.size());
+    for (size_t i = 0; i < v.size(); i += P::LANES) {
+      _store_lanes(length(v.template load<P>(i)), result.data() + i, v.size() - i);
+    }
+  }
+
+
+  // result[i] = distance(a[i], b[i]), result must hold at least a.size() elements
+  template<template<typename> typename VT, FloatingPoint T>
+  void distance(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, const std::span<T> result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    KMATH_ASSERT(result.size() >= a.size());
+    for (size_t i = 0; i < a.size(); i += P::LANES) {
+      _store_lanes(distance(a.template load<P>(i), b.template load<P>(i)), result.data() + i, a.size() - i);
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void normalized(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, normalized(v.template load<P>(i)));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void lerp(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, const T t, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, lerp(a.template load<P>(i), b.template load<P>(i), P(t)));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void abs(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, apply(v.template load<P>(i), [](const P a) { return abs(a); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void clamp(const _VecArray<VT, T> &v, const T minimum, const T maximum, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, clamp(v.template load<P>(i), VT<P>(P(minimum)), VT<P>(P(maximum))));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void min(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, min(a.template load<P>(i), b.template load<P>(i)));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void max(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, max(a.template load<P>(i), b.template load<P>(i)));
+    }
+  }
+
+
+  // result[i] = a[i] * b[i] + c[i]
+  template<template<typename> typename VT, FloatingPoint T>
+  void fma(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, const _VecArray<VT, T> &c, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    KMATH_ASSERT(a.size() == c.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, fma(a.template load<P>(i), b.template load<P>(i), c.template load<P>(i)));
+    }
+  }
+
+
+  // The transcendental functions are evaluated per component with the pack kernels of simd.hpp
+  template<template<typename> typename VT, FloatingPoint T>
+  void exp(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, apply(v.template load<P>(i), [](const P a) { return exp(a); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void ln(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, apply(v.template load<P>(i), [](const P a) { return ln(a); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void pow(const _VecArray<VT, T> &a, const _VecArray<VT, T> &b, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(a.size() == b.size());
+    result.resize(a.size());
+    for (size_t i = 0; i < a.capacity(); i += P::LANES) {
+      result.store(i, apply(a.template load<P>(i), b.template load<P>(i), [](const P a, const P b) { return pow(a, b); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void cbrt(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, apply(v.template load<P>(i), [](const P a) { return cbrt(a); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void sin(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, apply(v.template load<P>(i), [](const P a) { return sin(a); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void cos(const _VecArray<VT, T> &v, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      result.store(i, apply(v.template load<P>(i), [](const P a) { return cos(a); }));
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void sincos(const _VecArray<VT, T> &v, _VecArray<VT, T> &sin_result, _VecArray<VT, T> &cos_result) {
+    using P = simd::NativePack<T>;
+    sin_result.resize(v.size());
+    cos_result.resize(v.size());
+    for (size_t i = 0; i < v.capacity(); i += P::LANES) {
+      const VT<P> a = v.template load<P>(i);
+      VT<P> sin_a, cos_a;
+      for (size_t c = 0; c < VT<P>::SIZE; c++) {
+        sincos(a[c], sin_a[c], cos_a[c]);
+      }
+      sin_result.store(i, sin_a);
+      cos_result.store(i, cos_a);
+    }
+  }
+
+
+  template<template<typename> typename VT, FloatingPoint T>
+  void atan2(const _VecArray<VT, T> &y, const _VecArray<VT, T> &x, _VecArray<VT, T> &result) {
+    using P = simd::NativePack<T>;
+    KMATH_ASSERT(y.size() == x.size());
+    result.resize(y.size());
+    for (size_t i = 0; i < y.capacity(); i += P::LANES) {
+      result.store(i, apply(y.template load<P>(i), x.template load<P>(i), [](const P y, const P x) { return atan2(y, x); }));
+    }
+  }
+
+
+  // ================
+  // = Type aliases =
+  // ================
+
+
+  typedef _Vec2Array<float> Vec2Array;
+  typedef _Vec2Array<double> Vec2dArray;
+
+  typedef _Vec3Array<float> Vec3Array;
+  typedef _Vec3Array<double> Vec3dArray;
+
+  typedef _Vec4Array<float> Vec4Array;
+  typedef _Vec4Array<double> Vec4dArray;
+}
@@ -2,11 +2,31 @@
 
 #include "unit_tests/src/csi.hpp"
 #include "unit_tests/src/tests/angles.hpp"
+#include "unit_tests/src/tests/euclidian_flat_2d.hpp"
 #include "unit_tests/src/tests/euclidian_flat_3d.hpp"
 #include "unit_tests/src/tests/matrix.hpp"
+#include "unit_tests/src/tests/affine_3d.hpp"
+#include "unit_tests/src/tests/decomposition_3d.hpp"
+#include "unit_tests/src/tests/frustum_3d.hpp"
+#include "unit_tests/src/tests/graded_mvec_3d.hpp"
+#include "unit_tests/src/tests/matrix_array.hpp"
+#include "unit_tests/src/tests/matrix_n.hpp"
+#include "unit_tests/src/tests/motor_2d.hpp"
 #include "unit_tests/src/tests/rotor_3d.hpp"
+#include "unit_tests/src/tests/similarity_3d.hpp"
+#include "unit_tests/src/tests/transform_hierarchy.hpp"
 #include "unit_tests/src/tests/vector.hpp"
+#include "unit_tests/src/tests/vector_array.hpp"
 #include "unit_tests/src/tests/colors.hpp"
+#include "unit_tests/src/tests/simd.hpp"
+#include "unit_tests/src/tests/fast.hpp"
+#include "unit_tests/src/tests/lazy.hpp"
+#include "unit_tests/src/tests/lazy_mvec_3d.hpp"
+#include "unit_tests/src/tests/half.hpp"
+#include "unit_tests/src/tests/fixed.hpp"
+#include "unit_tests/src/tests/instrument.hpp"
+#include "unit_tests/src/tests/batch.hpp"
+#include "unit_tests/src/tests/generated.hpp"
 
 #include <array>
 #include <set>
@@ -24,7 +44,7 @@ struct TestSection {
 };
 
 
-constexpr const std::array<TestSection, 11> TEST_SECTIONS{
+constexpr const std::array<TestSection, 32> TEST_SECTIONS{
   // TODO: add more tests for colors
   // TODO: test operations on rotors
   // TODO: test operations on motors
@@ -33,19 +53,42 @@ constexpr const std::array<TestSection, 11> TEST_SECTIONS{
   TestSection{ .name = "vec2", .function = &test_vector2, },
   TestSection{ .name = "vec3", .function = &test_vector3, },
   TestSection{ .name = "vec4", .function = &test_vector4, },
+  TestSection{ .name = "vec_array", .function = &test_vector_array, },
+  TestSection{ .name = "lazy", .function = &test_lazy_expressions, },
 
   TestSection{ .name = "plane3", .function = &test_plane3, },
   TestSection{ .name = "line3", .function = &test_line3, },
   TestSection{ .name = "point3", .function = &test_point3, },
   TestSection{ .name = "cross_flat3", .function = &test_cross_flat3_operations, },
+  TestSection{ .name = "graded_mvec3", .function = &test_graded_mvec3, },
+  TestSection{ .name = "lazy_mvec3", .function = &test_lazy_mvec3, },
+
+  TestSection{ .name = "line2", .function = &test_line2, },
+  TestSection{ .name = "point2", .function = &test_point2, },
+  TestSection{ .name = "motor2", .function = &test_motor2, },
 
   TestSection{ .name = "matrix4", .function = &test_matrix4, },
+  TestSection{ .name = "affine3", .function = &test_affine3, },
+  TestSection{ .name = "decomposition3", .function = &test_decomposition3, },
+  TestSection{ .name = "frustum3", .function = &test_frustum3, },
+  TestSection{ .name = "mat4_array", .function = &test_matrix_array, },
+  TestSection{ .name = "matN", .function = &test_matrix_n, },
 
   TestSection{ .name = "rotor3", .function = &test_rotor3, },
+  TestSection{ .name = "similarity3", .function = &test_similarity3, },
+  TestSection{ .name = "transform_hierarchy", .function = &test_transform_hierarchy, },
 
   TestSection{ .name = "color_conversion", .function = &test_color_conversion, },
 
   TestSection{ .name = "rotor3_euler_conversion", .function = &test_rotor_euler_conversion, },
+
+  TestSection{ .name = "simd_pack", .function = &test_simd_pack, },
+  TestSection{ .name = "fast_math", .function = &test_fast_math, },
+  TestSection{ .name = "half_float", .function = &test_half_float, },
+  TestSection{ .name = "fixed_point", .function = &test_fixed_point, },
+  TestSection{ .name = "op_counts", .function = &test_instrument, },
+  TestSection{ .name = "batch_dispatch", .function = &test_batch_dispatch, },
+  TestSection{ .name = "generated", .function = &test_generated, },
 };
 
 
@@ -73,6 +116,14 @@ int main(const int argc, const char *const *const argv) {
     return EXIT_SUCCESS;
   }
 
+#if defined(__AVX512F__) && (defined(__GNUC__) || defined(__clang__))
+  // KMathTestsAVX512 would stop on an illegal instruction
+  if (!__builtin_cpu_supports("avx512f") || !__builtin_cpu_supports("avx512vl") || !__builtin_cpu_supports("avx512dq")) {
+    std::cerr << "This CPU does not support AVX-512, the tests are skipped." << std::endl;
+    return EXIT_SUCCESS;
+  }
+#endif
+
   Testing::init_singleton();
   if (std::strcmp(argv[1], "all") == 0) { // Execute all tests
     for (const TestSection &section : TEST_SECTIONS) {
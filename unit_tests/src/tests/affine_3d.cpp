@@ -0,0 +1,53 @@
+#include "affine_3d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/affine_3d.hpp"
+#include "kmath/constants.hpp"
+
+
+using namespace kmath;
+
+
+void test_affine3() {
+  const Mat4 ma = Mat4::translation(Vec3(1.0, -2.0, 3.0)) * Mat4::x_rotation(0.4) * Mat4::scale(1.0, 2.0, 3.0);
+  const Mat4 mb = Mat4::translation(Vec3(-0.5, 0.25, 2.0)) * Mat4::z_rotation(-1.2) * Mat4::scale(0.5, 0.5, 4.0);
+  const Affine3 a = Affine3::from_mat4(ma);
+  const Affine3 b = Affine3::from_mat4(mb);
+  const Vec3 p(0.3, -1.5, 2.0);
+
+  UNIT_TEST("storage", {
+    TEST("size", sizeof(Affine3) == 12 * sizeof(float));
+    TEST_EQ_APPROX("as_transform", as_transform(a), ma);
+  });
+
+  UNIT_TEST("transformations", {
+    TEST_EQ_APPROX("transform_point", transform_point(p, a), (ma * Vec4(p, 1.0)).xyz());
+    TEST_EQ_APPROX("transform_direction", transform_direction(p, a), (ma * Vec4(p, 0.0)).xyz());
+    TEST_EQ_APPROX("a * v", a * Vec4(p, 1.0), ma * Vec4(p, 1.0));
+  });
+
+  UNIT_TEST("composition", {
+    TEST_EQ_APPROX("a * b", a * b, Affine3::from_mat4(ma * mb));
+    TEST_EQ_APPROX("(a * b) * p", transform_point(p, a * b), transform_point(transform_point(p, b), a));
+  });
+
+  UNIT_TEST("inverse", {
+    TEST_EQ_APPROX("a * a^(-1)", a * affine_inverse(a), Affine3::IDENTITY);
+    TEST_EQ_APPROX("a^(-1) * a", affine_inverse(a) * a, Affine3::IDENTITY);
+    TEST_EQ_APPROX("Mat3 inverse", get_basis(b) * inverse(get_basis(b)), Mat3::IDENTITY);
+
+    const Affine3 rigid = Affine3::from_mat4(Mat4::translation(Vec3(4.0, 1.0, -2.0)) * Mat4::y_rotation(0.7));
+    TEST_EQ_APPROX("fast_inverse", fast_inverse(rigid), affine_inverse(rigid));
+  });
+
+  UNIT_TEST("motor conversion", {
+    const Motor3 m = Motor3::from_rotor_translation(
+      Rotor3::from_axis_angle(normalized(Vec3(1.0, 2.0, -1.0)), 0.7),
+      Vec3(-1.0, 0.5, 2.0)
+    );
+    const Affine3 t = as_affine(m);
+    TEST_EQ_APPROX("as_affine", transform_point(p, t), transform_point(p, m));
+    TEST_EQ_APPROX("as_affine as_transform", as_transform(t), as_transform(m));
+    TEST_EQ_APPROX("as_motor", transform_point(p, as_motor(t)), transform_point(p, m));
+  });
+}
@@ -0,0 +1,201 @@
+#include "batch.hpp"
+#include "../testing.hpp"
+
+#include "kmath/batch.hpp"
+
+#include <cstdint>
+#include <vector>
+
+
+using namespace kmath;
+
+
+// Every kernel is compared with the scalar function it replaces, for every tier the CPU supports
+void test_batch_dispatch() {
+  // Not a multiple of any pack size, so that the last pack is partially filled
+  constexpr const size_t COUNT = 37;
+  std::vector<Vec3> points;
+  std::vector<Vec4> vectors;
+  std::vector<Rgb> colors;
+  std::vector<Mat4> transforms;
+  for (size_t i = 0; i < COUNT; i++) {
+    const float t = float(i) / float(COUNT - 1);
+    points.push_back(Vec3(float(i) + 1.0f, 2.0f - float(i), 0.5f * float(i)));
+    vectors.push_back(Vec4(points.back(), 1.0f - t));
+    colors.push_back(Rgb(t, 1.0f - t, (i % 3 == 0)? 0.0f : 0.5f * t));
+    transforms.push_back(Mat4::translation(Vec3(t, -t, 2.0f)) * Mat4::y_rotation(3.0f * t) * Mat4::x_rotation(t) * Mat4::scale(1.0f + t, 0.5f, (i % 2 == 0)? 2.0f : -2.0f));
+  }
+
+  const Mat4 m = Mat4::from_basis(Mat3::IDENTITY * 2.0f, Vec3(1.0f, -2.0f, 3.0f));
+  const Mat4 projection = Mat4::perspective_rh_no_ndc_vfov(0.5f, 100.0f, 1.2f, 1.5f) * Mat4::translation(Vec3(0.0f, 0.0f, -60.0f));
+  const Mat4d projection_d = Mat4d::perspective_rh_no_ndc_vfov(0.5, 100.0, 1.2, 1.5) * Mat4d::translation(Vec3d(0.0, 0.0, -60.0));
+  std::vector<Vec3d> points_d;
+  for (const Vec3 &p: points) {
+    points_d.push_back(Vec3d(p.x, p.y, p.z));
+  }
+  // Around the boundaries of the frustum
+  const Frustum3 frustum = Frustum3::from_projection_no_ndc(projection);
+  std::vector<Sphere3> spheres;
+  std::vector<Aabb3> boxes;
+  for (size_t i = 0; i < 2 * COUNT; i++) {
+    const Vec3 center(float(i % 7) * 15.0f - 45.0f, float(i % 5) * 10.0f - 20.0f, float(i % 3) * 45.0f + 62.0f);
+    spheres.push_back(Sphere3{ .center = center, .radius = float(i % 4) * 3.0f });
+    boxes.push_back(Aabb3{ .min = center - Vec3(float(i % 4) * 3.0f), .max = center + Vec3(float(i % 6) * 2.0f) });
+  }
+  std::vector<Mvec3> mvecs_a;
+  std::vector<Mvec3> mvecs_b;
+  std::vector<Mvec3d> mvecs_d;
+  for (size_t i = 0; i < COUNT; i++) {
+    Mvec3 a;
+    Mvec3 b;
+    Mvec3d d;
+    for (size_t c = 0; c < 16; c++) {
+      a[c] = float((i + c) % 7) * 0.125f - 0.25f;
+      b[c] = float((3 * i + 2 * c) % 5) * 0.125f - 0.375f;
+      d[c] = double(a[c]) + double(b[c]);
+    }
+    mvecs_a.push_back(a);
+    mvecs_b.push_back(b);
+    mvecs_d.push_back(d);
+  }
+  const Motor3 motor = Motor3::from_rotor_translation(
+    Rotor3::from_axis_angle(normalized(Vec3(1.0f, 2.0f, -1.0f)), 0.7f),
+    Vec3(-1.0f, 0.5f, 2.0f)
+  );
+  const Motor2 motor2 = Motor2::from_angle_translation(0.7f, Vec2(-1.0f, 0.5f));
+  std::vector<Vec2> points2;
+  for (const Vec3 &p: points) {
+    points2.push_back(p.xy());
+  }
+
+  UNIT_TEST("tier selection", {
+    const CpuTier detected = detect_cpu_tier();
+    TEST("baseline", set_cpu_tier(CpuTier::BASELINE) == CpuTier::BASELINE && cpu_tier() == CpuTier::BASELINE);
+    TEST("clamped", set_cpu_tier(CpuTier::AVX512) == detected && cpu_tier() == detected);
+  });
+
+  for (const CpuTier tier: { CpuTier::BASELINE, CpuTier::SSE4_2, CpuTier::AVX2, CpuTier::AVX512 }) {
+    if (set_cpu_tier(tier) != tier) continue;
+
+    UNIT_TEST(cpu_tier_name(tier), {
+      std::vector<Vec3> vec3_result(COUNT);
+      std::vector<Vec3d> vec3d_result(COUNT);
+      std::vector<Vec4> vec4_result(COUNT);
+      std::vector<float> scalars(COUNT);
+
+      bool matching = true;
+      batch::normalize(points, vec3_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec3_result[i], normalized(points[i]));
+      TEST("normalize", matching);
+
+      matching = true;
+      batch::length(points, scalars);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(scalars[i], length(points[i]));
+      TEST("length", matching);
+
+      matching = true;
+      batch::transform(m, vectors, vec4_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec4_result[i], m * vectors[i]);
+      TEST("transform", matching);
+
+      matching = true;
+      batch::transform_points(motor, points, vec3_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec3_result[i], transform_point(points[i], motor));
+      TEST("transform_points", matching);
+
+      matching = true;
+      std::vector<Vec2> vec2_result(COUNT);
+      batch::transform_points(motor2, points2, vec2_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec2_result[i], transform_point(points2[i], motor2));
+      TEST("transform_points Motor2", matching);
+
+      matching = true;
+      batch::transform_points(projection, points, vec3_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec3_result[i], (projection * Vec4(points[i], 1.0f)).xyz());
+      TEST("transform_points Mat4", matching);
+
+      matching = true;
+      batch::project_points(projection, points, vec3_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec3_result[i], homogeneous_projection(projection * Vec4(points[i], 1.0f)));
+      TEST("project_points", matching);
+
+      matching = true;
+      batch::project_points(projection_d, points_d, vec3d_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec3d_result[i], homogeneous_projection(projection_d * Vec4d(points_d[i], 1.0)));
+      TEST("project_points double", matching);
+
+      matching = true;
+      std::vector<Decomposition3> parts(COUNT);
+      batch::decompose(transforms, parts);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(as_transform(parts[i]), transforms[i]);
+      TEST("decompose", matching);
+
+      // Two words, the second one partially filled
+      matching = true;
+      std::vector<std::uint64_t> visible(2, ~std::uint64_t(0));
+      batch::cull_spheres(frustum, spheres, visible);
+      for (size_t i = 0; i < 2 * COUNT; i++) matching &= bool((visible[i / 64] >> (i % 64)) & 1) == is_visible(frustum, spheres[i]);
+      TEST("cull_spheres", matching && (visible[1] >> (2 * COUNT - 64)) == 0);
+
+      matching = true;
+      batch::cull_aabbs(frustum, boxes, visible);
+      for (size_t i = 0; i < 2 * COUNT; i++) matching &= bool((visible[i / 64] >> (i % 64)) & 1) == is_visible(frustum, boxes[i]);
+      TEST("cull_aabbs", matching && (visible[1] >> (2 * COUNT - 64)) == 0);
+
+      std::vector<Mvec3> mvec_result(COUNT);
+      matching = true;
+      batch::geometric_product(mvecs_a, mvecs_b, mvec_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(mvec_result[i], mvecs_a[i] * mvecs_b[i]);
+      TEST("geometric_product", matching);
+
+      matching = true;
+      batch::outer_product(mvecs_a, mvecs_b, mvec_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(mvec_result[i], mvecs_a[i] & mvecs_b[i]);
+      TEST("outer_product", matching);
+
+      matching = true;
+      batch::regressive_product(mvecs_a, mvecs_b, mvec_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(mvec_result[i], mvecs_a[i] | mvecs_b[i]);
+      TEST("regressive_product", matching);
+
+      matching = true;
+      mvec_result = mvecs_a;
+      batch::inner_product(mvec_result, mvecs_b, mvec_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(mvec_result[i], mvecs_a[i] || mvecs_b[i]);
+      TEST("inner_product in place", matching);
+
+      matching = true;
+      std::vector<Mvec3d> mvecd_result(COUNT);
+      batch::geometric_product(mvecs_d, mvecs_d, mvecd_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(mvecd_result[i], mvecs_d[i] * mvecs_d[i]);
+      TEST("geometric_product double", matching);
+
+      matching = true;
+      batch::rgb_to_oklab(colors, vec3_result);
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(vec3_result[i], ok::rgb_to_oklab(colors[i]));
+      TEST("rgb_to_oklab", matching);
+
+      matching = true;
+      const std::vector<ok::OkLab> labs = vec3_result;
+      batch::oklab_to_rgb(vec3_result, vec3_result);
+      // Compared in linear space: the gamma amplifies the rounding errors of channels close to 0
+      for (size_t i = 0; i < COUNT; i++) matching &= is_approx(rgb_to_lrgb(vec3_result[i]), ok::oklab_to_lrgb(labs[i]));
+      TEST("oklab_to_rgb in place", matching);
+    });
+  }
+  set_cpu_tier(detect_cpu_tier());
+
+  UNIT_TEST("threaded", {
+    // Large enough to be split across threads, in place
+    std::vector<Vec3> many(2 * batch::PARALLEL_THRESHOLD + 5);
+    for (size_t i = 0; i < many.size(); i++) {
+      many[i] = Vec3(float(i % 101), float(i % 37), -float(i % 11));
+    }
+    const std::vector<Vec3> expected = many;
+    batch::transform_points(m, many, many);
+
+    bool matching = true;
+    for (size_t i = 0; i < many.size(); i++) matching &= is_approx(many[i], (m * Vec4(expected[i], 1.0f)).xyz());
+    TEST("transform_points", matching);
+  });
+}
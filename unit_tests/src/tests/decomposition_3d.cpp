@@ -0,0 +1,55 @@
+#include "decomposition_3d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/decomposition_3d.hpp"
+
+
+using namespace kmath;
+
+
+static bool is_rotation(const Mat3 &m) {
+  return is_approx(transpose(m) * m, Mat3::IDENTITY) && is_approx(determinant(m), 1.0f);
+}
+
+
+void test_decomposition3() {
+  const Rotor3 rotor = Rotor3::from_axis_angle(normalized(Vec3(1.0f, -2.0f, 0.5f)), 2.1f);
+  const Vec3 translation(1.0f, -4.0f, 2.5f);
+
+  UNIT_TEST("polar_decompose", {
+    const Mat3 shear(Vec3(1.0f, 0.0f, 0.0f), Vec3(0.8f, 1.0f, 0.0f), Vec3(0.0f, -0.3f, 1.0f));
+    const Mat3 m = as_basis(rotor) * shear * Mat3::scale(3.0f, 0.01f, 150.0f);
+    Mat3 rotation;
+    Mat3 stretch;
+    polar_decompose(m, rotation, stretch);
+    TEST("rotation", is_rotation(rotation));
+    TEST_EQ_APPROX("symmetric stretch", stretch, transpose(stretch));
+    TEST_EQ_APPROX("rotation * stretch", rotation * stretch / 150.0f, m / 150.0f);
+
+    polar_decompose(Mat3::scale(-1.0f, 2.0f, 3.0f), rotation, stretch);
+    TEST("reflection rotation", is_rotation(rotation));
+    TEST_EQ_APPROX("reflection", rotation * stretch, Mat3::scale(-1.0f, 2.0f, 3.0f));
+
+    polar_decompose(Mat3::scale(0.0f, 1.0f, 2.0f), rotation, stretch);
+    TEST_EQ_APPROX("singular", rotation, Mat3::IDENTITY);
+    TEST_EQ_APPROX("singular stretch", stretch, Mat3::scale(0.0f, 1.0f, 2.0f));
+
+    // Rounding leaves a tiny determinant, it must still be detected as singular
+    const Mat3 rank_deficient = as_basis(rotor) * Mat3::scale(3.0f, 2.0f, 0.0f) * as_basis(Rotor3::from_axis_angle(normalized(Vec3(0.3f, 0.7f, -1.1f)), 0.7f));
+    polar_decompose(rank_deficient, rotation, stretch);
+    TEST_EQ_APPROX("rotated singular", rotation, Mat3::IDENTITY);
+    TEST_EQ_APPROX("rotated singular stretch", stretch, rank_deficient);
+  });
+
+  UNIT_TEST("decompose", {
+    const Mat4 m = as_transform(rotor, translation) * Mat4::scale(2.0f, 0.5f, 3.0f);
+    const Decomposition3 d = decompose(m);
+    TEST_EQ_APPROX("translation", d.translation, translation);
+    TEST_EQ_APPROX("rotation", as_basis(d.rotation), as_basis(rotor));
+    TEST_EQ_APPROX("scale", d.stretch, Mat3::scale(2.0f, 0.5f, 3.0f));
+    TEST_EQ_APPROX("as_transform", as_transform(d), m);
+
+    const Mat4 sheared = m * Mat4::from_basis(Mat3(Vec3(1.0f, 0.4f, 0.0f), Vec3(0.0f, 1.0f, 0.0f), Vec3(0.2f, 0.0f, 1.0f)));
+    TEST_EQ_APPROX("sheared as_transform", as_transform(decompose(sheared)), sheared);
+  });
+}
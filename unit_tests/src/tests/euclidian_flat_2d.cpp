@@ -0,0 +1,73 @@
+#include "euclidian_flat_2d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/euclidian_flat_2d.hpp"
+
+
+using namespace kmath;
+
+
+void test_line2() {
+  const Line2 a = Line2::line(Vec2(1.0f, 0.0f), 2.0f);
+  const Line2 b = Line2::line(Vec2(0.0f, 2.0f), 6.0f);
+  const Line2 c = Line2::line(Vec2(3.0f, -4.0f), 10.0f);
+
+  UNIT_TEST("Operators", {
+    TEST_EQ_APPROX("a + b", a + b, Line2(1.0f, 2.0f, -8.0f));
+    TEST_EQ_APPROX("a - b", a - b, Line2(1.0f, -2.0f, 4.0f));
+    TEST_EQ_APPROX("a * 2", a * 2.0f, Line2(2.0f, 0.0f, -4.0f));
+    TEST_EQ_APPROX("a / 0.5", a / 0.5f, Line2(2.0f, 0.0f, -4.0f));
+  });
+
+  UNIT_TEST("Magnitude", {
+    TEST_EQ_APPROX("magnitude", magnitude(c), 5.0f);
+    TEST_EQ_APPROX("normalized", normalized(c), Line2(0.6f, -0.8f, -2.0f));
+    TEST("vanishing", is_vanishing(Line2::VANISHING_LINE) && !is_vanishing(a));
+  });
+
+  UNIT_TEST("Meet", {
+    TEST_EQ_APPROX("a & b", as_vector(meet(a, b)), Vec2(2.0f, 3.0f));
+    TEST("parallel", is_vanishing(meet(a, Line2::line(Vec2(1.0f, 0.0f), -5.0f))));
+    TEST_EQ_APPROX("signed distance", meet(normalized(c), Point2::point(0.0f, 0.0f)), -2.0f);
+  });
+
+  UNIT_TEST("Reflection", {
+    TEST_EQ_APPROX("point", as_vector(reflect(Point2::point(3.0f, 5.0f), a)), Vec2(1.0f, 5.0f));
+    TEST_EQ_APPROX("line", reflect(b, Line2::Y_AXIS), -b);
+    TEST_EQ_APPROX("involution", reflect(reflect(c, b), b), c);
+  });
+}
+
+
+void test_point2() {
+  const Point2 p = Point2::point(1.0f, 2.0f);
+  const Point2 q = Point2::point(4.0f, 6.0f);
+  const Line2 x_axis = Line2::X_AXIS;
+
+  UNIT_TEST("Operators", {
+    TEST_EQ_APPROX("p + q", p + q, Point2(5.0f, 8.0f, 2.0f));
+    TEST_EQ_APPROX("-p", -p, Point2(-1.0f, -2.0f, -1.0f));
+    TEST_EQ_APPROX("p * 2", 2.0f * p, Point2(2.0f, 4.0f, 2.0f));
+  });
+
+  UNIT_TEST("Join", {
+    const Line2 l = join(p, q);
+    TEST("through p", is_on(p, l));
+    TEST("through q", is_on(q, l));
+    TEST_EQ_APPROX("meet of joins", as_vector(meet(join(p, q), join(Point2::point(0.0f, 0.0f), Point2::point(1.0f, -1.0f)))), Vec2(-2.0f / 7.0f, 2.0f / 7.0f));
+    TEST_EQ_APPROX("direction", as_vector(meet(l, Line2::VANISHING_LINE)), normalized(Vec2(3.0f, 4.0f)) * length(Vec2(3.0f, 4.0f)));
+  });
+
+  UNIT_TEST("Projection", {
+    TEST_EQ_APPROX("point on line", as_vector(project(q, x_axis)), Vec2(4.0f, 0.0f));
+    TEST_EQ_APPROX("fast", as_vector(fast_project(q, x_axis)), Vec2(4.0f, 0.0f));
+    TEST("line through point", is_on(p, project(x_axis, p)) && is_vanishing(meet(project(x_axis, p), x_axis)));
+    TEST("orthogonal", is_approx_zero(inner(inner(x_axis, p), x_axis)));
+  });
+
+  UNIT_TEST("Magnitude", {
+    TEST_EQ_APPROX("normalized", normalized(3.0f * q), q);
+    TEST_EQ_APPROX("direction", normalized(Point2::direction(3.0f, 4.0f)), Point2(0.6f, 0.8f, 0.0f));
+    TEST_EQ_APPROX("inverse", inverse(2.0f * p), -0.5f * p);
+  });
+}
@@ -0,0 +1,5 @@
+#pragma once
+
+
+void test_line2();
+void test_point2();
@@ -0,0 +1,52 @@
+#include "fast.hpp"
+#include "../testing.hpp"
+
+#include "kmath/fast.hpp"
+
+#include <cmath>
+
+
+using namespace kmath;
+using simd::f32x4;
+
+
+static bool is_within(const float value, const double expected, const double tolerance) {
+  return std::abs(double(value) - expected) <= tolerance;
+}
+
+
+void test_fast_math() {
+  UNIT_TEST("square root", {
+    for (float x = 0.01f; x < 1000.0f; x *= 1.7f) {
+      TEST("rsqrt", is_within(fast::rsqrt(x) * std::sqrt(x), 1.0, 3e-7));
+      TEST("sqrt", is_within(fast::sqrt(x) / std::sqrt(x), 1.0, 3e-7));
+      TEST("rsqrt pack", fast::rsqrt(f32x4(x)).lane(3) == fast::rsqrt(x));
+    }
+    TEST_EQ("sqrt(0)", fast::sqrt(0.0f), 0.0f);
+  });
+
+  UNIT_TEST("normalized", {
+    const Vec3 v(1.0f, -2.0f, 3.5f);
+    TEST_EQ_APPROX("vector", fast::normalized(v), normalized(v));
+    TEST_EQ_APPROX("length", fast::length(v), length(v));
+
+    const Rotor3 r(0.5f, 1.0f, -2.0f, 3.0f);
+    TEST_EQ_APPROX("rotor", fast::normalized(r), normalized(r));
+
+    const Motor3 m = 3.0f * Motor3::from_axis_angle_translation(normalized(v), 0.7f, Vec3(1.0f, -1.0f, 2.0f));
+    TEST_EQ_APPROX("motor", fast::normalized(m), normalized(m));
+  });
+
+  UNIT_TEST("trigonometric", {
+    for (float x = -20.0f; x < 20.0f; x += 0.37f) {
+      TEST("sin", is_within(fast::sin(x), std::sin(double(x)), 1e-6));
+      TEST("cos", is_within(fast::cos(x), std::cos(double(x)), 1e-6));
+      TEST("atan2", is_within(fast::atan2(x, -3.0f), std::atan2(double(x), -3.0), 2e-6));
+      TEST("sin pack", fast::sin(f32x4(x)).lane(0) == fast::sin(x));
+    }
+    for (float x = -1.0f; x <= 1.0f; x += 0.05f) {
+      TEST("acos", is_within(fast::acos(x), std::acos(double(x)), 6e-6));
+    }
+    TEST_EQ("atan2(0, 0)", fast::atan2(0.0f, 0.0f), 0.0f);
+  });
+}
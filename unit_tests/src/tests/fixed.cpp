@@ -0,0 +1,97 @@
+#include "fixed.hpp"
+#include "../testing.hpp"
+
+#include "kmath/fixed.hpp"
+#include "kmath/motor_3d.hpp"
+#include "kmath/rotor_3d.hpp"
+#include "kmath/vector.hpp"
+
+#include <cmath>
+#include <numbers>
+
+
+using namespace kmath;
+
+
+void test_fixed_point() {
+  UNIT_TEST("fixed point arithmetic", {
+    const q16_16 a(1.5);
+    const q16_16 b(-0.25);
+    TEST_EQ("one", q16_16(1).raw, 0x10000);
+    TEST_EQ("rounded", q16_16(0.1).raw, 6554);
+    TEST_EQ("add", double(a + b), 1.25);
+    TEST_EQ("multiply", double(a * b), -0.375);
+    TEST_EQ("divide", double(a / b), -6.0);
+    TEST_EQ("divide by zero", (a / q16_16(0)).raw, std::numeric_limits<std::int32_t>::max());
+    TEST_EQ("negate", double(-a), -1.5);
+    TEST_EQ("to integer", int(q16_16(-1.5)), -2);
+    TEST("compare", b < a && a == q16_16(1.5));
+    TEST_EQ("wrap around", (q16_16::from_raw(0x7fffffff) + q16_16::from_raw(1)).raw, std::numeric_limits<std::int32_t>::min());
+    TEST_EQ("q32_32", double(q32_32(3.25) * q32_32(-2)), -6.5);
+  });
+
+  UNIT_TEST("fixed point rounding", {
+    TEST_EQ("floor", double(floor(q16_16(-1.25))), -2.0);
+    TEST_EQ("ceil", double(ceil(q16_16(-1.25))), -1.0);
+    TEST_EQ("trunc", double(trunc(q16_16(-1.75))), -1.0);
+    TEST_EQ("round", double(round(q16_16(-2.5))), -3.0);
+    TEST_EQ("mod", double(mod(q16_16(-5.5), q16_16(2))), -1.5);
+    TEST_EQ("remainder", double(remainder(q16_16(5.5), q16_16(2))), -0.5);
+    TEST_EQ("pow", double(pow(q16_16(1.5), 3)), 3.375);
+    TEST_EQ("abs", double(abs(q16_16(-0.75))), 0.75);
+  });
+
+  UNIT_TEST("fixed point sqrt", {
+    TEST_EQ("exact", double(sqrt(q16_16(2.25))), 1.5);
+    TEST_EQ("zero", sqrt(q16_16(0)).raw, 0);
+    TEST_EQ("negative", sqrt(q16_16(-4)).raw, 0);
+
+    for (int i = 1; i < 2000; i++) {
+      const double x = 0.173 * double(i);
+      TEST("q16_16", std::abs(double(sqrt(q16_16(x))) - std::sqrt(double(q16_16(x)))) <= 0x1p-16);
+      TEST("q32_32", std::abs(double(sqrt(q32_32(x))) - std::sqrt(double(q32_32(x)))) <= 0x1p-32);
+    }
+  });
+
+  UNIT_TEST("fixed point trigonometry", {
+    TEST_EQ("sin(0)", sin(q16_16(0)).raw, 0);
+    TEST_EQ("cos(0)", cos(q16_16(0)).raw, 0x10000);
+
+    for (int i = -500; i < 500; i++) {
+      const double x = 0.0731 * double(i);
+      const double q16 = double(q16_16(x));
+      const double q32 = double(q32_32(x));
+      TEST("sin", std::abs(double(sin(q16_16(x))) - std::sin(q16)) <= 0x1p-16);
+      TEST("cos", std::abs(double(cos(q16_16(x))) - std::cos(q16)) <= 0x1p-16);
+      TEST("sin q32_32", std::abs(double(sin(q32_32(x))) - std::sin(q32)) <= 0x1p-31);
+      TEST("cos q32_32", std::abs(double(cos(q32_32(x))) - std::cos(q32)) <= 0x1p-31);
+    }
+
+    for (int i = 0; i < 360; i += 7) {
+      const double angle = double(i) * std::numbers::pi / 180.0;
+      const q16_16 y(3.0 * std::sin(angle));
+      const q16_16 x(3.0 * std::cos(angle));
+      TEST("atan2", std::abs(double(atan2(y, x)) - std::atan2(double(y), double(x))) <= 0x1p-15);
+    }
+    TEST_EQ("atan2(0, -1)", double(atan2(q16_16(0), q16_16(-1))), double(q16_16(std::numbers::pi)));
+    TEST_EQ("atan2(0, 0)", atan2(q16_16(0), q16_16(0)).raw, 0);
+    TEST("acos", std::abs(double(acos(q16_16(0.5))) - std::numbers::pi / 3.0) <= 0x1p-15);
+  });
+
+  UNIT_TEST("fixed point rotors and motors", {
+    const _Vec3<q16_16> axis(q16_16(0), q16_16(0), q16_16(1));
+    const _Rotor3<q16_16> r = _Rotor3<q16_16>::from_axis_angle(axis, q16_16(std::numbers::pi / 2.0));
+    const _Vec3<q16_16> x(q16_16(1), q16_16(0), q16_16(0));
+    const _Vec3<q16_16> rotated = transform(x, r);
+    TEST("rotor", std::abs(double(rotated.x)) <= 0x1p-14 && std::abs(double(rotated.y) - 1.0) <= 0x1p-14);
+
+    const _Vec3<q16_16> translation(q16_16(1), q16_16(2), q16_16(3));
+    const _Motor3<q16_16> m = _Motor3<q16_16>::from_rotor_translation(r, translation);
+    const _Vec3<q16_16> p = transform_point(x, m);
+    TEST("motor", std::abs(double(p.x) - 1.0) <= 0x1p-13 && std::abs(double(p.y) - 3.0) <= 0x1p-13 && std::abs(double(p.z) - 3.0) <= 0x1p-13);
+
+    // Same inputs give the same bits
+    const _Vec3<q16_16> q = transform_point(x, _Motor3<q16_16>::from_rotor_translation(r, translation));
+    TEST("deterministic", p.x.raw == q.x.raw && p.y.raw == q.y.raw && p.z.raw == q.z.raw);
+  });
+}
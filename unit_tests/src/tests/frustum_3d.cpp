@@ -0,0 +1,75 @@
+#include "frustum_3d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/frustum_3d.hpp"
+
+
+using namespace kmath;
+
+
+// Points of the ndc cube, unprojected, must be inside of the frustum and points past its faces
+// outside
+static bool classifies_ndc(const Frustum3 &frustum, const Mat4 &m, const float near_depth) {
+  const Mat4 inv = inverse(m);
+  const float center_depth = 0.5f * (near_depth + 1.0f);
+  const float half_depth = 0.5f * (1.0f - near_depth);
+  bool matching = true;
+  for (float x = -1.25f; x <= 1.25f; x += 0.25f) {
+    for (float y = -1.25f; y <= 1.25f; y += 0.25f) {
+      for (float z = -1.25f; z <= 1.25f; z += 0.25f) {
+        const Vec3 point = homogeneous_projection(inv * Vec4(x, y, center_depth + half_depth * z, 1.0f));
+        const bool inside = abs(x) < 0.99f && abs(y) < 0.99f && abs(z) < 0.99f;
+        const bool outside = abs(x) > 1.01f || abs(y) > 1.01f || abs(z) > 1.01f;
+        const bool visible = is_visible(frustum, Sphere3{ .center = point, .radius = 0.0f });
+        matching &= (!inside || visible) && (!outside || !visible);
+      }
+    }
+  }
+  return matching;
+}
+
+
+void test_frustum3() {
+  UNIT_TEST("orthogonal_no_ndc", {
+    const Mat4 rh = Mat4::orthogonal_rh_no_ndc(1.0f, 11.0f, 4.0f, 2.0f);
+    TEST_EQ_APPROX("rh near", rh * Vec4(2.0f, 1.0f, 1.0f, 1.0f), Vec4(1.0f, 1.0f, -1.0f, 1.0f));
+    TEST_EQ_APPROX("rh far", rh * Vec4(-2.0f, -1.0f, 11.0f, 1.0f), Vec4(-1.0f, -1.0f, 1.0f, 1.0f));
+
+    const Mat4 lh = Mat4::orthogonal_lh_no_ndc(1.0f, 11.0f, 4.0f, 2.0f);
+    TEST_EQ_APPROX("lh near", lh * Vec4(2.0f, 1.0f, -1.0f, 1.0f), Vec4(1.0f, 1.0f, -1.0f, 1.0f));
+    TEST_EQ_APPROX("lh far", lh * Vec4(-2.0f, -1.0f, -11.0f, 1.0f), Vec4(-1.0f, -1.0f, 1.0f, 1.0f));
+  });
+
+  UNIT_TEST("from_projection", {
+    const Mat4 view = Mat4::translation(Vec3(1.0f, -2.0f, 3.0f)) * Mat4::y_rotation(0.4f);
+
+    const Mat4 rh_no = Mat4::perspective_rh_no_ndc_vfov(0.5f, 100.0f, 1.2f, 1.5f) * view;
+    TEST("perspective_rh_no", classifies_ndc(Frustum3::from_projection_no_ndc(rh_no), rh_no, -1.0f));
+    const Mat4 lh_no = Mat4::perspective_lh_no_ndc_hfov(0.5f, 100.0f, 1.2f, 1.5f);
+    TEST("perspective_lh_no", classifies_ndc(Frustum3::from_projection_no_ndc(lh_no), lh_no, -1.0f));
+    const Mat4 rh_zo = Mat4::perspective_rh_zo_ndc_vfov(0.5f, 100.0f, 1.2f, 1.5f) * view;
+    TEST("perspective_rh_zo", classifies_ndc(Frustum3::from_projection_zo_ndc(rh_zo), rh_zo, 0.0f));
+    const Mat4 lh_zo = Mat4::perspective_lh_zo_ndc_hfov(0.5f, 100.0f, 1.2f, 1.5f);
+    TEST("perspective_lh_zo", classifies_ndc(Frustum3::from_projection_zo_ndc(lh_zo), lh_zo, 0.0f));
+    const Mat4 ortho = Mat4::orthogonal_lh_no_ndc(1.0f, 11.0f, 4.0f, 2.0f) * view;
+    TEST("orthogonal", classifies_ndc(Frustum3::from_projection_no_ndc(ortho), ortho, -1.0f));
+
+    const Frustum3 frustum = Frustum3::from_projection_no_ndc(Mat4::orthogonal_rh_no_ndc(1.0f, 11.0f, 4.0f, 2.0f));
+    TEST_EQ_APPROX("normalized", magnitude(frustum[Frustum3::LEFT_PLANE]), 1.0f);
+    TEST_EQ_APPROX("near distance", signed_distance(frustum[Frustum3::NEAR_PLANE], Vec3(0.0f, 0.0f, 3.0f)), 2.0f);
+  });
+
+  UNIT_TEST("is_visible", {
+    const Frustum3 frustum = Frustum3::from_projection_no_ndc(Mat4::orthogonal_rh_no_ndc(1.0f, 11.0f, 4.0f, 2.0f));
+
+    TEST("sphere inside", is_visible(frustum, Sphere3{ .center = Vec3(0.0f, 0.0f, 5.0f), .radius = 0.5f }));
+    TEST("sphere crossing", is_visible(frustum, Sphere3{ .center = Vec3(2.5f, 0.0f, 5.0f), .radius = 1.0f }));
+    TEST("sphere outside", !is_visible(frustum, Sphere3{ .center = Vec3(3.5f, 0.0f, 5.0f), .radius = 1.0f }));
+    TEST("sphere behind", !is_visible(frustum, Sphere3{ .center = Vec3(0.0f, 0.0f, -1.0f), .radius = 1.0f }));
+
+    TEST("box inside", is_visible(frustum, Aabb3{ .min = Vec3(-1.0f, -0.5f, 2.0f), .max = Vec3(1.0f, 0.5f, 3.0f) }));
+    TEST("box enclosing", is_visible(frustum, Aabb3{ .min = Vec3(-10.0f), .max = Vec3(10.0f, 10.0f, 20.0f) }));
+    TEST("box crossing", is_visible(frustum, Aabb3{ .min = Vec3(0.0f, 0.0f, 10.0f), .max = Vec3(1.0f, 1.0f, 12.0f) }));
+    TEST("box outside", !is_visible(frustum, Aabb3{ .min = Vec3(0.0f, 1.5f, 2.0f), .max = Vec3(1.0f, 2.0f, 3.0f) }));
+  });
+}
@@ -0,0 +1,76 @@
+#include "generated.hpp"
+#include "../testing.hpp"
+
+#include "kmath/private/generated/pga3d.hpp"
+#include "kmath/motor_3d.hpp"
+#include "kmath/pga_3d.hpp"
+
+
+using namespace kmath;
+using Basis = Mvec3::Basis;
+
+
+static Mvec3 as_mvec(const Motor3 &m) {
+  Mvec3 r = Mvec3::ZERO;
+  r[Basis::s] = m.s; r[Basis::e23] = m.e23; r[Basis::e31] = m.e31; r[Basis::e12] = m.e12;
+  r[Basis::e0123] = m.e0123; r[Basis::e01] = m.e01; r[Basis::e02] = m.e02; r[Basis::e03] = m.e03;
+  return r;
+}
+
+
+static Mvec3 as_mvec(const Plane3 &a) {
+  Mvec3 r = Mvec3::ZERO;
+  r[Basis::e1] = a.e1; r[Basis::e2] = a.e2; r[Basis::e3] = a.e3; r[Basis::e0] = a.e0;
+  return r;
+}
+
+
+static Mvec3 as_mvec(const Line3 &a) {
+  Mvec3 r = Mvec3::ZERO;
+  r[Basis::e23] = a.e23; r[Basis::e31] = a.e31; r[Basis::e12] = a.e12;
+  r[Basis::e01] = a.e01; r[Basis::e02] = a.e02; r[Basis::e03] = a.e03;
+  return r;
+}
+
+
+static Mvec3 as_mvec(const Point3 &a) {
+  Mvec3 r = Mvec3::ZERO;
+  r[Basis::e032] = a.e032; r[Basis::e013] = a.e013; r[Basis::e021] = a.e021; r[Basis::e123] = a.e123;
+  return r;
+}
+
+
+// m * x * ~m with the dense multivector product
+static Mvec3 sandwich(const Motor3 &m, const Mvec3 &x) {
+  Mvec3 reversed = as_mvec(m);
+  for (size_t i = size_t(Basis::e01); i <= size_t(Basis::e123); i++) {
+    reversed[i] = -reversed[i];
+  }
+  return as_mvec(m) * x * reversed;
+}
+
+
+void test_generated() {
+  const Motor3 a = Motor3::from_rotor_translation(Rotor3::from_axis_angle(normalized(Vec3(1.0f, -2.0f, 0.5f)), 2.1f), Vec3(1.0f, -4.0f, 2.5f));
+  const Motor3 b = Motor3::from_rotor_translation(Rotor3::from_axis_angle(normalized(Vec3(0.0f, 1.0f, 1.0f)), -0.7f), Vec3(-2.0f, 0.5f, 1.0f));
+  const Plane3 plane = Plane3::plane(Vec3(1.0f, -2.0f, 3.0f), 5.0f);
+  const Plane3 other = Plane3::plane(Vec3(-0.5f, 1.0f, 2.0f), -1.5f);
+  const Point3 p = Point3::point(Vec3(0.5f, 2.0f, -1.5f));
+  const Point3 q = Point3::point(Vec3(-1.0f, 0.25f, 3.0f));
+  const Line3 line = join(p, q);
+
+  UNIT_TEST("products", {
+    TEST_EQ_APPROX("motor product", (_pga3_motor_product<Motor3>(a, b)), a * b);
+    TEST_EQ_APPROX("meet", (_pga3_meet<Line3>(plane, other)), meet(plane, other));
+    TEST_EQ_APPROX("meet line", (_pga3_meet_line<Point3>(plane, line)), meet(plane, line));
+    TEST_EQ_APPROX("join", (_pga3_join<Line3>(p, q)), join(p, q));
+    TEST_EQ_APPROX("join point", (_pga3_join_point<Plane3>(line, p)), join(line, p));
+  });
+
+  UNIT_TEST("sandwiches", {
+    TEST_EQ_APPROX("plane", as_mvec(_pga3_transform_plane<Plane3>(a, plane)), sandwich(a, as_mvec(plane)));
+    TEST_EQ_APPROX("line", as_mvec(_pga3_transform_line<Line3>(a, line)), sandwich(a, as_mvec(line)));
+    TEST_EQ_APPROX("point", as_mvec(_pga3_transform_point<Point3>(a, p)), sandwich(a, as_mvec(p)));
+    TEST_EQ_APPROX("unnormalized", as_mvec(_pga3_transform_point<Point3>(2.0f * a, p)), sandwich(2.0f * a, as_mvec(p)));
+  });
+}
@@ -0,0 +1,116 @@
+#include "graded_mvec_3d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/graded_mvec_3d.hpp"
+
+#include <type_traits>
+
+
+using namespace kmath;
+
+
+constexpr const unsigned EVEN = MVEC3_GRADES<0, 2, 4>;
+constexpr const unsigned POINTS_AND_PLANES = MVEC3_GRADES<1, 3>;
+
+
+// Non-zero coefficients, different for every blade
+template<unsigned GRADES>
+static GradedMvec3<GRADES> sample(const float seed) {
+  GradedMvec3<GRADES> m;
+  for (size_t i = 0; i < m.data.size(); i++) {
+    m.data[i] = seed + float(i % 5) * 0.5f - float(i) * 0.125f;
+  }
+  return m;
+}
+
+
+// Every product must match the dense one
+template<unsigned A, unsigned B>
+static bool matches_dense(const float seed) {
+  const GradedMvec3<A> a = sample<A>(seed);
+  const GradedMvec3<B> b = sample<B>(1.0f - seed);
+  const Mvec3 da = as_mvec(a);
+  const Mvec3 db = as_mvec(b);
+  return is_approx(as_mvec(a * b), da * db)
+      && is_approx(as_mvec(a & b), da & db)
+      && is_approx(as_mvec(a | b), da | db)
+      && is_approx(as_mvec(a || b), da || db)
+      && is_approx(as_mvec(a + b), da + db)
+      && is_approx(as_mvec(a - b), da - db);
+}
+
+
+void test_graded_mvec3() {
+  const Mvec3Vector plane = Mvec3Vector::plane(1.0f, 2.0f, -2.0f, 3.0f);
+  const Mvec3Trivector point = Mvec3Trivector::point(Vec3(1.0f, -1.0f, 0.5f));
+  const Mvec3Bivector line = Mvec3Bivector::line_at(normalized(Vec3(1.0f, 2.0f, 0.0f)), Vec3(0.0f, 1.0f, 3.0f));
+  const Motor3 motor = Motor3::from_rotor_translation(Rotor3::from_axis_angle(normalized(Vec3(1.0f, 0.0f, 1.0f)), 0.8f), Vec3(1.0f, 2.0f, 3.0f));
+
+  UNIT_TEST("products", {
+    TEST("dense", (matches_dense<MVEC3_ALL_GRADES, MVEC3_ALL_GRADES>(0.3f)));
+    TEST("plane point", (matches_dense<MVEC3_GRADES<1>, MVEC3_GRADES<3>>(0.3f)));
+    TEST("point plane", (matches_dense<MVEC3_GRADES<3>, MVEC3_GRADES<1>>(-0.7f)));
+    TEST("line plane", (matches_dense<MVEC3_GRADES<2>, MVEC3_GRADES<1>>(0.6f)));
+    TEST("line line", (matches_dense<MVEC3_GRADES<2>, MVEC3_GRADES<2>>(0.2f)));
+    TEST("motor point", (matches_dense<EVEN, MVEC3_GRADES<3>>(-0.4f)));
+    TEST("motor mixed", (matches_dense<EVEN, POINTS_AND_PLANES>(0.9f)));
+    TEST("scalar pseudoscalar", (matches_dense<MVEC3_GRADES<0>, MVEC3_GRADES<4>>(1.5f)));
+  });
+
+  UNIT_TEST("result grades", {
+    using Meet = decltype(plane & plane);
+    using Join = decltype(point | point);
+    using Projection = decltype(plane || point);
+    using Composition = decltype(Mvec3Even() * Mvec3Even());
+    using Reflection = decltype(plane * point * plane);
+    TEST("plane & plane is a line", (std::is_same_v<Meet, Mvec3Bivector>));
+    TEST("point | point is a line", (std::is_same_v<Join, Mvec3Bivector>));
+    TEST("plane || point is a line", (std::is_same_v<Projection, Mvec3Bivector>));
+    TEST("motor * motor is a motor", (std::is_same_v<Composition, Mvec3Even>));
+    TEST("plane * point * plane", (std::is_same_v<Reflection, GradedMvec3<POINTS_AND_PLANES>>));
+    TEST("plane * plane", (std::is_same_v<decltype(plane * plane), GradedMvec3<MVEC3_GRADES<0, 2>>>));
+    TEST("size", Mvec3Vector::SIZE == 4 && Mvec3Bivector::SIZE == 6 && Mvec3Even::SIZE == 8 && GradedMvec3<MVEC3_ALL_GRADES>::SIZE == 16);
+  });
+
+  UNIT_TEST("restricted products", {
+    const Mvec3Bivector orthogonal = plane || point;
+    TEST_EQ_APPROX("geometric", as_mvec(geometric_product<MVEC3_GRADES<3>>(orthogonal, plane)), as_mvec((orthogonal * plane).grade<3>()));
+    TEST_EQ_APPROX("outer", as_mvec(outer_product<MVEC3_GRADES<2>>(plane, plane)), as_mvec(plane & plane));
+    TEST_EQ_APPROX("regressive", as_mvec(regressive_product<MVEC3_GRADES<0>>(line, line)), as_mvec((line | line).grade<0>()));
+    TEST_EQ_APPROX("inner", as_mvec(inner_product<MVEC3_GRADES<0>>(plane, plane)), as_mvec(plane || plane));
+    TEST("no term", (std::is_same_v<decltype(geometric_product<MVEC3_GRADES<0>>(plane, point)), GradedMvec3<0>>));
+  });
+
+  UNIT_TEST("unary", {
+    const GradedMvec3<MVEC3_ALL_GRADES> m = sample<MVEC3_ALL_GRADES>(0.25f);
+    TEST_EQ_APPROX("rev", as_mvec(m.rev()), as_mvec(m).rev());
+    TEST_EQ_APPROX("conj", as_mvec(m.conj()), as_mvec(m).conj());
+    TEST_EQ_APPROX("hdual", as_mvec(m.hdual()), as_mvec(m).hdual());
+    TEST("hdual of a plane is a point", (std::is_same_v<decltype(plane.hdual()), Mvec3Trivector>));
+    TEST_EQ_APPROX("norm_squared", m.norm_squared(), as_mvec(m).norm_squared());
+    TEST_EQ_APPROX("inorm_squared", m.inorm_squared(), as_mvec(m).inorm_squared());
+    TEST_EQ_APPROX("grade", as_mvec(m.grade<2>()), as_mvec(m).grade(2));
+    TEST_EQ_APPROX("opposite", as_mvec(-m), -as_mvec(m));
+    TEST_EQ_APPROX("scalar", as_mvec(2.0f * m / 4.0f), as_mvec(m) * 0.5f);
+  });
+
+  UNIT_TEST("conversions", {
+    TEST_EQ_APPROX("plane", as_mvec(plane), Mvec3::plane(1.0f, 2.0f, -2.0f, 3.0f));
+    TEST_EQ_APPROX("point", as_mvec(point), Mvec3::point(Vec3(1.0f, -1.0f, 0.5f)));
+    TEST_EQ_APPROX("line", as_mvec(line), Mvec3::line_at(normalized(Vec3(1.0f, 2.0f, 0.0f)), Vec3(0.0f, 1.0f, 3.0f)));
+    TEST_EQ_APPROX("motor", as_mvec(Mvec3Even::motor(motor)), Mvec3::motor(motor));
+    TEST_EQ_APPROX("rotor", as_mvec(Mvec3Even::rotor(get_rotor(motor))), Mvec3::rotor(get_rotor(motor)));
+    TEST_EQ_APPROX("from dense", as_mvec(Mvec3Trivector(as_mvec(point) + Mvec3::e1)), as_mvec(point));
+    TEST_EQ_APPROX("widening", as_mvec(GradedMvec3<POINTS_AND_PLANES>(point)), as_mvec(point));
+    TEST_EQ_APPROX("narrowing", as_mvec(Mvec3Vector(plane + point)), as_mvec(plane));
+    TEST_EQ("missing blade", point[Mvec3Trivector::Basis::e1], 0.0f);
+  });
+
+  UNIT_TEST("geometry", {
+    // The projection of a point on a plane is on the plane
+    const Mvec3Trivector projected = geometric_product<MVEC3_GRADES<3>>(plane || point, plane).point_normalize();
+    TEST_EQ_APPROX("on plane", (plane & projected)[Mvec3Vector::Basis::e0123], 0.0f);
+    TEST_EQ_APPROX("plane_normalize", plane.plane_normalize().norm(), 1.0f);
+    TEST_EQ_APPROX("line_normalize", line.line_normalize().norm(), 1.0f);
+  });
+}
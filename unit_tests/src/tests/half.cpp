@@ -0,0 +1,75 @@
+#include "half.hpp"
+#include "../testing.hpp"
+
+#include "kmath/half.hpp"
+#include "kmath/matrix.hpp"
+#include "kmath/vector.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+
+using namespace kmath;
+
+
+void test_half_float() {
+  UNIT_TEST("half conversion", {
+    TEST_EQ("one", half(1.0f).bits, 0x3c00);
+    TEST_EQ("max", float(half::from_bits(0x7bff)), 65504.0f);
+    TEST_EQ("smallest subnormal", float(half::from_bits(0x0001)), std::ldexp(1.0f, -24));
+    TEST_EQ("round to even", half(1.0f + std::ldexp(1.0f, -11)).bits, 0x3c00);
+    TEST_EQ("round up", half(1.0f + 3.0f * std::ldexp(1.0f, -11)).bits, 0x3c02);
+    TEST_EQ("overflow", half(65520.0f).bits, 0x7c00);
+    TEST_EQ("negative zero", half(-0.0f).bits, 0x8000);
+    TEST("nan", is_nan(half(std::numeric_limits<float>::quiet_NaN())));
+
+    for (std::uint32_t bits = 0; bits < 0x7c00; bits += 251) {
+      const half h = half::from_bits(std::uint16_t(bits));
+      TEST_EQ("round trip", half(float(h)).bits, h.bits);
+    }
+  });
+
+  UNIT_TEST("bfloat16 conversion", {
+    TEST_EQ("one", bfloat16(1.0f).bits, 0x3f80);
+    TEST_EQ("truncated", float(bfloat16(3.14159265f)), 3.140625f);
+    TEST_EQ("round to even", bfloat16(1.0f + std::ldexp(1.0f, -8)).bits, 0x3f80);
+    TEST("nan", is_nan(bfloat16(std::numeric_limits<float>::quiet_NaN())));
+    TEST("large", float(bfloat16(1e30f)) / 1e30f > 0.99f);
+  });
+
+  UNIT_TEST("arithmetic", {
+    const half a(1.5f);
+    const half b(-0.25f);
+    TEST_EQ("add", float(a + b), 1.25f);
+    TEST_EQ("multiply", float(a * b), -0.375f);
+    TEST_EQ("negate", float(-a), -1.5f);
+    TEST_EQ("sqrt", float(sqrt(half(2.25f))), 1.5f);
+
+    const _Vec3<half> v(half(1.0f), half(2.0f), half(2.0f));
+    TEST_EQ("vector length", float(length(v)), 3.0f);
+
+    const _Mat4<half> m = _Mat4<half>::IDENTITY;
+    const _Vec4<half> p(half(1.0f), half(-2.0f), half(0.5f), half(1.0f));
+    TEST("matrix product", all(equal(m * p, p)));
+  });
+
+  UNIT_TEST("batch conversion", {
+    std::vector<float> values;
+    for (size_t i = 0; i < 37; i++) {
+      values.push_back(0.37f * float(i) - 5.0f);
+    }
+
+    std::vector<half> halves(values.size());
+    std::vector<float> back(values.size());
+    convert(std::span<const float>(values), std::span<half>(halves));
+    convert(std::span<const half>(halves), std::span<float>(back));
+    TEST_EQ("half", halves[36].bits, half(values[36]).bits);
+    TEST_EQ("back", back[35], float(half(values[35])));
+
+    const std::vector<Vec3> vectors(9, Vec3(1.0f, -0.5f, 0.1f));
+    std::vector<_Vec3<bfloat16>> packed(vectors.size());
+    convert(std::span<const Vec3>(vectors), std::span<_Vec3<bfloat16>>(packed));
+    TEST_EQ("vectors", packed[8].z.bits, bfloat16(0.1f).bits);
+  });
+}
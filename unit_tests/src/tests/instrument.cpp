@@ -0,0 +1,88 @@
+#include "instrument.hpp"
+#include "../testing.hpp"
+
+#include "kmath/graded_mvec_3d.hpp"
+#include "kmath/instrument.hpp"
+#include "kmath/lazy_mvec_3d.hpp"
+#include "kmath/matrix.hpp"
+#include "kmath/motor_2d.hpp"
+#include "kmath/motor_3d.hpp"
+#include "kmath/pga_3d.hpp"
+#include "kmath/similarity_3d.hpp"
+
+
+using namespace kmath;
+using instrument::OpCounts;
+using C = instrument::Counted<float>;
+
+
+// Budgets of the hot kernels: a formula change that costs more operations fails these tests.
+// Lower them when a change saves operations.
+constexpr const OpCounts ROTOR3_PRODUCT{ .adds = 12, .muls = 16 };
+constexpr const OpCounts MOTOR3_PRODUCT{ .adds = 40, .muls = 48 };
+constexpr const OpCounts MOTOR3_TRANSFORM_POINT{ .adds = 36, .muls = 91, .divs = 1 };
+constexpr const OpCounts MOTOR3_TRANSFORM_LINE{ .adds = 63, .muls = 68 };
+constexpr const OpCounts MOTOR3_SCLERP{ .adds = 86, .muls = 127, .divs = 1, .transcendentals = 4 };
+constexpr const OpCounts MOTOR2_PRODUCT{ .adds = 8, .muls = 12 };
+constexpr const OpCounts MOTOR2_TRANSFORM_POINT{ .adds = 8, .muls = 18, .divs = 1 };
+constexpr const OpCounts MVEC3_PRODUCT{ .adds = 176, .muls = 192 };
+constexpr const OpCounts GRADED_MVEC3_PROJECTION{ .adds = 11, .muls = 21 };
+constexpr const OpCounts LAZY_MVEC3_PROJECTION{ .adds = 136, .muls = 156 };
+constexpr const OpCounts MVEC3_NORM_SQUARED{ .adds = 7, .muls = 8 };
+constexpr const OpCounts SIMILARITY3_PRODUCT{ .adds = 27, .muls = 38 };
+constexpr const OpCounts MAT4_PRODUCT{ .adds = 48, .muls = 64 };
+constexpr const OpCounts MAT4_INVERSE{ .adds = 49, .muls = 94, .divs = 1 };
+
+
+void test_instrument() {
+  const _Motor3<C> a = _Motor3<C>::from_rotor_translation(
+    _Rotor3<C>::from_axis_angle(normalized(_Vec3<C>(1.0f, 2.0f, -1.0f)), C(0.7f)),
+    _Vec3<C>(1.0f, 2.0f, 3.0f)
+  );
+  const _Motor3<C> b = _Motor3<C>::from_rotor_translation(
+    _Rotor3<C>::from_axis_angle(_Vec3<C>(0.0f, 1.0f, 0.0f), C(1.1f)),
+    _Vec3<C>(-1.0f, 0.0f, 2.0f)
+  );
+  const _Vec3<C> p(1.0f, 2.0f, 3.0f);
+  const _Mat4<C> m = as_transform(a);
+
+  UNIT_TEST("counting", {
+    const C x(2.0f);
+    const C y(3.0f);
+    const OpCounts counts = instrument::count_ops([&]() { return sqrt(x * y + x) / 2 - exp(y); });
+    TEST("adds", counts.adds == 2);
+    TEST("muls", counts.muls == 1);
+    TEST("divs", counts.divs == 1);
+    TEST("sqrts", counts.sqrts == 1);
+    TEST("transcendentals", counts.transcendentals == 1);
+    TEST("value", float(sqrt(x * y + x) / 2 - exp(y)) == std::sqrt(8.0f) / 2.0f - std::exp(3.0f));
+    TEST("fits", instrument::fits(counts, counts) && !instrument::fits(counts + counts, counts));
+  });
+
+  UNIT_TEST("kernel budgets", {
+    const _Rotor3<C> r = get_rotor(a);
+    const _Similarity3<C> s(r, p, C(2.0f));
+    const _Line3<C> line(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f);
+    const _Mvec3<C> u = _Mvec3<C>::e12 + _Mvec3<C>::e0 * C(2.0f);
+    const _Mvec3<C> v = _Mvec3<C>::e123 - _Mvec3<C>::e1;
+    const _Mvec3Vector<C> plane = _Mvec3Vector<C>::plane(C(1.0f), C(2.0f), C(3.0f), C(4.0f));
+    const _Mvec3Trivector<C> point = _Mvec3Trivector<C>::point(p);
+    const _Motor2<C> a2 = _Motor2<C>::from_angle_translation(C(0.7f), _Vec2<C>(1.0f, 2.0f));
+    const _Motor2<C> b2 = _Motor2<C>::from_angle_translation(C(1.1f), _Vec2<C>(-1.0f, 0.0f));
+
+    TEST("Rotor3 * Rotor3", instrument::fits(instrument::count_ops([&]() { return r * r; }), ROTOR3_PRODUCT));
+    TEST("Motor3 * Motor3", instrument::fits(instrument::count_ops([&]() { return a * b; }), MOTOR3_PRODUCT));
+    TEST("transform_point(Vec3, Motor3)", instrument::fits(instrument::count_ops([&]() { return transform_point(p, a); }), MOTOR3_TRANSFORM_POINT));
+    TEST("transform(Line3, Motor3)", instrument::fits(instrument::count_ops([&]() { return transform(line, a); }), MOTOR3_TRANSFORM_LINE));
+    TEST("sclerp", instrument::fits(instrument::count_ops([&]() { return sclerp(a, b, C(0.3f)); }), MOTOR3_SCLERP));
+    TEST("Motor2 * Motor2", instrument::fits(instrument::count_ops([&]() { return a2 * b2; }), MOTOR2_PRODUCT));
+    TEST("transform_point(Vec2, Motor2)", instrument::fits(instrument::count_ops([&]() { return transform_point(p.xy(), a2); }), MOTOR2_TRANSFORM_POINT));
+    TEST("Mvec3 * Mvec3", instrument::fits(instrument::count_ops([&]() { return u * v; }), MVEC3_PRODUCT));
+    TEST("norm_squared(Mvec3)", instrument::fits(instrument::count_ops([&]() { return u.norm_squared(); }), MVEC3_NORM_SQUARED));
+    TEST("lazy ((Mvec3 || Mvec3) * Mvec3).grade(3)", instrument::fits(instrument::count_ops([&]() { return ((lazy::expr(u) || v) * u).grade(3); }), LAZY_MVEC3_PROJECTION));
+    TEST("point projected on a plane", instrument::fits(instrument::count_ops([&]() { return geometric_product<MVEC3_GRADES<3>>(plane || point, plane); }), GRADED_MVEC3_PROJECTION));
+    TEST("Similarity3 * Similarity3", instrument::fits(instrument::count_ops([&]() { return s * s; }), SIMILARITY3_PRODUCT));
+    TEST("Mat4 * Mat4", instrument::fits(instrument::count_ops([&]() { return m * m; }), MAT4_PRODUCT));
+    TEST("inverse(Mat4)", instrument::fits(instrument::count_ops([&]() { return inverse(m); }), MAT4_INVERSE));
+  });
+}
@@ -0,0 +1,61 @@
+#include "lazy.hpp"
+#include "../testing.hpp"
+
+#include "kmath/lazy.hpp"
+
+#include <vector>
+
+
+using namespace kmath;
+
+
+static std::vector<Vec3> make_vectors(const size_t count, const float scale) {
+  std::vector<Vec3> vectors;
+  for (size_t i = 0; i < count; i++) {
+    vectors.push_back(scale * Vec3(float(i) - 3.0f, 1.0f + 0.5f * float(i), 2.0f));
+  }
+  return vectors;
+}
+
+
+template<typename E>
+static constexpr bool is_mul_add = false;
+
+template<typename A, typename B, typename C>
+static constexpr bool is_mul_add<lazy::_MulAdd<A, B, C>> = true;
+
+
+void test_lazy_expressions() {
+  constexpr const size_t COUNT = 37;
+  const std::vector<Vec3> va = make_vectors(COUNT, 1.0f);
+  const std::vector<Vec3> vb = make_vectors(COUNT, -0.5f);
+  const Vec3Array a(va);
+  const Vec3Array b(vb);
+
+  UNIT_TEST("evaluation", {
+    Vec3Array result;
+
+    lazy::evaluate(lazy::lerp(a, b, 0.25f), result);
+    TEST("size", result.size() == COUNT);
+    TEST_EQ_APPROX("lerp", result.get(COUNT - 1), lerp(va[COUNT - 1], vb[COUNT - 1], 0.25f));
+
+    lazy::evaluate(lazy::expr(a) * b - lazy::expr(b) / 4.0f, result);
+    TEST_EQ_APPROX("multiply-subtract", result.get(7), va[7] * vb[7] - vb[7] / 4.0f);
+
+    lazy::evaluate(2.0f * (lazy::expr(b) - a) + (-lazy::expr(a)), result);
+    TEST_EQ_APPROX("scale-add", result.get(COUNT - 1), 2.0f * (vb[COUNT - 1] - va[COUNT - 1]) - va[COUNT - 1]);
+  });
+
+  UNIT_TEST("fusion", {
+    using Product = decltype(lazy::expr(a) * b);
+    using Sum = decltype(lazy::expr(a) * b + a);
+    using Lerp = decltype(lazy::lerp(a, b, 0.5f));
+    TEST("product", lazy::_is_product<Product>);
+    TEST("multiply-add", (std::same_as<Sum, lazy::_MulAdd<lazy::_Array<_Vec3, float>, lazy::_Array<_Vec3, float>, lazy::_Array<_Vec3, float>>>));
+    TEST("lerp", is_mul_add<Lerp> && (std::same_as<decltype(Lerp::a), lazy::_Binary<lazy::_Sub, lazy::_Array<_Vec3, float>, lazy::_Array<_Vec3, float>>>));
+
+    Vec3Array result = a;
+    lazy::evaluate(lazy::expr(result) * b + result, result);
+    TEST_EQ_APPROX("aliasing", result.get(3), va[3] * vb[3] + va[3]);
+  });
+}
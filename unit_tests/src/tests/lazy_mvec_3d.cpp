@@ -0,0 +1,85 @@
+#include "lazy_mvec_3d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/lazy_mvec_3d.hpp"
+
+
+using namespace kmath;
+
+
+// Relative to the largest coefficient of b: the errors of float grow with the coefficients, and
+// the dense products may be rounded with FMAs (see the hardware specialization of pga_3d.hpp)
+static bool matches(const Mvec3 &a, const Mvec3 &b) {
+  float largest = 1.0f;
+  for (size_t i = 0; i < 16; i++) {
+    largest = max(largest, abs(b[i]));
+  }
+  return is_approx(a / largest, b / largest);
+}
+
+
+static bool matches(const float a, const float b) {
+  const float scale = max(1.0f, abs(b));
+  return is_approx(a / scale, b / scale);
+}
+
+
+// Non-zero coefficients, different for every blade
+static Mvec3 sample(const float seed) {
+  Mvec3 m;
+  for (size_t i = 0; i < 16; i++) {
+    m[i] = seed + float(i % 5) * 0.5f - float(i) * 0.125f;
+  }
+  return m;
+}
+
+
+void test_lazy_mvec3() {
+  const Mvec3 a = sample(0.3f);
+  const Mvec3 b = sample(-0.6f);
+  const Mvec3 c = sample(1.1f);
+
+  UNIT_TEST("products", {
+    TEST("geometric", matches(lazy::expr(a) * b, a * b));
+    TEST("outer", matches(a & lazy::expr(b), a & b));
+    TEST("regressive", matches(lazy::expr(a) | lazy::expr(b), a | b));
+    TEST("inner", matches(lazy::expr(a) || b, a || b));
+    TEST("nested", matches(((lazy::expr(a) || b) * c) & (lazy::expr(c) | a), ((a || b) * c) & (c | a)));
+  });
+
+  UNIT_TEST("arithmetic", {
+    TEST("sum", matches(lazy::expr(a) * b + c, a * b + c));
+    TEST("difference", matches(c - lazy::expr(a) * b, c - a * b));
+    TEST("opposite", matches(-(lazy::expr(a) * b), -(a * b)));
+    TEST("scalar", matches(2.0f * (lazy::expr(a) * b) / 4.0f, (a * b) * 0.5f));
+    TEST("rev", matches((lazy::expr(a) * b).rev(), (a * b).rev()));
+    TEST("conj", matches((lazy::expr(a) * b).conj(), (a * b).conj()));
+    TEST("hdual", matches((lazy::expr(a) * b).hdual(), (a * b).hdual()));
+  });
+
+  UNIT_TEST("partial evaluation", {
+    const Mvec3 product = (a || b) * c;
+    bool matching = true;
+    for (size_t i = 0; i < 16; i++) {
+      matching &= matches(((lazy::expr(a) || b) * c)[i], product[i]);
+    }
+    TEST("operator[]", matching);
+    TEST_EQ_APPROX("basis", ((lazy::expr(a) || b) * c)[Mvec3::Basis::e123], product[Mvec3::Basis::e123]);
+    matching = true;
+    for (int g = 0; g <= 4; g++) {
+      matching &= matches(((lazy::expr(a) || b) * c).grade(g), product.grade(g));
+    }
+    TEST("grade", matching);
+    TEST("norm_squared", matches((lazy::expr(a) * b).norm_squared(), (a * b).norm_squared()));
+    TEST("inorm_squared", matches((lazy::expr(a) * b).inorm_squared(), (a * b).inorm_squared()));
+    TEST_EQ_APPROX("dense norm_squared", a.norm_squared(), (a * a.rev())[0]);
+  });
+
+  UNIT_TEST("normalize", {
+    TEST("plane", matches((lazy::expr(a) * b).plane_normalize(), (a * b).plane_normalize()));
+    TEST("line", matches((lazy::expr(a) * b).line_normalize(), (a * b).line_normalize()));
+    TEST("vanishing line", matches((lazy::expr(a) * b).vanishing_line_normalize(), (a * b).vanishing_line_normalize()));
+    TEST("point", matches((lazy::expr(a) * b).point_normalize(), (a * b).point_normalize()));
+    TEST("point grade", matches((lazy::expr(a) * b).point_normalize().grade(3), (a * b).point_normalize().grade(3)));
+  });
+}
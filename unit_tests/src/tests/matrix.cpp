@@ -9,8 +9,32 @@ using namespace kmath;
 
 
 void test_matrix4() {
+  UNIT_TEST("product", {
+    const Mat4 a = Mat4::perspective_rh_no_ndc_hfov(0.3, 50.0, 0.8 * PI, 1.0) * Mat4::translation(Vec3(1.0, -2.0, 3.0));
+    const Mat4 b = Mat4::x_rotation(0.4) * Mat4::scale(1.0, 2.0, 3.0);
+    const Mat4 ab = a * b;
+
+    Mat4 expected = Mat4::ZERO;
+    for (size_t i = 0; i < 4; i++) {
+      for (size_t j = 0; j < 4; j++) {
+        for (size_t k = 0; k < 4; k++) {
+          expected(i, j) += a(i, k) * b(k, j);
+        }
+      }
+    }
+    TEST_EQ_APPROX("a * b", ab, expected);
+    TEST_EQ_APPROX("(a * b) * v", ab * Vec4(1.0, 2.0, 3.0, 1.0), a * (b * Vec4(1.0, 2.0, 3.0, 1.0)));
+    TEST_EQ_APPROX("v * a", Vec4(1.0, 2.0, 3.0, 1.0) * a, transpose(a) * Vec4(1.0, 2.0, 3.0, 1.0));
+  });
+
   UNIT_TEST("inverse", {
     Mat4 a = Mat4::perspective_rh_no_ndc_hfov(0.3, 50.0, 0.8 * PI, 1.0);
     TEST_EQ_APPROX("a * a^(-1)", a * inverse(a), Mat4::IDENTITY);
+
+    const Mat4 b(Vec4(1.0, 2.0, 0.5, 0.1), Vec4(-1.0, 3.0, 2.0, 0.2), Vec4(0.3, 0.7, 4.0, -0.3), Vec4(5.0, -2.0, 1.0, 1.5));
+    TEST_EQ_APPROX("b * b^(-1)", b * inverse(b), Mat4::IDENTITY);
+    TEST_EQ_APPROX("b^(-1) * b", inverse(b) * b, Mat4::IDENTITY);
+    TEST_EQ_APPROX("determinant", determinant(b), 40.24f);
+    TEST_EQ("non-invertible", inverse(Mat4::scale(1.0, 0.0, 1.0)).x.x, 0.0f);
   });
 }
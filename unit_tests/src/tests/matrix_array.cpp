@@ -0,0 +1,61 @@
+#include "matrix_array.hpp"
+#include "../testing.hpp"
+
+#include "kmath/matrix_array.hpp"
+
+#include <vector>
+
+
+using namespace kmath;
+
+
+static std::vector<Mat4> make_matrices(const size_t count) {
+  std::vector<Mat4> matrices;
+  for (size_t i = 0; i < count; i++) {
+    const float t = float(i);
+    matrices.push_back(Mat4::translation(Vec3(t, 1.0f - t, 0.5f * t)) * Mat4::y_rotation(0.1f * t) * Mat4::scale(1.0f + 0.1f * t, 2.0f, 0.5f));
+  }
+  return matrices;
+}
+
+
+void test_matrix_array() {
+  // Not a multiple of any pack size, so that the last pack is partially filled
+  constexpr const size_t COUNT = 37;
+  const std::vector<Mat4> ma = make_matrices(COUNT);
+  std::vector<Mat4> mb = make_matrices(COUNT);
+  mb[3] = Mat4::ZERO;
+  const Mat4Array a(ma);
+  const Mat4Array b(mb);
+  const Mat4 c = Mat4::perspective_rh_no_ndc_hfov(0.3f, 50.0f, 1.5f, 1.0f);
+
+  UNIT_TEST("storage", {
+    TEST("size", a.size() == COUNT);
+    TEST_EQ_APPROX("get", a.get(COUNT - 1), ma[COUNT - 1]);
+  });
+
+  UNIT_TEST("batch functions", {
+    Mat4Array result;
+
+    multiply(a, b, result);
+    TEST_EQ_APPROX("a * b", result.get(COUNT - 1), ma[COUNT - 1] * mb[COUNT - 1]);
+
+    multiply(a, c, result);
+    TEST_EQ_APPROX("a * c", result.get(5), ma[5] * c);
+
+    multiply(c, a, result);
+    TEST_EQ_APPROX("c * a", result.get(5), c * ma[5]);
+
+    transpose(a, result);
+    TEST_EQ_APPROX("transpose", result.get(7), transpose(ma[7]));
+
+    inverse(b, result);
+    TEST_EQ_APPROX("inverse", result.get(COUNT - 1), inverse(mb[COUNT - 1]));
+    TEST_EQ_APPROX("a * a^(-1)", ma[10] * result.get(10), Mat4::IDENTITY);
+    TEST_EQ_APPROX("non-invertible", result.get(3), Mat4::ZERO);
+
+    result = a;
+    inverse(result, result);
+    TEST_EQ_APPROX("in place", result.get(2), inverse(ma[2]));
+  });
+}
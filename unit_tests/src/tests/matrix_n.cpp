@@ -0,0 +1,153 @@
+#include "matrix_n.hpp"
+#include "../testing.hpp"
+
+#include "kmath/matrix_n.hpp"
+
+#include <cmath>
+
+
+using namespace kmath;
+
+
+// Template arguments would break the test macros
+using Mat3x3d = MatNd<3, 3>;
+using Mat4x4d = MatNd<4, 4>;
+using Mat6d = MatNd<6, 6>;
+using Mat9x6d = MatNd<9, 6>;
+using Vec6d = VecNd<6>;
+using Vec9d = VecNd<9>;
+
+
+// Deterministic, well conditioned (diagonally dominant) 6x6 matrix
+static Mat6d make_system() {
+  Mat6d m;
+  for (size_t j = 0; j < 6; j++) {
+    for (size_t i = 0; i < 6; i++) {
+      m(i, j) = (i == j)? 8.0 + double(i) : std::sin(double(3 * i + 7 * j + 1));
+    }
+  }
+  return m;
+}
+
+
+// Regular, but with coefficients of very different magnitudes
+template<typename T, size_t N>
+static _MatN<T, N, N> make_diagonal(const T (&diagonal)[N]) {
+  _MatN<T, N, N> m = _MatN<T, N, N>::ZERO;
+  for (size_t i = 0; i < N; i++) {
+    m(i, i) = diagonal[i];
+  }
+  return m;
+}
+
+
+template<typename T>
+static _VecN<T, 2> make_vec2(const T x, const T y) {
+  _VecN<T, 2> v;
+  v(0) = x;
+  v(1) = y;
+  return v;
+}
+
+
+static Vec6d make_vector() {
+  Vec6d v;
+  for (size_t i = 0; i < 6; i++) {
+    v(i) = double(i) - 2.5;
+  }
+  return v;
+}
+
+
+void test_matrix_n() {
+  const Mat4d m4 = Mat4d::translation(Vec3d(1.0, 2.0, -3.0)) * Mat4d::y_rotation(0.3) * Mat4d::scale(2.0, 1.0, 0.5);
+  const Mat6d a = make_system();
+  const Vec6d x = make_vector();
+  const Vec6d b = a * x;
+
+  UNIT_TEST("operations", {
+    const Mat4x4d n4 = Mat4x4d::from_mat4(m4);
+    TEST_EQ_APPROX("from_mat4", n4(1, 3), m4(1, 3));
+    TEST_EQ_APPROX("product", (n4 * n4)(2, 1), (m4 * m4)(2, 1));
+    TEST_EQ_APPROX("identity", a * Mat6d::IDENTITY, a);
+    TEST_EQ_APPROX("transpose", transpose(a)(1, 4), a(4, 1));
+    TEST_EQ_APPROX("trace", trace(Mat6d::IDENTITY), 6.0);
+    TEST_EQ_APPROX("dot", dot(x, x), 17.5);
+  });
+
+  UNIT_TEST("LU", {
+    Mat6d lu = a;
+    _LUPivots<6> pivots;
+    TEST("decompose", lu_decompose(lu, pivots));
+    Vec6d result = b;
+    lu_solve(lu, pivots, result);
+    TEST_EQ_APPROX("solve", result, x);
+    TEST_EQ_APPROX("solve()", solve(a, b), x);
+    TEST_EQ_APPROX("determinant", determinant(Mat4x4d::from_mat4(m4)), determinant(m4));
+    TEST_EQ_APPROX("a * a^(-1)", a * inverse(a), Mat6d::IDENTITY);
+
+    Mat6d singular = a;
+    for (size_t i = 0; i < 6; i++) {
+      singular(i, 5) = singular(i, 0) + singular(i, 2);
+    }
+    TEST("singular", !lu_decompose(singular, pivots));
+    TEST_EQ_APPROX("singular inverse", inverse(Mat3x3d::ZERO), Mat3x3d::ZERO);
+  });
+
+  UNIT_TEST("Cholesky", {
+    const Mat6d spd = transpose(a) * a;
+    Mat6d l = spd;
+    TEST("decompose", cholesky_decompose(l));
+    Vec6d result = spd * x;
+    cholesky_solve(l, result);
+    TEST_EQ_APPROX("solve", result, x);
+
+    Mat6d not_positive = spd;
+    not_positive(3, 3) = -1.0;
+    TEST("not positive definite", !cholesky_decompose(not_positive));
+  });
+
+  UNIT_TEST("QR", {
+    Mat6d qr = a;
+    Vec6d tau;
+    TEST("decompose", qr_decompose(qr, tau));
+    Vec6d result = b;
+    qr_solve(qr, tau, result);
+    TEST_EQ_APPROX("square solve", result, x);
+
+    // Overdetermined: the least squares solution is the one of the normal equations
+    Mat9x6d tall;
+    Vec9d rhs;
+    for (size_t i = 0; i < 9; i++) {
+      for (size_t j = 0; j < 6; j++) {
+        tall(i, j) = a(i % 6, j) + ((i >= 6)? 0.5 * double(j) : 0.0);
+      }
+      rhs(i) = std::cos(double(i));
+    }
+    const Vec6d expected = solve(transpose(tall) * tall, transpose(tall) * rhs);
+    Vec6d tall_tau;
+    Mat9x6d tall_qr = tall;
+    TEST("decompose least squares", qr_decompose(tall_qr, tall_tau));
+    qr_solve(tall_qr, tall_tau, rhs);
+    bool matching = true;
+    for (size_t i = 0; i < 6; i++) {
+      matching &= is_approx(rhs(i), expected(i));
+    }
+    TEST("least squares", matching);
+
+    Mat9x6d deficient = tall;
+    for (size_t i = 0; i < 9; i++) {
+      deficient(i, 4) = 2.0 * deficient(i, 1);
+    }
+    TEST("rank deficient", !qr_decompose(deficient, tall_tau));
+  });
+  UNIT_TEST("badly scaled", {
+    // The determinants are compared relatively, they are smaller than the test epsilon
+    TEST_EQ_APPROX("determinant", determinant(make_diagonal({1.0, 1e-6})) / 1e-6, 1.0);
+    TEST_EQ_APPROX("determinant 3x3", determinant(make_diagonal({1000.0, 1.0, 0.005})), 5.0);
+    TEST_EQ_APPROX("solve", solve(make_diagonal({1.0, 1e-6}), make_vec2(2.0, 3e-6)), make_vec2(2.0, 3.0));
+    TEST_EQ_APPROX("float determinant", determinant(make_diagonal({1.0f, 1e-6f})) / 1e-6f, 1.0f);
+    TEST_EQ_APPROX("float determinant 3x3", determinant(make_diagonal({1000.0f, 1.0f, 0.005f})), 5.0f);
+    TEST_EQ_APPROX("float solve", solve(make_diagonal({1.0f, 1e-6f}), make_vec2(2.0f, 3e-6f)), make_vec2(2.0f, 3.0f));
+  });
+}
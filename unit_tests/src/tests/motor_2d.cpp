@@ -0,0 +1,61 @@
+#include "motor_2d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/motor_2d.hpp"
+
+
+using namespace kmath;
+
+
+static Mat3 rigid_transform(const float angle, const Vec2 &translation) {
+  const float c = cos(angle);
+  const float s = sin(angle);
+  return Mat3(Vec3(c, s, 0.0f), Vec3(-s, c, 0.0f), Vec3(translation, 1.0f));
+}
+
+
+void test_motor2() {
+  const Motor2 a = Motor2::from_angle_translation(0.7f, Vec2(-1.0f, 4.0f));
+  const Motor2 b = Motor2::from_angle_translation(-2.3f, Vec2(3.0f, 0.5f));
+  const Vec2 p(1.0f, 2.0f);
+
+  UNIT_TEST("Transform", {
+    TEST_EQ_APPROX("rotation", transform_point(Vec2(1.0f, 0.0f), Motor2::from_angle(0.5f)), Vec2(cos(0.5f), sin(0.5f)));
+    TEST_EQ_APPROX("translation", transform_point(p, Motor2::from_translation(Vec2(2.0f, 3.0f))), Vec2(3.0f, 5.0f));
+    TEST_EQ_APPROX("matrix", Vec3(transform_point(p, a), 1.0f), rigid_transform(0.7f, Vec2(-1.0f, 4.0f)) * Vec3(p, 1.0f));
+    TEST_EQ_APPROX("as_transform", as_transform(a), rigid_transform(0.7f, Vec2(-1.0f, 4.0f)));
+    TEST_EQ_APPROX("direction", transform_direction(p, a), (rigid_transform(0.7f, Vec2(-1.0f, 4.0f)) * Vec3(p, 0.0f)).xy());
+    TEST_EQ_APPROX("point", as_vector(transform(Point2::point(p), a)), transform_point(p, a));
+    TEST_EQ_APPROX("unnormalized", transform_point(p, 3.0f * a), transform_point(p, a));
+    TEST_EQ_APPROX("center", transform_point(Vec2(3.0f, 1.0f), Motor2::from_angle_center(1.0f, Vec2(3.0f, 1.0f))), Vec2(3.0f, 1.0f));
+  });
+
+  UNIT_TEST("Lines", {
+    const Point2 q = Point2::point(-2.0f, 0.5f);
+    const Line2 l = join(Point2::point(p), q);
+    const Line2 moved = transform(l, a);
+    TEST("on line", is_on(transform(Point2::point(p), a), moved) && is_on(transform(q, a), moved));
+    TEST_EQ_APPROX("magnitude", magnitude(moved), magnitude(l));
+    TEST_EQ_APPROX("reflections", transform_point(p, Line2::Y_AXIS * Line2::X_AXIS), -p);
+  });
+
+  UNIT_TEST("Composition", {
+    TEST_EQ_APPROX("product", transform_point(p, a * b), transform_point(transform_point(p, b), a));
+    TEST_EQ_APPROX("inverse", transform_point(transform_point(p, a), inverse(a)), p);
+    TEST_EQ_APPROX("angle", get_angle(a * b), 0.7f - 2.3f);
+    TEST_EQ_APPROX("translation", get_translation(a), Vec2(-1.0f, 4.0f));
+  });
+
+  UNIT_TEST("Exp & log", {
+    TEST_EQ_APPROX("exp(log(a))", exp(log(a)), a);
+    TEST_EQ_APPROX("translation", exp(log(Motor2::from_translation(p))), Motor2::from_translation(p));
+    TEST_EQ_APPROX("pow", transform_point(p, pow(a, 2.0f)), transform_point(p, a * a));
+  });
+
+  UNIT_TEST("sclerp", {
+    TEST_EQ_APPROX("start", sclerp(a, b, 0.0f), a);
+    TEST_EQ_APPROX("end", sclerp(a, b, 1.0f), b);
+    const Motor2 half = sclerp(a, b, 0.5f);
+    TEST_EQ_APPROX("half", transform_point(p, half * reverse(a) * half), transform_point(p, b));
+  });
+}
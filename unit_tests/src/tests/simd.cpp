@@ -0,0 +1,96 @@
+#include "simd.hpp"
+#include "../testing.hpp"
+
+#include "kmath/simd.hpp"
+#include "kmath/motor_3d.hpp"
+#include "kmath/vector.hpp"
+
+
+using namespace kmath;
+using simd::f32x4;
+
+
+static const float LANES_A[4] = {1.0f, -2.0f, 3.5f, 0.25f};
+static const float LANES_B[4] = {4.0f, 0.5f, -1.0f, 2.0f};
+static const float LANES_C[4] = {2.0f, 1.0f, 0.5f, -3.0f};
+static const float LANES_A_MIN_ZERO[4] = {0.0f, -2.0f, 0.0f, 0.0f};
+static const float LANES_ANGLES[4] = {0.3f, -2.5f, 7.0f, -100.25f};
+static const float LANES_POSITIVE[4] = {0.125f, 1.5f, 20.0f, 3000.0f};
+static const float LANES_SPECIAL[4] = {0.0f, -1.0f, INFINITY, 2.0f};
+
+
+void test_simd_pack() {
+  UNIT_TEST("arithmetic", {
+    const f32x4 a = f32x4::load(LANES_A);
+    const f32x4 b = f32x4::load(LANES_B);
+
+    for (size_t i = 0; i < f32x4::LANES; i++) {
+      TEST_EQ_APPROX("a + b", (a + b).lane(i), LANES_A[i] + LANES_B[i]);
+      TEST_EQ_APPROX("a * b", (a * b).lane(i), LANES_A[i] * LANES_B[i]);
+      TEST_EQ_APPROX("a / b", (a / b).lane(i), LANES_A[i] / LANES_B[i]);
+    }
+    TEST_EQ_APPROX("broadcast", f32x4(2.0f) * a, a + a);
+  });
+
+  UNIT_TEST("masks", {
+    const f32x4 a = f32x4::load(LANES_A);
+    const f32x4 expected_min = f32x4::load(LANES_A_MIN_ZERO);
+
+    TEST("lesser", lesser(a, f32x4(0.0f)).lane(1) && !lesser(a, f32x4(0.0f)).lane(0));
+    TEST("any", any(lesser(a, f32x4(0.0f))));
+    TEST("not all", !all(lesser(a, f32x4(0.0f))));
+    TEST("bits", simd::bits(lesser(a, f32x4(0.0f))) == 0b0010 && simd::bits(greater(a, f32x4(0.0f))) == 0b1101);
+    TEST_EQ_APPROX("select", select(greater(a, f32x4(0.0f)), f32x4(0.0f), a), expected_min);
+    TEST_EQ_APPROX("min", min(a, f32x4(0.0f)), expected_min);
+    TEST_EQ_APPROX("abs", abs(a) * abs(a), a * a);
+    TEST_EQ_APPROX("sqrt", sqrt(a * a), abs(a));
+    for (size_t i = 0; i < f32x4::LANES; i++) {
+      TEST("sign", kmath::sign(a).lane(i) == kmath::sign(LANES_A[i]));
+      TEST("possign", kmath::possign(a).lane(i) == kmath::possign(LANES_A[i]));
+      TEST("negsign", kmath::negsign(a).lane(i) == kmath::negsign(LANES_A[i]));
+    }
+    TEST("possign(0)", possign(f32x4(0.0f)).lane(0) == 1.0f);
+    TEST("negsign(0)", negsign(f32x4(0.0f)).lane(0) == -1.0f);
+  });
+
+  UNIT_TEST("transcendental", {
+    const f32x4 angles = f32x4::load(LANES_ANGLES);
+    const f32x4 positive = f32x4::load(LANES_POSITIVE);
+    f32x4 sin_angles;
+    f32x4 cos_angles;
+    sincos(angles, sin_angles, cos_angles);
+
+    for (size_t i = 0; i < f32x4::LANES; i++) {
+      TEST_EQ_APPROX("exp", exp(angles).lane(i), std::exp(LANES_ANGLES[i]));
+      TEST_EQ_APPROX("ln", ln(positive).lane(i), std::log(LANES_POSITIVE[i]));
+      TEST_EQ_APPROX("sin", sin(angles).lane(i), std::sin(LANES_ANGLES[i]));
+      TEST_EQ_APPROX("cos", cos(angles).lane(i), std::cos(LANES_ANGLES[i]));
+      TEST("sincos", sin_angles.lane(i) == sin(angles).lane(i) && cos_angles.lane(i) == cos(angles).lane(i));
+      TEST_EQ_APPROX("atan2", atan2(angles, angles - positive).lane(i), std::atan2(LANES_ANGLES[i], LANES_ANGLES[i] - LANES_POSITIVE[i]));
+      TEST_EQ_APPROX("pow", pow(positive, f32x4(0.7f)).lane(i) / std::pow(LANES_POSITIVE[i], 0.7f), 1.0f);
+      TEST_EQ_APPROX("cbrt", cbrt(angles).lane(i), std::cbrt(LANES_ANGLES[i]));
+      TEST_EQ_APPROX("ln1p", kmath::ln1p(positive).lane(i), kmath::ln1p(LANES_POSITIVE[i]));
+      TEST_EQ_APPROX("lngamma", kmath::lngamma(positive).lane(i), kmath::lngamma(LANES_POSITIVE[i]));
+    }
+
+    // Special values are the ones of the standard library
+    const f32x4 special = f32x4::load(LANES_SPECIAL);
+    TEST("ln(0)", ln(special).lane(0) == -INFINITY);
+    TEST("ln(-1)", is_nan(ln(special)).lane(1));
+    TEST("ln(inf)", ln(special).lane(2) == INFINITY);
+    TEST_EQ_APPROX("ln(2)", ln(special).lane(3), std::log(2.0f));
+    TEST("exp(inf)", exp(special).lane(2) == INFINITY);
+  });
+
+  UNIT_TEST("transform_point", {
+    const Motor3 m = Motor3::from_axis_angle_translation(normalized(Vec3(1.0, 2.0, 3.0)), 0.7, Vec3(1.0, -1.0, 2.0));
+    const _Motor3<f32x4> pm(m.s, m.e23, m.e31, m.e12, m.e0123, m.e01, m.e02, m.e03);
+    const _Vec3<f32x4> points(f32x4::load(LANES_A), f32x4::load(LANES_B), f32x4::load(LANES_C));
+    const _Vec3<f32x4> transformed = transform_point(points, pm);
+
+    for (size_t i = 0; i < f32x4::LANES; i++) {
+      const Vec3 lane(transformed.x.lane(i), transformed.y.lane(i), transformed.z.lane(i));
+      TEST_EQ_APPROX("matches scalar", lane, transform_point(Vec3(LANES_A[i], LANES_B[i], LANES_C[i]), m));
+    }
+  });
+}
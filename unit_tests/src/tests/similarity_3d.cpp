@@ -0,0 +1,44 @@
+#include "similarity_3d.hpp"
+#include "../testing.hpp"
+
+#include "kmath/similarity_3d.hpp"
+
+
+using namespace kmath;
+
+
+void test_similarity3() {
+  const Similarity3 a(Rotor3::from_axis_angle(normalized(Vec3(1.0f, -2.0f, 0.5f)), 2.1f), Vec3(1.0f, -4.0f, 2.5f), 3.0f);
+  const Similarity3 b(Rotor3::from_axis_angle(normalized(Vec3(0.0f, 1.0f, 1.0f)), -0.7f), Vec3(-2.0f, 0.5f, 1.0f), 0.25f);
+  const Vec3 p(0.5f, 2.0f, -1.5f);
+
+  UNIT_TEST("transform_point", {
+    TEST_EQ_APPROX("matrix", transform_point(p, a), (as_transform(a) * Vec4(p, 1.0f)).xyz());
+    TEST_EQ_APPROX("direction", transform_direction(p, a), (as_transform(a) * Vec4(p, 0.0f)).xyz());
+    TEST_EQ_APPROX("identity", transform_point(p, Similarity3::IDENTITY), p);
+    TEST_EQ_APPROX("scale", transform_point(p, Similarity3::from_scale(2.0f)), 2.0f * p);
+  });
+
+  UNIT_TEST("compose", {
+    TEST_EQ_APPROX("points", transform_point(p, a * b), transform_point(transform_point(p, b), a));
+    TEST_EQ_APPROX("matrix", as_transform(a * b), as_transform(a) * as_transform(b));
+    TEST_EQ_APPROX("inverse", transform_point(transform_point(p, a), inverse(a)), p);
+    TEST_EQ_APPROX("inverse matrix", as_transform(inverse(a * b)), inverse(as_transform(a * b)));
+  });
+
+  UNIT_TEST("seplerp", {
+    const Similarity3 start = seplerp(a, b, 0.0f);
+    const Similarity3 end = seplerp(a, b, 1.0f);
+    const Similarity3 half = seplerp(Similarity3::from_scale(1.0f), Similarity3::from_scale(4.0f), 0.5f);
+    TEST_EQ_APPROX("start", as_transform(start), as_transform(a));
+    TEST_EQ_APPROX("end", as_transform(end), as_transform(b));
+    TEST_EQ_APPROX("geometric scale", half.scale, 2.0f);
+  });
+
+  UNIT_TEST("conversions", {
+    TEST_EQ_APPROX("as_similarity", as_transform(as_similarity(as_transform(a))), as_transform(a));
+    const Motor3 motor = Motor3::from_rotor_translation(a.rotor, a.translation);
+    TEST_EQ_APPROX("motor", transform_point(p, as_similarity(motor)), transform_point(p, motor));
+    TEST_EQ_APPROX("as_motor", transform_point(p, as_motor(as_similarity(motor))), transform_point(p, motor));
+  });
+}
@@ -0,0 +1,82 @@
+#include "transform_hierarchy.hpp"
+#include "../testing.hpp"
+
+#include "kmath/transform_hierarchy.hpp"
+
+
+using namespace kmath;
+
+
+// World transform computed by walking the parents
+template<typename TR>
+static TR walk_parents(const _TransformHierarchy<TR> &hierarchy, size_t node) {
+  TR world = hierarchy.local(node);
+  for (node = hierarchy.parent(node); node != _TransformHierarchy<TR>::NO_PARENT; node = hierarchy.parent(node)) {
+    world = hierarchy.local(node) * world;
+  }
+  return world;
+}
+
+
+template<typename TR>
+static bool matches_walk(const _TransformHierarchy<TR> &hierarchy) {
+  bool matching = true;
+  for (size_t i = 0; i < hierarchy.size(); i++) {
+    matching &= !hierarchy.is_dirty(i) && is_approx(hierarchy.world(i), walk_parents(hierarchy, i));
+  }
+  return matching;
+}
+
+
+static Motor3 motor(const float t) {
+  return Motor3::from_rotor_translation(Rotor3::from_axis_angle(normalized(Vec3(1.0f, t, -1.0f)), t), Vec3(t, 1.0f, -0.5f * t));
+}
+
+
+void test_transform_hierarchy() {
+  UNIT_TEST("update", {
+    // Two trees, 0 -> 1 -> 2 -> 3 and 1 -> 4, and 5 -> 6
+    MotorHierarchy3 hierarchy;
+    const size_t root = hierarchy.add(motor(0.1f));
+    const size_t a = hierarchy.add(motor(0.2f), root);
+    const size_t b = hierarchy.add(motor(0.3f), a);
+    hierarchy.add(motor(0.4f), b);
+    const size_t leaf = hierarchy.add(motor(0.5f), a);
+    const size_t other = hierarchy.add(motor(0.6f));
+    hierarchy.add(motor(0.7f), other);
+    TEST("depth", hierarchy.depth(root) == 0 && hierarchy.depth(b) == 2 && hierarchy.depth(leaf) == 2);
+
+    TEST("first update", hierarchy.update() == 7);
+    TEST("first worlds", matches_walk(hierarchy));
+    TEST("clean", hierarchy.update() == 0);
+
+    hierarchy.set_local(b, motor(1.3f));
+    hierarchy.set_local(b, motor(1.4f));
+    TEST("dirty", hierarchy.is_dirty(b) && !hierarchy.is_dirty(leaf));
+    TEST("subtree", hierarchy.update() == 2);
+    TEST("subtree worlds", matches_walk(hierarchy));
+
+    // Dirty descendants of a dirty node are recomputed once
+    hierarchy.set_local(b, motor(2.0f));
+    hierarchy.set_local(a, motor(2.1f));
+    hierarchy.set_local(other, motor(2.2f));
+    TEST("nested", hierarchy.update() == 6);
+    TEST("nested worlds", matches_walk(hierarchy));
+  });
+
+  UNIT_TEST("threaded", {
+    // Wide levels, split across threads
+    Mat4Hierarchy hierarchy;
+    const size_t root = hierarchy.add(Mat4::translation(Vec3(1.0f, 2.0f, 3.0f)));
+    for (size_t i = 0; i < 2 * Mat4Hierarchy::PARALLEL_THRESHOLD; i++) {
+      const size_t child = hierarchy.add(Mat4::y_rotation(float(i % 100) * 0.01f), root);
+      hierarchy.add(Mat4::translation(Vec3(float(i % 7), 0.0f, 1.0f)), child);
+    }
+    TEST("update", hierarchy.update() == hierarchy.size());
+    TEST("worlds", matches_walk(hierarchy));
+
+    hierarchy.set_local(root, Mat4::x_rotation(0.5f));
+    TEST("root", hierarchy.update() == hierarchy.size());
+    TEST("root worlds", matches_walk(hierarchy));
+  });
+}
@@ -3,6 +3,8 @@
 
 #include "kmath/vector.hpp"
 
+#include <cmath>
+
 
 using namespace kmath;
 
@@ -99,6 +101,21 @@ void test_vector3() {
     TEST_EQ_APPROX("b / -0.25", b / -0.25f, _Vec3<float>(8.0, -20.0, -4.0));
     TEST_EQ_APPROX("c /= 0.5", c /= 0.5f, _Vec3<float>(2.0, 4.0, 6.0));
   });
+  UNIT_TEST("Comparison masks", {
+    TEST_EQ("a < b", lesser(a, b).bits, 0b010);
+    TEST_EQ("a >= b", greater_eq(a, b).bits, 0b101);
+    TEST("any", any(lesser(a, b)) && !all(lesser(a, b)) && !none(lesser(a, b)));
+    TEST("!(a < b)", (!lesser(a, b)) == greater_eq(a, b));
+    TEST_EQ("select", select(lesser(a, b), a, b), _Vec3<float>(-2.0, 2.0, 1.0));
+    TEST_EQ("abs", abs(b), _Vec3<float>(2.0, 5.0, 1.0));
+    TEST_EQ("clamp", clamp(b, 0.0f, 2.0f), _Vec3<float>(0.0, 2.0, 1.0));
+    TEST_EQ("is_nan", is_nan(_Vec3<float>(0.0, std::nanf(""), 1.0)).bits, 0b010);
+    TEST_EQ("integers", equal(_Vec3<int>(1, 2, 3), _Vec3<int>(1, 0, 3)).bits, 0b101);
+    TEST("bool vectors", all(equal(Vec3b(true, false, true), Vec3b(true, false, true))));
+    TEST("long double abs", abs(_Vec3<long double>(-2.0L, 5.0L, -1.0L)) == _Vec3<long double>(2.0L, 5.0L, 1.0L));
+    TEST("long double clamp", clamp(_Vec3<long double>(-2.0L, 5.0L, 1.0L), 0.0L, 2.0L) == _Vec3<long double>(0.0L, 2.0L, 1.0L));
+    TEST("long double lesser", all(lesser(_Vec3<long double>(-2.0L, 5.0L, 1.0L), _Vec3<long double>(3.0L, 6.0L, 2.0L))));
+  });
 }
 
 
@@ -145,4 +162,12 @@ void test_vector4() {
     TEST_EQ_APPROX("b / -0.25", b / -0.25f, _Vec4<float>(8.0, -20.0, -4.0, -8.0));
     TEST_EQ_APPROX("c /= 0.5", c /= 0.5f, _Vec4<float>(2.0, 4.0, 6.0, -2.0));
   });
+  UNIT_TEST("Comparison masks", {
+    TEST_EQ("a < b", lesser(a, b).bits, 0b1010);
+    TEST_EQ("a == a", equal(a, a).bits, 0b1111);
+    TEST("all", all(equal(a, a)) && none(not_equal(a, a)));
+    TEST_EQ("select", select(greater(a, b), a, b), _Vec4<float>(1.0, 5.0, 3.0, 2.0));
+    TEST_EQ("abs", abs(a), _Vec4<float>(1.0, 2.0, 3.0, 1.0));
+    TEST_EQ("double", lesser(_Vec4<double>(1.0, 2.0, 3.0, -1.0), _Vec4<double>(-2.0, 5.0, 1.0, 2.0)).bits, 0b1010);
+  });
 }
@@ -0,0 +1,94 @@
+#include "vector_array.hpp"
+#include "../testing.hpp"
+
+#include "kmath/vector_array.hpp"
+
+#include <vector>
+
+
+using namespace kmath;
+
+
+static std::vector<Vec3> make_vectors(const size_t count, const float scale) {
+  std::vector<Vec3> vectors;
+  for (size_t i = 0; i < count; i++) {
+    vectors.push_back(scale * Vec3(float(i) + 1.0f, 2.0f - float(i), 0.5f * float(i)));
+  }
+  return vectors;
+}
+
+
+void test_vector_array() {
+  // Not a multiple of any pack size, so that the last pack is partially filled
+  constexpr const size_t COUNT = 37;
+  const std::vector<Vec3> va = make_vectors(COUNT, 1.0f);
+  const std::vector<Vec3> vb = make_vectors(COUNT, -0.25f);
+  const Vec3Array a(va);
+  const Vec3Array b(vb);
+
+  UNIT_TEST("storage", {
+    TEST("size", a.size() == COUNT);
+    TEST("padding", a.capacity() % Vec3Array::PADDING == 0 && a.capacity() >= COUNT);
+    TEST("alignment", reinterpret_cast<size_t>(a.component(1)) % Vec3Array::ALIGNMENT == 0);
+    TEST_EQ_APPROX("get", a.get(COUNT - 1), va[COUNT - 1]);
+
+    Vec3Array c = a;
+    c.resize(2 * COUNT);
+    TEST_EQ_APPROX("resize keeps values", c.get(COUNT - 1), va[COUNT - 1]);
+    TEST_EQ_APPROX("resize clears", c.get(2 * COUNT - 1), Vec3::ZERO);
+  });
+
+  UNIT_TEST("vector functions", {
+    std::vector<float> scalars(COUNT);
+    Vec3Array result;
+
+    dot(a, b, std::span<float>(scalars));
+    TEST_EQ_APPROX("dot", scalars[COUNT - 1], dot(va[COUNT - 1], vb[COUNT - 1]));
+
+    length(a, std::span<float>(scalars));
+    TEST_EQ_APPROX("length", scalars[3], length(va[3]));
+
+    distance(a, b, std::span<float>(scalars));
+    TEST_EQ_APPROX("distance", scalars[COUNT - 1], distance(va[COUNT - 1], vb[COUNT - 1]));
+
+    normalized(a, result);
+    TEST_EQ_APPROX("normalized", result.get(COUNT - 1), normalized(va[COUNT - 1]));
+
+    cross(a, b, result);
+    TEST_EQ_APPROX("cross", result.get(5), cross(va[5], vb[5]));
+
+    lerp(a, b, 0.25f, result);
+    TEST_EQ_APPROX("lerp", result.get(7), lerp(va[7], vb[7], 0.25f));
+  });
+
+  UNIT_TEST("element-wise functions", {
+    Vec3Array result;
+
+    abs(b, result);
+    TEST_EQ_APPROX("abs", result.get(COUNT - 1), abs(vb[COUNT - 1]));
+
+    clamp(a, 0.0f, 3.0f, result);
+    TEST_EQ_APPROX("clamp", result.get(COUNT - 1), clamp(va[COUNT - 1], 0.0f, 3.0f));
+
+    min(a, b, result);
+    TEST_EQ_APPROX("min", result.get(2), min(va[2], vb[2]));
+
+    max(a, b, result);
+    TEST_EQ_APPROX("max", result.get(2), max(va[2], vb[2]));
+
+    result = b;
+    fma(a, b, result, result);
+    TEST_EQ_APPROX("fma", result.get(COUNT - 1), fma(va[COUNT - 1], vb[COUNT - 1], vb[COUNT - 1]));
+
+    Vec3Array cos_result;
+    sincos(b, result, cos_result);
+    TEST_EQ_APPROX("sin", result.get(COUNT - 1), sin(vb[COUNT - 1]));
+    TEST_EQ_APPROX("cos", cos_result.get(COUNT - 1), cos(vb[COUNT - 1]));
+
+    exp(b, result);
+    TEST_EQ_APPROX("exp", result.get(COUNT - 1), exp(vb[COUNT - 1]));
+
+    atan2(a, b, result);
+    TEST_EQ_APPROX("atan2", result.get(3), atan2(va[3], vb[3]));
+  });
+}
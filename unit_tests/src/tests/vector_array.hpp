@@ -0,0 +1,4 @@
+#pragma once
+
+
+void test_vector_array();